@@ -20,29 +20,283 @@
 
 // Qt includes
 #include <QApplication>
+#include <QDir>
+#include <QFile>
 #include <QPushButton>
 #include <QTextStream>
+#include <QVector>
 
 // CTK includes
+#include <ctkDICOMCleaner.h>
+#include <ctkDICOMDatabaseWriter.h>
 #include <ctkDICOMIndexer.h>
 #include <ctkDICOM.h>
 
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcfilefo.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/dcmdata/dcuid.h>
+
 // STD includes
+#include <csignal>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
 
+namespace
+{
+ctkDICOMIndexer* runningIndexer = 0;
+ctkDICOMCleaner* runningCleaner = 0;
+
+/// Ctrl-C stops the import, the files indexed so far are kept.
+/// A canceled cleanup leaves the database unchanged.
+void cancelIndexing(int)
+{
+  if (runningIndexer)
+    {
+    runningIndexer->cancel();
+    }
+  if (runningCleaner)
+    {
+    runningCleaner->cancel();
+    }
+}
+
+/// Layout of the synthetic tree of --benchmark
+const int BenchmarkImagesPerSeries = 50;
+const int BenchmarkSeriesPerStudy = 4;
+const int BenchmarkStudiesPerPatient = 2;
+/// Appended to the tree directory to name the file recording the number
+/// of files of a generated tree. It is not in the tree to not be indexed.
+const char* BenchmarkMarkerSuffix = ".benchmark";
+
+//------------------------------------------------------------------------------
+/// Write the image-th 64x64 CT image of the synthetic tree
+bool writeBenchmarkFile(const QString& fileName, int image)
+{
+  const int series = image / BenchmarkImagesPerSeries;
+  const int study = series / BenchmarkSeriesPerStudy;
+  const int patient = study / BenchmarkStudiesPerPatient;
+  const QString root("1.2.826.0.1.3680043.2.1125.1");
+  DcmFileFormat fileformat;
+  DcmDataset* dataset = fileformat.getDataset();
+  dataset->putAndInsertString(DCM_SOPClassUID, UID_CTImageStorage);
+  dataset->putAndInsertString(DCM_SOPInstanceUID,
+    QString("%1.3.%2").arg(root).arg(image).toLatin1().constData());
+  dataset->putAndInsertString(DCM_PatientsName,
+    QString("Benchmark^Patient%1").arg(patient).toLatin1().constData());
+  dataset->putAndInsertString(DCM_PatientID,
+    QString("BENCH%1").arg(patient).toLatin1().constData());
+  dataset->putAndInsertString(DCM_PatientsBirthDate, "19700101");
+  dataset->putAndInsertString(DCM_StudyInstanceUID,
+    QString("%1.1.%2").arg(root).arg(study).toLatin1().constData());
+  dataset->putAndInsertString(DCM_StudyID, QString::number(study).toLatin1().constData());
+  dataset->putAndInsertString(DCM_StudyDate, "20100101");
+  dataset->putAndInsertString(DCM_StudyDescription, "Benchmark study");
+  dataset->putAndInsertString(DCM_SeriesInstanceUID,
+    QString("%1.2.%2").arg(root).arg(series).toLatin1().constData());
+  dataset->putAndInsertString(DCM_SeriesNumber, QString::number(series).toLatin1().constData());
+  dataset->putAndInsertString(DCM_SeriesDate, "20100101");
+  dataset->putAndInsertString(DCM_SeriesDescription, "Benchmark series");
+  dataset->putAndInsertString(DCM_Modality, "CT");
+  dataset->putAndInsertString(DCM_InstanceNumber,
+    QString::number(image % BenchmarkImagesPerSeries).toLatin1().constData());
+  dataset->putAndInsertString(DCM_PhotometricInterpretation, "MONOCHROME2");
+  dataset->putAndInsertUint16(DCM_Rows, 64);
+  dataset->putAndInsertUint16(DCM_Columns, 64);
+  dataset->putAndInsertUint16(DCM_SamplesPerPixel, 1);
+  dataset->putAndInsertUint16(DCM_BitsAllocated, 16);
+  dataset->putAndInsertUint16(DCM_BitsStored, 16);
+  dataset->putAndInsertUint16(DCM_HighBit, 15);
+  dataset->putAndInsertUint16(DCM_PixelRepresentation, 0);
+  QVector<Uint16> pixels(64 * 64, static_cast<Uint16>(image));
+  dataset->putAndInsertUint16Array(DCM_PixelData, pixels.data(), pixels.size());
+  return fileformat.saveFile(fileName.toLocal8Bit().constData(),
+                             EXS_LittleEndianExplicit).good();
+}
+
+//------------------------------------------------------------------------------
+/// Generate a tree of @param files images in @param directory, one
+/// directory per series, unless a previous run generated it. The trees of
+/// different sizes go to different directories, see runBenchmark(), since
+/// nothing is removed from the directory. Return -1 on error, the number
+/// of files written otherwise.
+int generateBenchmarkTree(const QString& directory, int files)
+{
+  QDir dir(directory);
+  QFile marker(dir.absolutePath() + BenchmarkMarkerSuffix);
+  if (marker.open(QIODevice::ReadOnly) &&
+      marker.readAll().trimmed().toInt() == files)
+    {
+    return 0;
+    }
+  marker.close();
+  for (int image = 0; image < files; ++image)
+    {
+    const int series = image / BenchmarkImagesPerSeries;
+    const QString seriesPath = QString("patient%1/study%2/series%3")
+      .arg(series / BenchmarkSeriesPerStudy / BenchmarkStudiesPerPatient)
+      .arg(series / BenchmarkSeriesPerStudy).arg(series);
+    if (!dir.mkpath(seriesPath) ||
+        !writeBenchmarkFile(dir.filePath(seriesPath + QString("/image%1.dcm").arg(image)),
+                            image))
+      {
+      return -1;
+      }
+    }
+  if (!marker.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+    return -1;
+    }
+  marker.write(QByteArray::number(files) + "\n");
+  return files;
+}
+
+//------------------------------------------------------------------------------
+/// Index the synthetic tree in an empty database and report the statistics
+/// as JSON, in @param report or on the standard output. With a report
+/// file, the main figures are also printed as CTest measurements.
+int runBenchmark(ctkDICOMIndexer& indexer, ctkDICOM& dicom, const QString& database,
+                 const QString& directory, int files, const QString& report,
+                 const QString& destination)
+{
+  // The images of a larger tree would be indexed too
+  const QString tree = QDir(directory).filePath(QString::number(files));
+  const int generated = generateBenchmarkTree(tree, files);
+  if (generated < 0)
+    {
+    std::cerr << "Could not generate the benchmark tree in " << qPrintable(tree) << "\n";
+    return EXIT_FAILURE;
+    }
+  dicom.openDatabase(database, ctkDICOM::PerformanceProfile);
+  if (!dicom.initializeDatabase())
+    {
+    std::cerr << "Could not initialize " << qPrintable(database) << "\n";
+    return EXIT_FAILURE;
+    }
+  indexer.addDirectory(dicom.database(), tree, destination);
+  const ctkDICOMIndexer::Statistics stats = indexer.lastStatistics();
+  dicom.closeDatabase();
+
+  const double seconds = stats.TotalMsecs / 1000.;
+  const double filesPerSecond = seconds > 0. ? stats.FilesIndexed / seconds : 0.;
+  const double megabytesRead = stats.BytesRead >= 0 ?
+    stats.BytesRead / (1024. * 1024.) : -1.;
+  QString json;
+  QTextStream stream(&json);
+  stream.setRealNumberNotation(QTextStream::FixedNotation);
+  stream.setRealNumberPrecision(3);
+  stream << "{\n"
+         << "  \"files\": " << files << ",\n"
+         << "  \"generated\": " << (generated > 0 ? "true" : "false") << ",\n"
+         << "  \"threads\": " << indexer.numberOfThreads() << ",\n"
+         << "  \"parsingMode\": \""
+         << (indexer.parsingMode() == ctkDICOMIndexer::HeaderOnly ? "HeaderOnly" : "FullDataset")
+         << "\",\n"
+         << "  \"storage\": " << (destination.isEmpty() ? "false" : "true") << ",\n"
+         << "  \"filesIndexed\": " << stats.FilesIndexed << ",\n"
+         << "  \"filesParsed\": " << stats.FilesParsed << ",\n"
+         << "  \"seconds\": " << seconds << ",\n"
+         << "  \"filesPerSecond\": " << filesPerSecond << ",\n"
+         << "  \"megabytesRead\": " << megabytesRead << ",\n"
+         << "  \"sqlStatements\": " << stats.SqlStatements << ",\n"
+         << "  \"sqlMsecs\": " << stats.SqlMsecs << ",\n"
+         << "  \"stages\": {\n"
+         << "    \"scanMsecs\": " << stats.ScanMsecs << ",\n"
+         << "    \"parseMsecs\": " << stats.ParseMsecs << ",\n"
+         << "    \"databaseMsecs\": " << stats.DatabaseMsecs << ",\n"
+         << "    \"copyMsecs\": " << stats.StorageMsecs << "\n"
+         << "  },\n"
+         << "  \"peakResidentSetSize\": " << stats.PeakResidentSetSize << ",\n"
+         << "  \"cacheHits\": " << stats.CacheHits << ",\n"
+         << "  \"cacheMisses\": " << stats.CacheMisses << "\n"
+         << "}\n";
+  stream.flush();
+
+  QTextStream out(stdout);
+  if (report.isEmpty())
+    {
+    out << json;
+    }
+  else
+    {
+    QFile reportFile(report);
+    if (!reportFile.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+      {
+      std::cerr << "Could not write " << qPrintable(report) << "\n";
+      return EXIT_FAILURE;
+      }
+    reportFile.write(json.toUtf8());
+    const char* measurement = "<DartMeasurement name=\"%1\" type=\"numeric/double\">%2</DartMeasurement>\n";
+    out << QString(measurement).arg("FilesPerSecond").arg(filesPerSecond)
+        << QString(measurement).arg("ParseMsecs").arg(stats.ParseMsecs)
+        << QString(measurement).arg("DatabaseMsecs").arg(stats.DatabaseMsecs)
+        << QString(measurement).arg("SqlStatements").arg(stats.SqlStatements)
+        << QString(measurement).arg("PeakResidentSetSize").arg(stats.PeakResidentSetSize);
+    }
+  if (stats.FilesIndexed != files)
+    {
+    std::cerr << "Indexed " << stats.FilesIndexed << " files out of " << files << "\n";
+    return EXIT_FAILURE;
+    }
+  return EXIT_SUCCESS;
+}
+
+/// Print the removed files, or the files to remove in dry run, and the
+/// number of rows. Return false if the standard output failed.
+bool printCleanupReport(const ctkDICOMCleaner::Report& report)
+{
+  QTextStream out(stdout);
+  foreach(const QString& file, report.MissingFiles)
+    {
+    out << "missing   " << file << "\n";
+    }
+  foreach(const QString& file, report.CorruptedFiles)
+    {
+    out << "corrupted " << file << "\n";
+    }
+  out << (report.DryRun ? "Would remove " : "Removed ")
+      << report.ImagesRemoved << " images, " << report.SeriesRemoved << " series, "
+      << report.StudiesRemoved << " studies and " << report.PatientsRemoved
+      << " patients after checking " << report.ImagesChecked << " images in "
+      << report.CheckMsecs / 1000. << " s\n";
+  if (!report.DryRun && report.DatabaseBytesBefore >= 0)
+    {
+    out << "Database size: " << report.DatabaseBytesBefore << " -> "
+        << report.DatabaseBytesAfter << " bytes, " << report.TotalMsecs / 1000. << " s\n";
+    }
+  out.flush();
+  return out.status() == QTextStream::Ok;
+}
+}
+
 void print_usage()
 {
   std::cerr << "Usage:\n";
-  std::cerr << "  1. ctkDICOMIndexer --add <database.db> <sourceDir> [destDir]\n";
+  std::cerr << "  1. ctkDICOMIndexer --add <database.db> <sourceDir> [destDir [copy|link|clone|move]]\n";
   std::cerr << "     Adds (or refreshes) sourceDir to the index of the database.\n";
   std::cerr << "     Creates the database if it is not valid..\n";
-  std::cerr << "     If destDir is provided, images are copied there after import.\n";
+  std::cerr << "     If destDir is provided, images are stored there after import,\n";
+  std::cerr << "     copied by default, or hard linked, cloned or moved.\n";
   std::cerr << "  2. ctkDICOMIndexer --init <database.db> [sqlScript]\n";
   std::cerr << "     Reinitialize the database. Uses default schema or the provided sqlScript file.\n";
-  std::cerr << "  3. ctkDICOMIndexer --cleanup <database.db>\n";
-  std::cerr << "     Remove non-existent files from the database.\n";
+  std::cerr << "  3. ctkDICOMIndexer --cleanup <database.db> [exists|header|full [dry-run]]\n";
+  std::cerr << "     Remove the images whose file is missing, or whose header can't be\n";
+  std::cerr << "     parsed or doesn't match (header), or that can't be read entirely\n";
+  std::cerr << "     (full), and the series, studies and patients left without images.\n";
+  std::cerr << "     Recompute the image counts and sizes of the series and studies and\n";
+  std::cerr << "     compact the database. In dry run, only list what would be removed.\n";
+  std::cerr << "  4. ctkDICOMIndexer --benchmark <database.db> <treeDir> [fileCount [report.json [destDir]]]\n";
+  std::cerr << "     Index a synthetic tree of fileCount images (1000 by default) in an empty\n";
+  std::cerr << "     database, the tree is generated in treeDir/fileCount unless a previous\n";
+  std::cerr << "     run did.\n";
+  std::cerr << "     Files/s, MB read, SQL statements, time per stage and peak memory are\n";
+  std::cerr << "     written as JSON in report.json, or on the standard output.\n";
+  std::cerr << "     If destDir is provided, the files are also copied there.\n";
   return;
 }
 
@@ -65,13 +319,37 @@ int main(int argc, char** argv)
   ctkDICOMIndexer idx;
   ctkDICOM myCTK;
 
+  runningIndexer = &idx;
+  std::signal(SIGINT, cancelIndexing);
+
 
   try
   {
     if (std::string("--add") == argv[1])
     {
       {
-        myCTK.openDatabase( argv[2] );
+        myCTK.openDatabase( argv[2], ctkDICOM::PerformanceProfile );
+        if (argc > 5)
+        {
+          const std::string mode(argv[5]);
+          if (mode == "link")
+          {
+            idx.setStorageMode(ctkDICOMStorage::HardLink);
+          }
+          else if (mode == "clone")
+          {
+            idx.setStorageMode(ctkDICOMStorage::Clone);
+          }
+          else if (mode == "move")
+          {
+            idx.setStorageMode(ctkDICOMStorage::Move);
+          }
+          else if (mode != "copy")
+          {
+            print_usage();
+            return EXIT_FAILURE;
+          }
+        }
         if (argc > 4)
         {
           idx.addDirectory(myCTK.database(),argv[3],argv[4]);
@@ -96,7 +374,59 @@ int main(int argc, char** argv)
     }
     else if (std::string("--cleanup") == argv[1])
     {
-      // TODO
+      ctkDICOMCleaner cleaner;
+      if (argc > 3)
+      {
+        const std::string verification(argv[3]);
+        if (verification == "header")
+        {
+          cleaner.setVerification(ctkDICOMCleaner::HeaderCheck);
+        }
+        else if (verification == "full")
+        {
+          cleaner.setVerification(ctkDICOMCleaner::FullCheck);
+        }
+        else if (verification != "exists")
+        {
+          print_usage();
+          return EXIT_FAILURE;
+        }
+      }
+      if (argc > 4)
+      {
+        if (std::string("dry-run") != argv[4])
+        {
+          print_usage();
+          return EXIT_FAILURE;
+        }
+        cleaner.setDryRun(true);
+      }
+      myCTK.openDatabase( argv[2], ctkDICOM::PerformanceProfile );
+      runningCleaner = &cleaner;
+      bool cleaned = cleaner.cleanup(myCTK.database());
+      runningCleaner = 0;
+      // The cleaner only updates the aggregates of the series and studies
+      // it removed rows from, the others may be wrong if the tables were
+      // changed without ctkDICOMDatabaseWriter
+      if (cleaned && !cleaner.dryRun() &&
+          !ctkDICOMDatabaseWriter(myCTK.database()).refreshAggregates())
+      {
+        std::cerr << "Could not recompute the image counts and sizes\n";
+        cleaned = false;
+      }
+      const ctkDICOMCleaner::Report report = cleaner.lastReport();
+      return printCleanupReport(report) && cleaned ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    else if (std::string("--benchmark") == argv[1] && argc > 3)
+    {
+      const int files = argc > 4 ? QString(argv[4]).toInt() : 1000;
+      if (files <= 0)
+      {
+        print_usage();
+        return EXIT_FAILURE;
+      }
+      return runBenchmark(idx, myCTK, argv[2], argv[3], files,
+                          argc > 5 ? argv[5] : "", argc > 6 ? argv[6] : "");
     }
     else
     {
@@ -35,7 +35,8 @@
 void print_usage()
 {
   std::cerr << "Usage:\n";
-  std::cerr << "  ctkDICOMQuery database callingAETitle calledAETitle host port\n";
+  std::cerr << "  ctkDICOMQuery database callingAETitle calledAETitle host port [associations]\n";
+  std::cerr << "     associations: number of series finds sent in parallel, 4 by default\n";
   return;
 }
 
@@ -87,6 +88,17 @@ int main(int argc, char** argv)
     return EXIT_FAILURE;
     }
   query.setPort ( port );
+  if ( argc > 6 )
+    {
+    int associations = QString ( argv[6] ).toInt ( &ok );
+    if ( !ok )
+      {
+      std::cerr << "Could not convert " << argv[6] << " to an integer" << std::endl;
+      print_usage();
+      return EXIT_FAILURE;
+      }
+    query.setMaximumAssociations ( associations );
+    }
 
   try
     {
@@ -58,12 +58,27 @@ ctkPluginBrowser::ctkPluginBrowser(ctkPluginFramework* framework)
 
   QStringList libFilter;
   libFilter << "*.dll" << "*.so" << "*.dylib";
+  QList<QUrl> pluginLocations;
   QDirIterator dirIter(pluginDirs.at(0), libFilter, QDir::Files);
   while(dirIter.hasNext())
+  {
+    pluginLocations << QUrl::fromLocalFile(dirIter.next());
+  }
+
+  QList<ctkPlugin*> plugins;
+  try
+  {
+    plugins = framework->getPluginContext()->installPlugins(pluginLocations);
+  }
+  catch (const ctkPluginException& e)
+  {
+    qCritical() << e.what();
+  }
+
+  foreach(ctkPlugin* plugin, plugins)
   {
     try
     {
-      ctkPlugin* plugin = framework->getPluginContext()->installPlugin(QUrl::fromLocalFile(dirIter.next()).toString());
       plugin->start(ctkPlugin::START_ACTIVATION_POLICY);
     }
     catch (const ctkPluginException& e)
@@ -3,6 +3,9 @@
 -- For the corresponding DICOM files and more information see
 -- http://www.slicer.org/slicerWiki/index.php/DICOM:Database
 -- 
+-- The tables follow dicom-schema.sql and the sample sets the same
+-- user_version, so keep both in sync when the schema changes.
+-- 
 -- Note: the semicolon at the end is necessary for the simple parser to separate
 --       the statements since the SQlite driver does not handle multiple
 --       commands per QSqlQuery::exec call!
@@ -14,2263 +17,2352 @@ DROP TABLE IF EXISTS 'Patients' ;
 DROP TABLE IF EXISTS 'Series' ;
 DROP TABLE IF EXISTS 'Studies' ;
 DROP TABLE IF EXISTS 'Directories' ;
-CREATE TABLE 'Images' (   'Filename' VARCHAR(1024) NOT NULL ,   'SeriesInstanceUID' VARCHAR(255) NOT NULL ,   PRIMARY KEY ('Filename') );
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead24.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead8.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead51.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead87.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead4.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead92.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead79.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead56.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead62.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead16.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead53.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead89.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead17.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead35.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead93.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead85.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead39.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead90.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead65.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead9.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead36.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead76.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead78.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead73.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead14.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead75.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead37.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead86.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead12.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead55.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead31.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead28.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead84.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead34.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead26.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead54.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead30.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead67.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead50.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead22.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead6.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead32.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead68.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead38.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead61.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead43.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead40.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead45.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead21.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead29.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead3.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead15.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead66.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead48.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead23.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead47.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead81.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead72.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead44.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead70.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead82.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead59.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead88.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead1.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead10.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead58.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead46.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead33.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead7.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead42.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead27.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead49.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead13.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead41.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead71.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead77.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead25.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead64.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead52.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead11.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead2.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead57.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead69.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead60.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead20.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead74.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead5.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead80.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead19.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead91.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead83.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead18.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CTHeadAxialDicom/CTHead63.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118383','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119059','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117047','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118425','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116697','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119927','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119535','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119437','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117543','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105475','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117921','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116179','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118509','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119913','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117389','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118103','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117893','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105783','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105147','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105503','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119871','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116151','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119269','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118755','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117585','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116879','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117865','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115899','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115913','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105797','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105909','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118905','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116599','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119521','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118467','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105161','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115319','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118710','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105531','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116011','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119815','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117215','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105307','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117501','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116235','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116767','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116851','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116865','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115885','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116081','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117711','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118439','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116039','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115941','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119731','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116669','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105377','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116515','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118565','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117837','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105559','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118313','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116109','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115459','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117291','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119703','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118854','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105063','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116305','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116137','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118299','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117089','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115431','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118075','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116025','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118215','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115655','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119675','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119633','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119003','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118701','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105881','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118481','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118495','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115795','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118649','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105021','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116781','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118145','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118131','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116263','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105741','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119199','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118061','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119605','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105895','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115955','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115529','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117683','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115473','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116487','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116991','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118369','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117375','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105489','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117347','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117277','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117851','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117627','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118947','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119283','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116655','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105433','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116165','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118728','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119941','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115641','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116403','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118397','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117145','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119689','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118355','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118047','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117459','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117655','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118607','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115403','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118271','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118635','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105251','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119787','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116711','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115697','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119241','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118791','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105447','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116375','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115809','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115487','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118523','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105951','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117879','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117403','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119983','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119465','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119395','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115389','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119899','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116123','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105671','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116795','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116221','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105811','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119843','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115969','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115669','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116837','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119073','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119101','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105979','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117187','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119143','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105713','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117557','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115263','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117319','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115501','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119381','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119661','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117949','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115997','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118809','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116557','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117669','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115683','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118257','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117977','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117739','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116949','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119647','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115871','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118327','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118692','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116347','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116753','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117529','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119717','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105293','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116585','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118719','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117571','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119451','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105657','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117305','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119969','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117725','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105349','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116935','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115781','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118746','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119213','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118663','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105119','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117641','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105035','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117697','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118800','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115375','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118818','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105839','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115739','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117159','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117201','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117613','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117417','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105517','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117963','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118285','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105049','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119773','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119297','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119563','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116921','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116725','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116501','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119857','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119577','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105755','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118593','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115613','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116473','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118579','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105685','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116445','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117361','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105867','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105175','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116809','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115543','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115857','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116823','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118229','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105105','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117033','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117991','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105923','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117599','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115753','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116683','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117935','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119423','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118863','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116291','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119493','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105405','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118537','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118453','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116319','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116207','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105265','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105091','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119227','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115823','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116641','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116977','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116627','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118827','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118961','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105601','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105335','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119157','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116361','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118005','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115711','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118933','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119017','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115445','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118877','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119829','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118919','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118989','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117795','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119955','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119409','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105545','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116249','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118019','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115571','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115767','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117243','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119325','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115291','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115725','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116907','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105461','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115585','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117473','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105279','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105363','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105993','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117173','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116529','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105209','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118891','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115333','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105133','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116739','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105321','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116333','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105965','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116067','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105615','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105643','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117767','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117333','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105573','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117753','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119549','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119353','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105699','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17106007','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119185','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105769','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118411','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119507','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117131','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117781','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119367','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118845','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119885','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115599','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116431','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118621','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118089','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117823','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117061','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118243','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116277','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118551','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119087','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117445','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119479','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118737','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116389','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119311','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116963','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116543','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105937','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119801','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118773','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117229','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119339','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117487','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105077','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115361','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118159','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115927','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119619','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116193','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119171','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117019','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118117','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118201','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119591','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118187','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118173','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118764','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117515','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116053','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117075','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116571','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115627','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117005','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116417','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116613','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119031','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118341','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119255','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119129','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105391','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105419','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119745','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117103','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115983','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115347','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119045','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115277','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117809','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118975','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119759','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17106021','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105727','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105629','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118836','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115557','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115515','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117907','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116459','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117431','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105587','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105223','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105237','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117117','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115417','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118782','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105853','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116095','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105825','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115305','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118033','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116893','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119115','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594908','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592174','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589989','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585730','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595969','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592302','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597907','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593923','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598435','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588016','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590613','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596804','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597236','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592483','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591758','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595020','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584322','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594940','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594668','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589349','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586343','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587552','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598883','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591870','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587079','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600547','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586887','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584242','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586167','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600499','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588000','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592350','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600083','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592771','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597539','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595921','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587968','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588480','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588400','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590229','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599207','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585250','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591982','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589301','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594092','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594124','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598099','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598563','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584530','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594620','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584466','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598947','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589733','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587920','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598355','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588176','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593987','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590117','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592286','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595404','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587904','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589381','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593235','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592675','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587175','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586775','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590133','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588752','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600451','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31582235','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589573','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587383','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595436','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594572','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596273','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597763','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590437','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591374','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599779','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596996','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597156','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597092','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589008','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590389','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587191','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586631','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598691','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590309','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587632','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591406','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589493','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590798','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587047','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588192','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593651','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594892','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594524','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587255','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597859','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600099','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592451','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586071','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599587','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600643','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588672','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596385','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598147','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600659','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589461','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590910','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598723','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590373','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587568','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589621','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585314','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590501','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584786','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593203','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594972','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593555','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593411','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597140','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595308','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600595','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596649','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591966','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600467','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586711','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597012','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584722','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589072','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595953','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591230','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588912','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588256','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586967','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592803','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593107','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591358','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594748','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596740','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593347','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586951','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593011','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589024','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596701','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587680','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599795','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599194','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596714','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597204','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594268','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588784','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593395','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592110','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599475','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587143','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598387','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599875','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592963','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593795','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598195','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588368','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594716','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593315','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595548','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596241','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585698','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31582251','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595937','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589333','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598307','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595244','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593059','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593875','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595036','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587063','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598931','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588352','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588112','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591518','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590709','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587712','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597619','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592531','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590597','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593971','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591006','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589525','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587159','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599324','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591678','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592547','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595100','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586535','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600579','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584626','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594380','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599907','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599411','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595340','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588448','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588960','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600403','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586199','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600707','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586647','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586663','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595484','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600371','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588416','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595212','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586423','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597108','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591182','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598803','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590565','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598163','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589253','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595761','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590677','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584834','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594604','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598979','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593587','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597523','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592467','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593603','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596820','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596257','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593859','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593939','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592094','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598483','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585959','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599427','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597891','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588544','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596662','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599747','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591134','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584594','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587399','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591566','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591326','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595905','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585170','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587872','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598403','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587936','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595228','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592611','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592062','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593043','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587536','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597747','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586743','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585682','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587271','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596193','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588160','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599827','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596209','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586455','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598531','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599683','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585538','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588240','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597715','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584226','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587776','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591710','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588992','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599523','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590878','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591726','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598787','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593331','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585218','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598067','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588592','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587504','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591934','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593763','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599955','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590629','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591070','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591838','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594156','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592883','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586007','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588800','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590293','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584386','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599011','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586375','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590261','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589056','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589829','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596597','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589125','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589845','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588864','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588816','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594332','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588048','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597507','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591550','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588096','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588880','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595388','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600115','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586359','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585634','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585090','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591486','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592435','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598419','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587223','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584562','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585490','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592739','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587584','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588080','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591294','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591166','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590325','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596623','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587888','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592851','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593779','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600723','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592979','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595596','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597987','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585714','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597124','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589269','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595889','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598323','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587616','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585618','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593891','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598707','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591038','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588144','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598291','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586871','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594988','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588208','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598227','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589605','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594204','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598371','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595068','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586183','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598995','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596129','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586311','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595084','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597044','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589413','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585943','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593027','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587696','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600211','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592915','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599259','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584658','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586983','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591694','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589957','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585410','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585442','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594924','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588432','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585927','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599539','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584818','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586327','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587207','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593219','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598579','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591886','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587792','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596097','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594956','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592691','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585074','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592899','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597252','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590197','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589941','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594172','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593139','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595532','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597939','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596675','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590942','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584306','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586055','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600179','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596417','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591422','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598547','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591278','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594284','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598627','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590862','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585746','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595500','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595260','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592254','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591118','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599987','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585234','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597635','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593491','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600307','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599043','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593667','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594108','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586791','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593187','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597923','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594812','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600163','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599027','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595052','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590245','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589749','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600323','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591614','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590517','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586503','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584850','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586487','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584418','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596636','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600419','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592787','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586679','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586823','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591742','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585586','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597683','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598035','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590782','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591086','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597172','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585847','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599220','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584754','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585186','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590149','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590469','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600227','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589701','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596980','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591662','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595873','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599971','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585831','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591918','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587031','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596852','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589205','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596481','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585602','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592014','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585554','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588688','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588304','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584610','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591806','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590830','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597651','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599285','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587015','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595164','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588560','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597188','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584210','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592206','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597667','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598867','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586263','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588496','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585298','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596433','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598739','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599350','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587239','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589893','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595713','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589397','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596900','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591102','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600387','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589221','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589557','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584578','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592238','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595292','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585042','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587856','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585522','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596932','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599075','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596353','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596916','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598915','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586599','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592995','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591262','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600339','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600675','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597076','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592627','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599507','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586135','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595148','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584514','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593283','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587351','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590037','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599395','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589765','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594348','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595132','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598243','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585863','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596497','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599571','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585202','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592707','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593843','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594876','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600131','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586919','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594700','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585138','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584642','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594444','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598835','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584194','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595985','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594764','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593539','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591454','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584258','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594220','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593123','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587127','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592835','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598451','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594780','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592595','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595825','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597060','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589189','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590485','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591854','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598819','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590005','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595420','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593475','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600611','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591630','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592723','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585911','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586583','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597811','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590926','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598339','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599491','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590974','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590277','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588128','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596465','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594252','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588944','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594476','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594140','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599298','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588928','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586039','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589445','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598515','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596401','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592947','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593715','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599603','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585394','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596001','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585570','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588608','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591646','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589781','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595516','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593811','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600259','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593251','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588528','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599233','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598851','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596610','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594300','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584866','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589317','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598899','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597827','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599859','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599891','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585106','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592563','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591502','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588320','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591598','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593507','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587664','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593683','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585666','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596145','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594860','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591246','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597571','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594364','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597955','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588384','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595452','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589653','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588512','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594556','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599311','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584402','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595628','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590846','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586567','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584882','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591998','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595276','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593955','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588720','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599555','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589157','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597555','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589237','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584914','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596289','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598115','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587984','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595468','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591950','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590085','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586935','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584770','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588288','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595564','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592366','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586279','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590069','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593635','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585895','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590181','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586615','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593459','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589541','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594844','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593267','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586407','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597971','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594412','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586727','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599619','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594828','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586231','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599923','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590421','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599443','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590213','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594492','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588656','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591054','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588576','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595660','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586023','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594316','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596727','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587367','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593299','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592126','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591198','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595841','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598659','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593379','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584738','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589877','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592318','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587303','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596836','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591390','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585426','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588976','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599459','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586855','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587287','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595004','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589909','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584674','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591822','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587488','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590958','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591342','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596369','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590357','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596964','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584930','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592419','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585506','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584290','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584898','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599843','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598003','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600243','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586391','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594732','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591150','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595777','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586807','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586759','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586087','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594540','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598675','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585010','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596321','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595356','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596337','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600483','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591470','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587335','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596065','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599246','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590405','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590165','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585026','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594636','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590549','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585282','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588896','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589173','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590021','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592867','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599715','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595180','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596081','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596571','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596584','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598755','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595324','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594076','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597699','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594188','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587095','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597220','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586151','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587648','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589589','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592190','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595809','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587808','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593827','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589925','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594508','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592499','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586903','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597587','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592046','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584978','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600003','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599272','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591438','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585458','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584994','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588768','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589797','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598051','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590661','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589141','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592931','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597779','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585650','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584482','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598179','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600563','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587111','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595612','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600627','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594396','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598643','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598131','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593363','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590053','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596449','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587520','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596756','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597795','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584690','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586551','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600291','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594003','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598499','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597603','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595196','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599811','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588736','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596113','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584706','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600019','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596017','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599337','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599699','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589685','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585122','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586439','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584450','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591310','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598611','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599363','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599091','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590894','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595793','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593443','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590101','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586519','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592755','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585378','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592078','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584434','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597731','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585362','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588464','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584546','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593747','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591022','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588224','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598275','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591582','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588624','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598467','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584802','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592819','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596788','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589040','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586103','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593171','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585346','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585474','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592222','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593091','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599379','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599651','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598595','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591790','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589509','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585991','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596688','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589365','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600147','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595745','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592659','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600067','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586215','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592158','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596513','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591774','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594684','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595729','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599181','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594428','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591902','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600035','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591214','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587415','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589429','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599059','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590341','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589861','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598259','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598771','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585154','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593075','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596161','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599667','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597843','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599635','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597028','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588064','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596868','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592030','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593571','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593907','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592270','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600691','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587840','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587824','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586695','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585058','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594236','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588832','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593619','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584370','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587600','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589717','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596948','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598019','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592515','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598963','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600531','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592142','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594460','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590990','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594588','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592334','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588272','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600515','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586471','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596884','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587952','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598083','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584946','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585266','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596529','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584354','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587760','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593731','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600195','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596305','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600275','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590581','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593523','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596033','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600435','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584274','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584498','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587319','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31597875','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590645','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31591534','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600355','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595116','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584962','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599763','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588336','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585975','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586247','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596558','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588032','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589973','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586295','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589285','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595372','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594652','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590814','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588704','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595580','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592579','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596177','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586839','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599939','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589669','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585879','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593155','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31592643','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595857','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588640','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589477','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31598211','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590533','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31599731','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596545','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31595644','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589637','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586999','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31594796','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593427','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31588848','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31585330','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31589813','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587728','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31600051','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590453','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596225','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596772','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31584338','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31590693','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31596049','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31593699','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31586119','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390000/31587744','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568347','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570842','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569445','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569393','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577590','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571076','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582539','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569003','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579462','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568477','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582897','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579332','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574305','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578890','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572997','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569055','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570738','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572373','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572191','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567385','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568815','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578760','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580939','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579202','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576099','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571362','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566631','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569549','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582795','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577467','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570868','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577668','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575631','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571232','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570530','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572711','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568737','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580627','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583563','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576973','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566709','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582963','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576359','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574643','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569939','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583589','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572815','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577077','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577441','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574539','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579124','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569237','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583095','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566527','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576768','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583199','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573907','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580835','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573829','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579020','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575553','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31584031','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567177','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573725','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575657','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569731','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571310','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582985','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575761','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574747','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574825','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578552','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582587','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547879','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583329','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574513','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581043','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580653','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570400','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576203','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575397','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572763','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580523','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571801','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574773','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568217','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580315','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547905','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568633','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569133','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569653','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567827','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566657','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569159','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583007','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578214','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571697','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583381','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567463','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570426','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571102','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569289','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577025','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547594','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570166','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570244','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577207','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575839','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575111','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577103','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575995','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580783','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569705','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583719','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571050','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574851','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566943','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581719','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581563','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573413','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581771','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574227','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582699','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575813','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580029','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570946','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569887','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582667','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582331','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583953','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569861','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31585762','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575787','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572347','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567775','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578136','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579540','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568035','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581511','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575267','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568087','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570296','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583771','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567931','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576151','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568243','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581069','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583225','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569029','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573985','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582031','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583407','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575033','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582941','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574565','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579743','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578968','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576456','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574617','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580445','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569263','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567645','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569497','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31584109','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575319','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581589','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581693','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574903','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576177','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581277','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577389','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578344','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578162','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547931','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570218','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576073','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575293','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582603','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573283','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580861','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583018','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568529','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568977','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575527','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568503','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567671','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576820','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579951','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567229','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575423','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583615','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547646','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570660','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578682','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566969','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568789','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567307','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581667','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582919','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579384','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568685','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568113','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573517','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574799','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567957','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572867','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578396','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580549','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576921','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575501','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576534','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582315','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568951','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569835','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578578','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567697','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577564','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570608','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574167','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566475','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577824','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573127','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572633','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578318','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581381','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571336','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578032','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583797','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572659','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575969','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569679','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566995','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583485','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571388','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576716','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570374','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567515','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576846','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578916','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577415','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567255','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579821','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569991','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582187','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580913','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570069','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580393','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582057','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573075','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573387','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575865','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575735','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583901','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572503','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582135','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583355','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578006','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575449','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578058','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567489','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575683','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574409','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569367','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583693','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570920','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578370','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573933','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571258','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572451','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580003','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577928','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579436','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576612','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582763','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569341','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575215','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579072','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581355','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578942','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581225','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547983','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582827','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582459','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567073','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580471','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577233','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578812','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573439','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567437','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577285','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572061','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579639','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572113','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570816','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577798','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576947','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582395','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573621','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571853','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582974','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572035','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547957','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582635','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579150','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574669','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571671','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571827','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573673','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578448','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577051','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579613','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577772','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580705','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582411','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583029','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567723','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582811','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570894','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583062','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579665','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573543','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567411','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573023','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572321','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580757','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575085','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581017','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575345','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566501','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575709','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579488','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579769','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547672','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568321','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583823','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582555','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582886','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582715','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572581','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547698','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574877','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581927','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580081','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583667','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567099','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568925','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580237','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574011','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573309','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577902','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582267','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574435','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578188','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571593','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575189','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31584083','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582779','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568295','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569523','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574695','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567619','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568191','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575891','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579795','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578838','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577954','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582083','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583641','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582651','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567749','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580055','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569471','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577616','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566865','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566891','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571645','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579691','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572945','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578084','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569107','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573699','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574461','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566449','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579925','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577538','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581537','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579514','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567203','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567879','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580809','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570270','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573101','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567593','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572139','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566735','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580601','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576385','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574487','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583040','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574981','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570556','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574253','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583147','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576229','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568555','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578474','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570504','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581823','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573335','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582299','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570140','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580419','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575475','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31585778','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582747','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571492','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579228','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581953','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571466','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581459','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568399','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573881','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576333','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567281','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571983','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580497','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579358','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570192','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583251','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567567','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571128','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573959','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547568','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567333','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581095','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572685','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583927','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567853','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569913','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574279','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576586','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576047','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568165','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572529','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572971','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575371','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581147','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580159','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571518','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571619','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570764','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579717','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573361','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578292','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581251','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583979','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583849','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583084','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571440','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569211','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567047','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573205','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575059','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582908','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574929','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568139','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577876','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573855','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578110','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577642','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573257','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570712','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582161','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571024','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577746','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575007','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582475','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569185','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581745','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575163','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575579','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566605','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583173','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578266','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583073','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570582','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580133','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576690','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572607','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569575','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582283','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568061','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580965','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580679','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582843','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582930','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566553','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581199','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569081','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583875','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567359','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577694','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547853','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569315','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576021','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567021','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574357','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567151','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571775','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566917','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583277','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574115','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577311','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579098','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582363','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568451','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576281','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571154','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547542','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576638','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582507','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578240','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578994','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573803','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571957','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579847','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580185','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568659','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577337','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578526','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568425','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572269','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576742','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568269','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574591','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566813','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573491','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568763','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547620','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574063','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573465','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577980','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576125','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580263','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580991','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568711','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576794','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573569','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566761','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576255','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566579','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574331','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581407','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570452','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582571','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580575','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583433','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576482','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582683','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581615','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579254','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568009','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570790','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583537','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575137','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581979','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568899','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572477','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568607','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574141','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582109','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572399','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570972','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572087','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579306','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578708','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575241','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582005','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574089','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581485','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569809','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579280','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547769','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578422','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578630','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572243','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582731','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569783','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570686','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567801','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572555','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577850','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571414','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578604','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580211','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579410','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576664','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572919','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578500','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582491','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574955','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579046','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547516','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581303','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576307','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573153','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579873','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583303','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572217','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570998','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566839','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580887','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570017','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572789','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583511','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31547827','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571180','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571749','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572893','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567983','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579176','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581329','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577363','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579977','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581173','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571284','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574383','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570043','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575605','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577259','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567905','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577129','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569965','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582875','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571931','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581875','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573647','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574037','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568373','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581641','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575917','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576999','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570634','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582859','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580367','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581901','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577155','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581121','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31574721','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570322','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580107','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582952','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568841','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582347','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31579899','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582427','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569757','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567125','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570348','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566683','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573751','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573231','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31575943','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583121','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569627','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571206','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569419','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576508','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572295','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573049','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578734','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572841','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581433','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572425','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581797','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31581849','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31566787','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573595','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31568581','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572737','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582379','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580341','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31584005','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578656','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582619','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583745','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582523','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31570478','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573777','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31567541','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578864','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580731','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31569601','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572009','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31578786','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577720','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571905','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31572165','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31576560','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31584057','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583459','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582996','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31573179','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571879','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31577181','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31582443','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31571723','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31580289','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080');
-INSERT INTO "Images" VALUES('CD1/DICOM/09112417/37390001/31583051','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147');
-CREATE TABLE 'Patients' (   'UID' INTEGER PRIMARY KEY AUTOINCREMENT,   'PatientsName' VARCHAR(255) NULL ,   'PatientID' VARCHAR(255) NULL ,   'PatientsBirthDate' DATE NULL ,   'PatientsBirthTime' TIME NULL ,   'PatientsSex' varchar(1) NULL ,   'PatientsComments' VARCHAR(255) NULL, 'PatientsAge' varchar(10) NULL );
-INSERT INTO "Patients" VALUES(14,'Austrialian','8775070',20060101,10100,'M','A volunteer','35');
-INSERT INTO "Patients" VALUES(15,'09.11.24-14:36:24-STD','09.11.24-14:36:24-STD-4.0.4094797',18581118,'','O','','78');
-INSERT INTO "Patients" VALUES(16,'MROVERLAY-13','09.11.24-14:37:10-STD-1.3.12.2.1107.5.2.31.30287',19560304,'','O','','102');
-CREATE TABLE 'Series' (   'SeriesInstanceUID' VARCHAR(255) NOT NULL ,   'StudyInstanceUID' VARCHAR(45) NOT NULL ,   'SeriesNumber' INT NULL ,   'SeriesDate' DATE NULL ,   'SeriesTime' VARCHAR(20) NULL ,   'SeriesDescription' VARCHAR(255) NULL ,   'BodyPartExamined' VARCHAR(255) NULL ,   'FrameOfReferenceUID' VARCHAR(255) NULL ,   'AcquisitionNumber' INT NULL ,   'ContrastAgent' VARCHAR(255) NULL ,   'ScanningSequence' VARCHAR(45) NULL ,   'EchoNumber' INT NULL ,   'TemporalPosition' INT NULL ,   PRIMARY KEY ('SeriesInstanceUID') );
-INSERT INTO "Series" VALUES('1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','1.2.826.0.1.3680043.2.1125.1.73379483469717886505187028001198162',123456,'','','None','','',0,'','',0,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','1.3.12.2.1107.5.4.5.50096.30000009112417295950800000029',1,'2009-11-24','173529.684000','DynaCT Nat Fill HU Normal [InSpace3D]','','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000394',1,'','',0,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','1.3.12.2.1107.5.4.5.50096.30000009112417295950800000029',1,'2009-11-24','173453.699000','Images for VOI selection','','',1,'','',0,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',17,'2009-11-24','160901.687000','t1_spc_WIP537_cor_body','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',18,'2009-11-24','161741.952000','t1_spc_WIP537_cor_surface','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',20,'2009-11-24','171701.952000','t1_spc_WIP537_cor_surface_PreScanNormalize_Needle','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',9,'2009-11-24','151607.280000','t1_se_ax_OFF_iso','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',5,'2009-11-24','150154.798000','t2_spc_ns_sag_p2_iso','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',6,'2009-11-24','150756.655000','t1_se_ax_OFF_iso','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',19,'2009-11-24','163552.202000','t1_spc_WIP537_cor_surface_PreScanNormalize','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',16,'2009-11-24','154932.124000','t1_se_ax_OFF','','1.3.12.2.1107.5.2.31.30287.2.20091124154153702.0.0.0',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',7,'2009-11-24','151226.577000','VIBE_1x1x1_body','','1.3.12.2.1107.5.2.31.30287.2.20091124143837049.0.0.0',1,'','GR',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',4,'2009-11-24','145754.627000','VIBE_1x1x1_body','','1.3.12.2.1107.5.2.31.30287.2.20091124143837049.0.0.0',1,'','GR',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',3,'2009-11-24','145630.752000','VIBE_1x1x1','','1.3.12.2.1107.5.2.31.30287.2.20091124143837049.0.0.0',1,'','GR',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',8,'2009-11-24','151416.108000','t1_se_ax_OFF_iso_body','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',1,'2009-11-24','144410.799000','SCOUT','','1.3.12.2.1107.5.2.31.30287.2.20091124143837049.0.0.0',1,'','GR',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',11,'2009-11-24','152020.233000','t1_se_ax_OFF','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',12,'2009-11-24','152211.187000','t1_se_ax_OFF_2mm','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',15,'2009-11-24','154334.780000','SCOUT','','1.3.12.2.1107.5.2.31.30287.2.20091124154153702.0.0.0',1,'','GR',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',2,'2009-11-24','144806.174000','t1_se_ax_OFF','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',10,'2009-11-24','151758.015000','t1_se_ax_OFF','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',13,'2009-11-24','152401.983000','t1_se_ax_OFF_2mm_body','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',14,'2009-11-24','152554.999000','t1_se_ax_OFF_2mm','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',103,'2009-11-24','171811.576000','<MPR Range[3]>','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',102,'2009-11-24','163724.171000','<MPR Range[2]>','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',101,'2009-11-24','162255.999000','<MPR Range[1]>','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',99,'2009-11-24','170811.702000','PhoenixZIPReport','','',0,'','',0,0);
-INSERT INTO "Series" VALUES('1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',100,'2009-11-24','162146.108000','<MPR Range>','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
-CREATE TABLE 'Studies' (   'StudyInstanceUID' VARCHAR(255) NOT NULL ,   'PatientsUID' INT NOT NULL ,   'StudyID' VARCHAR(255) NULL ,   'StudyDate' DATE NULL ,   'StudyTime' VARCHAR(20) NULL ,   'AccessionNumber' VARCHAR(255) NULL ,   'ModalitiesInStudy' VARCHAR(255) NULL ,   'InstitutionName' VARCHAR(255) NULL , 'ReferringPhysician' VARCHAR(255) NULL ,  'PerformingPhysiciansName' VARCHAR(255) NULL , 'StudyDescription' VARCHAR(255) NULL ,  PRIMARY KEY ('StudyInstanceUID') );
-INSERT INTO "Studies" VALUES('1.2.826.0.1.3680043.2.1125.1.73379483469717886505187028001198162',14,'123456','2009-01-02','010100.000000','1','','Hospital YYY', 'Unknown','me','None');
-INSERT INTO "Studies" VALUES('1.3.12.2.1107.5.4.5.50096.30000009112417295950800000029',15,'Default StudyID','2009-11-24','143624.000000','','','Hospital XXX', '','you','');
-INSERT INTO "Studies" VALUES('1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',16,'2','2009-11-24','143836.908000','','','Hospital XXX', 'IORDACHITA','her','Carrino^MR_Overlay');
-DELETE FROM sqlite_sequence;
-INSERT INTO "sqlite_sequence" VALUES('Patients',16);
+DROP TABLE IF EXISTS 'DirectoryJournal' ;
+DROP TABLE IF EXISTS 'SearchIndex' ;
+
+CREATE TABLE 'Images' (
+  'Filename' VARCHAR(1024) NOT NULL ,
+  'SeriesInstanceUID' VARCHAR(64) NOT NULL ,
+  'InsertTimestamp' VARCHAR(20) NOT NULL ,
+  'FileSize' INT NULL ,
+  'FileMTime' INT NULL ,
+  'Inode' INT NULL ,
+  PRIMARY KEY ('Filename') );
+CREATE TABLE 'Patients' (
+  'UID' INTEGER PRIMARY KEY AUTOINCREMENT,
+  'PatientsName' VARCHAR(255) NULL ,
+  'PatientID' VARCHAR(255) NULL ,
+  'PatientsBirthDate' DATE NULL ,
+  'PatientsBirthTime' TIME NULL ,
+  'PatientsSex' varchar(1) NULL ,
+  'PatientsAge' varchar(10) NULL ,
+  'PatientsComments' VARCHAR(255) NULL );
+CREATE TABLE 'Series' (
+  'SeriesInstanceUID' VARCHAR(64) NOT NULL ,
+  'StudyInstanceUID' VARCHAR(64) NOT NULL ,
+  'SeriesNumber' INT NULL ,
+  'SeriesDate' DATE NULL ,
+  'SeriesTime' VARCHAR(20) NULL ,
+  'SeriesDescription' VARCHAR(255) NULL ,
+  'BodyPartExamined' VARCHAR(255) NULL ,
+  'FrameOfReferenceUID' VARCHAR(64) NULL ,
+  'AcquisitionNumber' INT NULL ,
+  'ContrastAgent' VARCHAR(255) NULL ,
+  'ScanningSequence' VARCHAR(45) NULL ,
+  'EchoNumber' INT NULL ,
+  'TemporalPosition' INT NULL ,
+  'Modality' VARCHAR(16) NULL ,
+  'InstanceCount' INT NOT NULL DEFAULT 0 ,
+  'TotalBytes' INT NOT NULL DEFAULT 0 ,
+  PRIMARY KEY ('SeriesInstanceUID') );
+CREATE TABLE 'Studies' (
+  'StudyInstanceUID' VARCHAR(64) NOT NULL ,
+  'PatientsUID' INT NOT NULL ,
+  'StudyID' VARCHAR(255) NULL ,
+  'StudyDate' DATE NULL ,
+  'StudyTime' VARCHAR(20) NULL ,
+  'AccessionNumber' VARCHAR(255) NULL ,
+  'ModalitiesInStudy' VARCHAR(255) NULL ,
+  'InstitutionName' VARCHAR(255) NULL ,
+  'ReferringPhysician' VARCHAR(255) NULL ,
+  'PerformingPhysiciansName' VARCHAR(255) NULL ,
+  'StudyDescription' VARCHAR(255) NULL ,
+  'SeriesCount' INT NOT NULL DEFAULT 0 ,
+  'InstanceCount' INT NOT NULL DEFAULT 0 ,
+  'TotalBytes' INT NOT NULL DEFAULT 0 ,
+  'Modalities' VARCHAR(255) NULL ,
+  'FirstSeriesDate' DATE NULL ,
+  'LastSeriesDate' DATE NULL ,
+  PRIMARY KEY ('StudyInstanceUID') );
 
 CREATE TABLE 'Directories' (
   'Dirname' VARCHAR(1024) ,
   PRIMARY KEY ('Dirname') );
+CREATE TABLE 'DirectoryJournal' (
+  'Dirname' VARCHAR(1024) NOT NULL ,
+  'MTime' INT NULL ,
+  PRIMARY KEY ('Dirname') );
+
+CREATE VIRTUAL TABLE SearchIndex USING fts3(Level, UID, Content) ;
+
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead24.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead8.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead51.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead87.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead4.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead92.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead79.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead56.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead62.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead16.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead53.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead89.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead17.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead35.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead93.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead85.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead39.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead90.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead65.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead9.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead36.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead76.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead78.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead73.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead14.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead75.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead37.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead86.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead12.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead55.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead31.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead28.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead84.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead34.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead26.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead54.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead30.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead67.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead50.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead22.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead6.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead32.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead68.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead38.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead61.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead43.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead40.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead45.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead21.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead29.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead3.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead15.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead66.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead48.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead23.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead47.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead81.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead72.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead44.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead70.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead82.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead59.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead88.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead1.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead10.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead58.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead46.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead33.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead7.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead42.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead27.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead49.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead13.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead41.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead71.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead77.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead25.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead64.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead52.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead11.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead2.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead57.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead69.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead60.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead20.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead74.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead5.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead80.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead19.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead91.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead83.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead18.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CTHeadAxialDicom/CTHead63.dcm','1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118383','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119059','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117047','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118425','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116697','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119927','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119535','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119437','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117543','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105475','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117921','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116179','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118509','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119913','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117389','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118103','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117893','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105783','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105147','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105503','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119871','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116151','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119269','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118755','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117585','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116879','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117865','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115899','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115913','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105797','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105909','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118905','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116599','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119521','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118467','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105161','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115319','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118710','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105531','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116011','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119815','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117215','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105307','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117501','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116235','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116767','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116851','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116865','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115885','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116081','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117711','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118439','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116039','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115941','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119731','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116669','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105377','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116515','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118565','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117837','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105559','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118313','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116109','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115459','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117291','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119703','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118854','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105063','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116305','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116137','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118299','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117089','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115431','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118075','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116025','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118215','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115655','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119675','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119633','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119003','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118701','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105881','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118481','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118495','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115795','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118649','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105021','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116781','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118145','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118131','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116263','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105741','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119199','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118061','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119605','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105895','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115955','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115529','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117683','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115473','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116487','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116991','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118369','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117375','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105489','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117347','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117277','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117851','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117627','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118947','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119283','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116655','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105433','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116165','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118728','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119941','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115641','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116403','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118397','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117145','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119689','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118355','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118047','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117459','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117655','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118607','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115403','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118271','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118635','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105251','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119787','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116711','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115697','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119241','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118791','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105447','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116375','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115809','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115487','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118523','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105951','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117879','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117403','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119983','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119465','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119395','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115389','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119899','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116123','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105671','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116795','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116221','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105811','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119843','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115969','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115669','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116837','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119073','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119101','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105979','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117187','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119143','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105713','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117557','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115263','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117319','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115501','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119381','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119661','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117949','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115997','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118809','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116557','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117669','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115683','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118257','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117977','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117739','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116949','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119647','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115871','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118327','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118692','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116347','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116753','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117529','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119717','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105293','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116585','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118719','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117571','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119451','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105657','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117305','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119969','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117725','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105349','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116935','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115781','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118746','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119213','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118663','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105119','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117641','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105035','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117697','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118800','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115375','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118818','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105839','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115739','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117159','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117201','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117613','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117417','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105517','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117963','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118285','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105049','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119773','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119297','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119563','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116921','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116725','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116501','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119857','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119577','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105755','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118593','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115613','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116473','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118579','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105685','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116445','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117361','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105867','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105175','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116809','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115543','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115857','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116823','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118229','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105105','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117033','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117991','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105923','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117599','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115753','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116683','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117935','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119423','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118863','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116291','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119493','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105405','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118537','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118453','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116319','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116207','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105265','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105091','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119227','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115823','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116641','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116977','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116627','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118827','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118961','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105601','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105335','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119157','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116361','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118005','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115711','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118933','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119017','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115445','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118877','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119829','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118919','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118989','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117795','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119955','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119409','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105545','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116249','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118019','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115571','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115767','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117243','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119325','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115291','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115725','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116907','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105461','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115585','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117473','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105279','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105363','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105993','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117173','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116529','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105209','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118891','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115333','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105133','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116739','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105321','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116333','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105965','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116067','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105615','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105643','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117767','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117333','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105573','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117753','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119549','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119353','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105699','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17106007','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119185','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105769','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118411','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119507','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117131','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117781','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119367','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118845','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119885','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115599','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116431','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118621','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118089','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117823','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117061','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118243','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116277','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118551','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119087','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117445','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119479','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118737','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116389','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119311','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116963','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116543','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105937','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119801','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118773','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117229','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119339','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117487','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105077','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115361','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118159','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115927','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119619','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116193','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119171','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117019','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118117','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118201','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119591','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118187','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118173','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118764','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117515','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116053','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117075','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116571','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115627','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117005','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116417','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116613','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119031','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118341','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119255','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119129','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105391','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105419','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119745','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117103','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115983','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115347','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119045','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115277','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117809','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118975','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119759','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17106021','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105727','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105629','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118836','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115557','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115515','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117907','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116459','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117431','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105587','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105223','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105237','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17117117','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115417','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118782','1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105853','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116095','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17105825','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17115305','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17118033','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17116893','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD2 (Dyna CT)/DICOM/09112417/40300000/17119115','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594908','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592174','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589989','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585730','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595969','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592302','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597907','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593923','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598435','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588016','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590613','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596804','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597236','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592483','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591758','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595020','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584322','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594940','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594668','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589349','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586343','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587552','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598883','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591870','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587079','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600547','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586887','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584242','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586167','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600499','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588000','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592350','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600083','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592771','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597539','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595921','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587968','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588480','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588400','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590229','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599207','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585250','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591982','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589301','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594092','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594124','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598099','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598563','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584530','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594620','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584466','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598947','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589733','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587920','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598355','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588176','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593987','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590117','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592286','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595404','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587904','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589381','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593235','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592675','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587175','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586775','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590133','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588752','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600451','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31582235','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589573','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587383','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595436','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594572','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596273','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597763','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590437','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591374','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599779','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596996','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597156','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597092','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589008','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590389','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587191','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586631','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598691','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590309','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587632','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591406','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589493','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590798','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587047','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588192','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593651','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594892','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594524','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587255','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597859','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600099','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592451','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586071','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599587','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600643','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588672','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596385','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598147','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600659','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589461','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590910','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598723','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590373','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587568','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589621','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585314','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590501','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584786','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593203','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594972','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593555','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593411','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597140','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595308','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600595','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596649','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591966','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600467','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586711','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597012','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584722','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589072','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595953','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591230','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588912','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588256','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586967','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592803','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593107','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591358','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594748','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596740','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593347','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586951','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593011','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589024','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596701','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587680','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599795','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599194','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596714','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597204','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594268','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588784','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593395','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592110','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599475','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587143','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598387','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599875','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592963','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593795','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598195','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588368','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594716','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593315','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595548','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596241','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585698','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31582251','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595937','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589333','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598307','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595244','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593059','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593875','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595036','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587063','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598931','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588352','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588112','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591518','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590709','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587712','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597619','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592531','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590597','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593971','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591006','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589525','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587159','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599324','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591678','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592547','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595100','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586535','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600579','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584626','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594380','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599907','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599411','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595340','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588448','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588960','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600403','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586199','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600707','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586647','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586663','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595484','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600371','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588416','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595212','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586423','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597108','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591182','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598803','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590565','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598163','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589253','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595761','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590677','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584834','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594604','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598979','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593587','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597523','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592467','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593603','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596820','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596257','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593859','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593939','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592094','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598483','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585959','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599427','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597891','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588544','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596662','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599747','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591134','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584594','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587399','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591566','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591326','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595905','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585170','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587872','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598403','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587936','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595228','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592611','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592062','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593043','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587536','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597747','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586743','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585682','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587271','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596193','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588160','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599827','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596209','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586455','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598531','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599683','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585538','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588240','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597715','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584226','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587776','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591710','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588992','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599523','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590878','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591726','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598787','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593331','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585218','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598067','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588592','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587504','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591934','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593763','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599955','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590629','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591070','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591838','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594156','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592883','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586007','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588800','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590293','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584386','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599011','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586375','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590261','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589056','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589829','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596597','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589125','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589845','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588864','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588816','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594332','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588048','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597507','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591550','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588096','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588880','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595388','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600115','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586359','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585634','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585090','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591486','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592435','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598419','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587223','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584562','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585490','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592739','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587584','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588080','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591294','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591166','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590325','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596623','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587888','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592851','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593779','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600723','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592979','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595596','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597987','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585714','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597124','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589269','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595889','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598323','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587616','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585618','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593891','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598707','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591038','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588144','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598291','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586871','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594988','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588208','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598227','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589605','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594204','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598371','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595068','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586183','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598995','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596129','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586311','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595084','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597044','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589413','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585943','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593027','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587696','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600211','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592915','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599259','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584658','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586983','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591694','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589957','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585410','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585442','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594924','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588432','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585927','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599539','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584818','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586327','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587207','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593219','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598579','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591886','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587792','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596097','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594956','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592691','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585074','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592899','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597252','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590197','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589941','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594172','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593139','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595532','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597939','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596675','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590942','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584306','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586055','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600179','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596417','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591422','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598547','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591278','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594284','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598627','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590862','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585746','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595500','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595260','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592254','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591118','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599987','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585234','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597635','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593491','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600307','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599043','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593667','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594108','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586791','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593187','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597923','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594812','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600163','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599027','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595052','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590245','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589749','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600323','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591614','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590517','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586503','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584850','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586487','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584418','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596636','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600419','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592787','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586679','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586823','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591742','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585586','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597683','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598035','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590782','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591086','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597172','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585847','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599220','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584754','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585186','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590149','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590469','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600227','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589701','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596980','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591662','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595873','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599971','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585831','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591918','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587031','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596852','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589205','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596481','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585602','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592014','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585554','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588688','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588304','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584610','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591806','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590830','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597651','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599285','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587015','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595164','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588560','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597188','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584210','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592206','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597667','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598867','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586263','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588496','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585298','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596433','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598739','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599350','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587239','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589893','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595713','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589397','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596900','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591102','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600387','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589221','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589557','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584578','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592238','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595292','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585042','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587856','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585522','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596932','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599075','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596353','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596916','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598915','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586599','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592995','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591262','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600339','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600675','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597076','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592627','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599507','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586135','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595148','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584514','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593283','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587351','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590037','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599395','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589765','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594348','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595132','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598243','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585863','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596497','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599571','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585202','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592707','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593843','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594876','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600131','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586919','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594700','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585138','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584642','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594444','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598835','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584194','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595985','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594764','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593539','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591454','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584258','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594220','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593123','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587127','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592835','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598451','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594780','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592595','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595825','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597060','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589189','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590485','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591854','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598819','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590005','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595420','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593475','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600611','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591630','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592723','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585911','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586583','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597811','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590926','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598339','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599491','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590974','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590277','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588128','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596465','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594252','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588944','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594476','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594140','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599298','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588928','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586039','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589445','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598515','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596401','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592947','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593715','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599603','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585394','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596001','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585570','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588608','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591646','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589781','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595516','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593811','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600259','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593251','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588528','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599233','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598851','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596610','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594300','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584866','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589317','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598899','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597827','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599859','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599891','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585106','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592563','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591502','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588320','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591598','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593507','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587664','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593683','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585666','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596145','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594860','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591246','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597571','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594364','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597955','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588384','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595452','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589653','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588512','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594556','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599311','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584402','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595628','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590846','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586567','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584882','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591998','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595276','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593955','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588720','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599555','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589157','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597555','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589237','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584914','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596289','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598115','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587984','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595468','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591950','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590085','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586935','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584770','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588288','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595564','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592366','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586279','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590069','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593635','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585895','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590181','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586615','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593459','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589541','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594844','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593267','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586407','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597971','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594412','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586727','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599619','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594828','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586231','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599923','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590421','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599443','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590213','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594492','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588656','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591054','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588576','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595660','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586023','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594316','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596727','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587367','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593299','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592126','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591198','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595841','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598659','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593379','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584738','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589877','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592318','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587303','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596836','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591390','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585426','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588976','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599459','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586855','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587287','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595004','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589909','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584674','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591822','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587488','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590958','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591342','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596369','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590357','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596964','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584930','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592419','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585506','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584290','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584898','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599843','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598003','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600243','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586391','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594732','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591150','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595777','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586807','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586759','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586087','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594540','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598675','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585010','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596321','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595356','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596337','1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600483','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591470','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587335','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596065','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599246','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590405','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590165','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585026','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594636','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590549','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585282','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588896','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589173','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590021','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592867','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599715','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595180','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596081','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596571','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596584','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598755','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595324','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594076','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597699','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594188','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587095','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597220','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586151','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587648','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589589','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592190','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595809','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587808','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593827','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589925','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594508','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592499','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586903','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597587','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592046','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584978','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600003','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599272','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591438','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585458','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584994','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588768','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589797','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598051','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590661','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589141','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592931','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597779','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585650','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584482','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598179','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600563','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587111','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595612','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600627','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594396','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598643','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598131','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593363','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590053','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596449','1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587520','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596756','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597795','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584690','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586551','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600291','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594003','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598499','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597603','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595196','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599811','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588736','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596113','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584706','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600019','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596017','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599337','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599699','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589685','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585122','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586439','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584450','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591310','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598611','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599363','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599091','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590894','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595793','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593443','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590101','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586519','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592755','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585378','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592078','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584434','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597731','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585362','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588464','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584546','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593747','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591022','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588224','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598275','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591582','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588624','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598467','1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584802','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592819','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596788','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589040','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586103','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593171','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585346','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585474','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592222','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593091','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599379','1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599651','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598595','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591790','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589509','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585991','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596688','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589365','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600147','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595745','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592659','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600067','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586215','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592158','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596513','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591774','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594684','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595729','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599181','1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594428','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591902','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600035','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591214','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587415','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589429','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599059','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590341','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589861','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598259','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598771','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585154','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593075','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596161','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599667','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597843','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599635','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597028','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588064','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596868','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592030','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593571','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593907','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592270','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600691','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587840','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587824','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586695','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585058','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594236','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588832','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593619','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584370','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587600','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589717','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596948','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598019','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592515','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598963','1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600531','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592142','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594460','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590990','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594588','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592334','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588272','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600515','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586471','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596884','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587952','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598083','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584946','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585266','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596529','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584354','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587760','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593731','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600195','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596305','1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600275','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590581','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593523','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596033','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600435','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584274','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584498','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587319','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31597875','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590645','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31591534','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600355','1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595116','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584962','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599763','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588336','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585975','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586247','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596558','1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588032','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589973','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586295','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589285','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595372','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594652','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590814','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588704','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595580','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592579','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596177','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586839','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599939','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589669','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585879','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593155','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31592643','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595857','1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588640','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589477','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31598211','1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590533','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31599731','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596545','1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31595644','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589637','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586999','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31594796','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593427','1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31588848','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31585330','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31589813','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587728','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31600051','1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590453','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596225','1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596772','1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31584338','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31590693','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31596049','1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31593699','1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31586119','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390000/31587744','1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568347','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570842','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569445','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569393','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577590','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571076','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582539','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569003','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579462','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568477','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582897','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579332','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574305','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578890','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572997','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569055','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570738','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572373','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572191','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567385','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568815','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578760','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580939','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579202','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576099','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571362','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566631','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569549','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582795','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577467','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570868','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577668','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575631','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571232','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570530','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572711','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568737','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580627','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583563','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576973','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566709','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582963','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576359','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574643','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569939','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583589','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572815','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577077','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577441','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574539','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579124','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569237','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583095','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566527','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576768','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583199','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573907','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580835','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573829','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579020','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575553','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31584031','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567177','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573725','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575657','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569731','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571310','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582985','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575761','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574747','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574825','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578552','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582587','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547879','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583329','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574513','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581043','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580653','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570400','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576203','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575397','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572763','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580523','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571801','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574773','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568217','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580315','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547905','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568633','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569133','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569653','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567827','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566657','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569159','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583007','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578214','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571697','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583381','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567463','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570426','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571102','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569289','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577025','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547594','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570166','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570244','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577207','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575839','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575111','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577103','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575995','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580783','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569705','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583719','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571050','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574851','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566943','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581719','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581563','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573413','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581771','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574227','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582699','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575813','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580029','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570946','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569887','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582667','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582331','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583953','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569861','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31585762','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575787','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572347','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567775','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578136','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579540','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568035','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581511','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575267','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568087','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570296','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583771','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567931','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576151','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568243','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581069','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583225','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569029','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573985','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582031','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583407','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575033','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582941','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574565','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579743','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578968','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576456','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574617','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580445','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569263','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567645','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569497','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31584109','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575319','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581589','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581693','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574903','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576177','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581277','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577389','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578344','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578162','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547931','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570218','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576073','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575293','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582603','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573283','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580861','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583018','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568529','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568977','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575527','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568503','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567671','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576820','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579951','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567229','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575423','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583615','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547646','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570660','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578682','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566969','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568789','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567307','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581667','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582919','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579384','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568685','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568113','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573517','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574799','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567957','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572867','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578396','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580549','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576921','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575501','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576534','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582315','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568951','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569835','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578578','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567697','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577564','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570608','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574167','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566475','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577824','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573127','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572633','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578318','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581381','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571336','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578032','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583797','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572659','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575969','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569679','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566995','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583485','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571388','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576716','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570374','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567515','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576846','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578916','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577415','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567255','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579821','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569991','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582187','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580913','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570069','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580393','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582057','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573075','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573387','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575865','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575735','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583901','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572503','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582135','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583355','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578006','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575449','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578058','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567489','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575683','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574409','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569367','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583693','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570920','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578370','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573933','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571258','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572451','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580003','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577928','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579436','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576612','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582763','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569341','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575215','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579072','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581355','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578942','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581225','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547983','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582827','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582459','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567073','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580471','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577233','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578812','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573439','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567437','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577285','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572061','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579639','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572113','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570816','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577798','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576947','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582395','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573621','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571853','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582974','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572035','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547957','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582635','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579150','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574669','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571671','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571827','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573673','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578448','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577051','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579613','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577772','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580705','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582411','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583029','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567723','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582811','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570894','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583062','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579665','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573543','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567411','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573023','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572321','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580757','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575085','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581017','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575345','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566501','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575709','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579488','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579769','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547672','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568321','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583823','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582555','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582886','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582715','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572581','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547698','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574877','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581927','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580081','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583667','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567099','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568925','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580237','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574011','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573309','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577902','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582267','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574435','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578188','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571593','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575189','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31584083','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582779','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568295','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569523','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574695','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567619','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568191','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575891','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579795','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578838','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577954','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582083','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583641','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582651','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567749','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580055','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569471','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577616','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566865','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566891','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571645','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579691','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572945','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578084','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569107','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573699','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574461','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566449','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579925','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577538','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581537','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579514','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567203','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567879','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580809','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570270','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573101','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567593','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572139','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566735','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580601','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576385','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574487','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583040','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574981','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570556','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574253','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583147','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576229','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568555','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578474','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570504','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581823','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573335','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582299','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570140','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580419','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575475','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31585778','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582747','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571492','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579228','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581953','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571466','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581459','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568399','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573881','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576333','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567281','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571983','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580497','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579358','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570192','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583251','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567567','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571128','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573959','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547568','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567333','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581095','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572685','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583927','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567853','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569913','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574279','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576586','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576047','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568165','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572529','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572971','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575371','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581147','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580159','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571518','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571619','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570764','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579717','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573361','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578292','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581251','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583979','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583849','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583084','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571440','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569211','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567047','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573205','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575059','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582908','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574929','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568139','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577876','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573855','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578110','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577642','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573257','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570712','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582161','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571024','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577746','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575007','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582475','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569185','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581745','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575163','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575579','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566605','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583173','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578266','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583073','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570582','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580133','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576690','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572607','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569575','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582283','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568061','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580965','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580679','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582843','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582930','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566553','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581199','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569081','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583875','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567359','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577694','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547853','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569315','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576021','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567021','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574357','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567151','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571775','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566917','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583277','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574115','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577311','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579098','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582363','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568451','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576281','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571154','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547542','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576638','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582507','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578240','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578994','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573803','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571957','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579847','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580185','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568659','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577337','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578526','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568425','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572269','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576742','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568269','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574591','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566813','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573491','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568763','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547620','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574063','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573465','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577980','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576125','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580263','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580991','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568711','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576794','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573569','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566761','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576255','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566579','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574331','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581407','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570452','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582571','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580575','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583433','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576482','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582683','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581615','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579254','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568009','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570790','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583537','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575137','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581979','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568899','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572477','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568607','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574141','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582109','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572399','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570972','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572087','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579306','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578708','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575241','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582005','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574089','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581485','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569809','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579280','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547769','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578422','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578630','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572243','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582731','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569783','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570686','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567801','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572555','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577850','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571414','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578604','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580211','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579410','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576664','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572919','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578500','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582491','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574955','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579046','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547516','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581303','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576307','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573153','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579873','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583303','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572217','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570998','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566839','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580887','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570017','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572789','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583511','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31547827','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571180','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571749','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572893','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567983','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579176','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581329','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577363','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579977','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581173','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571284','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574383','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570043','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575605','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577259','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567905','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577129','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569965','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582875','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571931','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581875','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573647','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574037','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568373','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581641','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575917','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576999','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570634','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582859','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580367','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581901','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577155','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581121','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31574721','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570322','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580107','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582952','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568841','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582347','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31579899','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582427','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569757','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567125','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570348','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566683','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573751','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573231','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31575943','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583121','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569627','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571206','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569419','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576508','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572295','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573049','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578734','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572841','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581433','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572425','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581797','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31581849','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31566787','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573595','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31568581','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572737','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582379','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580341','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31584005','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578656','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582619','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583745','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582523','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31570478','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573777','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31567541','1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578864','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580731','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31569601','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572009','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31578786','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577720','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571905','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31572165','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31576560','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31584057','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583459','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582996','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31573179','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571879','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31577181','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31582443','1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31571723','1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31580289','1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','2009-11-24T17:00:00');
+INSERT INTO "Images" ('Filename', 'SeriesInstanceUID', 'InsertTimestamp') VALUES('CD1/DICOM/09112417/37390001/31583051','1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','2009-11-24T17:00:00');
+INSERT INTO "Patients" ('UID', 'PatientsName', 'PatientID', 'PatientsBirthDate', 'PatientsBirthTime', 'PatientsSex', 'PatientsComments', 'PatientsAge') VALUES(14,'Austrialian','8775070',20060101,10100,'M','A volunteer','35');
+INSERT INTO "Patients" ('UID', 'PatientsName', 'PatientID', 'PatientsBirthDate', 'PatientsBirthTime', 'PatientsSex', 'PatientsComments', 'PatientsAge') VALUES(15,'09.11.24-14:36:24-STD','09.11.24-14:36:24-STD-4.0.4094797',18581118,'','O','','78');
+INSERT INTO "Patients" ('UID', 'PatientsName', 'PatientID', 'PatientsBirthDate', 'PatientsBirthTime', 'PatientsSex', 'PatientsComments', 'PatientsAge') VALUES(16,'MROVERLAY-13','09.11.24-14:37:10-STD-1.3.12.2.1107.5.2.31.30287',19560304,'','O','','102');
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.2.826.0.1.3680043.2.1125.1.65375240934815452318141136507497058','1.2.826.0.1.3680043.2.1125.1.73379483469717886505187028001198162',123456,'','','None','','',0,'','',0,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.4.7.6975.30000009112420245387500000395','1.3.12.2.1107.5.4.5.50096.30000009112417295950800000029',1,'2009-11-24','173529.684000','DynaCT Nat Fill HU Normal [InSpace3D]','','1.3.12.2.1107.5.4.7.6975.30000009112420245387500000394',1,'','',0,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.4.7.6975.30000009112420241301500000022','1.3.12.2.1107.5.4.5.50096.30000009112417295950800000029',1,'2009-11-24','173453.699000','Images for VOI selection','','',1,'','',0,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112416085385445425206.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',17,'2009-11-24','160901.687000','t1_spc_WIP537_cor_body','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112416173969227026001.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',18,'2009-11-24','161741.952000','t1_spc_WIP537_cor_surface','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112417165423402928463.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',20,'2009-11-24','171701.952000','t1_spc_WIP537_cor_surface_PreScanNormalize_Needle','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415160557860924767.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',9,'2009-11-24','151607.280000','t1_se_ax_OFF_iso','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415015166452324206.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',5,'2009-11-24','150154.798000','t2_spc_ns_sag_p2_iso','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415075486124424445.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',6,'2009-11-24','150756.655000','t1_se_ax_OFF_iso','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112416354054128327388.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',19,'2009-11-24','163552.202000','t1_spc_WIP537_cor_surface_PreScanNormalize','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415493132049125056.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',16,'2009-11-24','154932.124000','t1_se_ax_OFF','','1.3.12.2.1107.5.2.31.30287.2.20091124154153702.0.0.0',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415122398728824565.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',7,'2009-11-24','151226.577000','VIBE_1x1x1_body','','1.3.12.2.1107.5.2.31.30287.2.20091124143837049.0.0.0',1,'','GR',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112414575190620223971.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',4,'2009-11-24','145754.627000','VIBE_1x1x1_body','','1.3.12.2.1107.5.2.31.30287.2.20091124143837049.0.0.0',1,'','GR',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112414562789689323766.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',3,'2009-11-24','145630.752000','VIBE_1x1x1','','1.3.12.2.1107.5.2.31.30287.2.20091124143837049.0.0.0',1,'','GR',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415141429610124694.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',8,'2009-11-24','151416.108000','t1_se_ax_OFF_iso_body','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112414440663007822537.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',1,'2009-11-24','144410.799000','SCOUT','','1.3.12.2.1107.5.2.31.30287.2.20091124143837049.0.0.0',1,'','GR',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415201967481224864.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',11,'2009-11-24','152020.233000','t1_se_ax_OFF','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415221047088724889.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',12,'2009-11-24','152211.187000','t1_se_ax_OFF_2mm','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415433060459424973.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',15,'2009-11-24','154334.780000','SCOUT','','1.3.12.2.1107.5.2.31.30287.2.20091124154153702.0.0.0',1,'','GR',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112414480531183523134.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',2,'2009-11-24','144806.174000','t1_se_ax_OFF','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415175721344424833.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',10,'2009-11-24','151758.015000','t1_se_ax_OFF','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415240124326224925.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',13,'2009-11-24','152401.983000','t1_se_ax_OFF_2mm_body','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.2009112415255430595124964.0.0.0','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',14,'2009-11-24','152554.999000','t1_se_ax_OFF_2mm','','1.3.12.2.1107.5.2.31.30287.1.20091124143837049.0.0.4950',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.30000009112415082031000003549','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',103,'2009-11-24','171811.576000','<MPR Range[3]>','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.30000009112415082031000002726','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',102,'2009-11-24','163724.171000','<MPR Range[2]>','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.30000009112415082031000001903','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',101,'2009-11-24','162255.999000','<MPR Range[1]>','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.30000009112412545103000000147','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',99,'2009-11-24','170811.702000','PhoenixZIPReport','','',0,'','',0,0);
+INSERT INTO "Series" ('SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition') VALUES('1.3.12.2.1107.5.2.31.30287.30000009112415082031000001080','1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',100,'2009-11-24','162146.108000','<MPR Range>','','1.3.12.2.1107.5.2.31.30287.1.20091124154153702.0.0.5014',1,'','SE',1,0);
+INSERT INTO "Studies" ('StudyInstanceUID', 'PatientsUID', 'StudyID', 'StudyDate', 'StudyTime', 'AccessionNumber', 'ModalitiesInStudy', 'InstitutionName', 'ReferringPhysician', 'PerformingPhysiciansName', 'StudyDescription') VALUES('1.2.826.0.1.3680043.2.1125.1.73379483469717886505187028001198162',14,'123456','2009-01-02','010100.000000','1','','Hospital YYY', 'Unknown','me','None');
+INSERT INTO "Studies" ('StudyInstanceUID', 'PatientsUID', 'StudyID', 'StudyDate', 'StudyTime', 'AccessionNumber', 'ModalitiesInStudy', 'InstitutionName', 'ReferringPhysician', 'PerformingPhysiciansName', 'StudyDescription') VALUES('1.3.12.2.1107.5.4.5.50096.30000009112417295950800000029',15,'Default StudyID','2009-11-24','143624.000000','','','Hospital XXX', '','you','');
+INSERT INTO "Studies" ('StudyInstanceUID', 'PatientsUID', 'StudyID', 'StudyDate', 'StudyTime', 'AccessionNumber', 'ModalitiesInStudy', 'InstitutionName', 'ReferringPhysician', 'PerformingPhysiciansName', 'StudyDescription') VALUES('1.3.12.2.1107.5.2.31.30287.30000009112412540589000000011',16,'2','2009-11-24','143836.908000','','','Hospital XXX', 'IORDACHITA','her','Carrino^MR_Overlay');
+DELETE FROM sqlite_sequence;
+INSERT INTO "sqlite_sequence" VALUES('Patients',16);
+
+UPDATE Series SET
+  InstanceCount = (SELECT COUNT(*) FROM Images WHERE Images.SeriesInstanceUID = Series.SeriesInstanceUID),
+  TotalBytes = (SELECT ifnull(SUM(FileSize), 0) FROM Images WHERE Images.SeriesInstanceUID = Series.SeriesInstanceUID) ;
+UPDATE Studies SET
+  SeriesCount = (SELECT COUNT(*) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID),
+  InstanceCount = (SELECT ifnull(SUM(InstanceCount), 0) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID),
+  TotalBytes = (SELECT ifnull(SUM(TotalBytes), 0) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID),
+  FirstSeriesDate = (SELECT MIN(SeriesDate) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID),
+  LastSeriesDate = (SELECT MAX(SeriesDate) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID) ;
+
+CREATE INDEX 'PatientsIDIndex' ON 'Patients' ('PatientID', 'PatientsName', 'PatientsBirthDate') ;
+CREATE INDEX 'StudiesPatientIndex' ON 'Studies' ('PatientsUID') ;
+CREATE INDEX 'SeriesStudyIndex' ON 'Series' ('StudyInstanceUID') ;
+CREATE INDEX 'ImagesSeriesIndex' ON 'Images' ('SeriesInstanceUID') ;
+
+CREATE INDEX 'PatientsNameIndex' ON 'Patients' ('PatientsName') ;
+CREATE INDEX 'PatientsAgeIndex' ON 'Patients' ('PatientsAge') ;
+CREATE INDEX 'PatientsBirthDateIndex' ON 'Patients' ('PatientsBirthDate') ;
+CREATE INDEX 'StudiesPatientDateIndex' ON 'Studies' ('PatientsUID', 'StudyDate', 'StudyInstanceUID') ;
+CREATE INDEX 'StudiesPatientDescriptionIndex' ON 'Studies' ('PatientsUID', 'StudyDescription', 'StudyInstanceUID') ;
+CREATE INDEX 'StudiesPatientModalitiesIndex' ON 'Studies' ('PatientsUID', 'ModalitiesInStudy', 'StudyInstanceUID') ;
+CREATE INDEX 'StudiesPatientAccessionIndex' ON 'Studies' ('PatientsUID', 'AccessionNumber', 'StudyInstanceUID') ;
+CREATE INDEX 'SeriesStudyDateIndex' ON 'Series' ('StudyInstanceUID', 'SeriesDate', 'SeriesInstanceUID') ;
+CREATE INDEX 'SeriesStudyDescriptionIndex' ON 'Series' ('StudyInstanceUID', 'SeriesDescription', 'SeriesInstanceUID') ;
+CREATE INDEX 'SeriesStudyBodyPartIndex' ON 'Series' ('StudyInstanceUID', 'BodyPartExamined', 'SeriesInstanceUID') ;
+CREATE INDEX 'SeriesStudyAcquisitionIndex' ON 'Series' ('StudyInstanceUID', 'AcquisitionNumber', 'SeriesInstanceUID') ;
 
 COMMIT;
+
+PRAGMA user_version = 5 ;
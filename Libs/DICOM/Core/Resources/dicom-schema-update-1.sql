@@ -0,0 +1,15 @@
+--
+-- Migrate a DICOM database from the unversioned schema to version 1:
+-- add the indexes used by the indexer existence checks and by the
+-- queries of ctkDICOMModel.
+--
+-- Note: the semicolon at the end is necessary for the simple parser to separate
+--       the statements.
+-- ;
+
+CREATE INDEX IF NOT EXISTS 'PatientsIDIndex' ON 'Patients' ('PatientID', 'PatientsName', 'PatientsBirthDate') ;
+CREATE INDEX IF NOT EXISTS 'StudiesPatientIndex' ON 'Studies' ('PatientsUID') ;
+CREATE INDEX IF NOT EXISTS 'SeriesStudyIndex' ON 'Series' ('StudyInstanceUID') ;
+CREATE INDEX IF NOT EXISTS 'ImagesSeriesIndex' ON 'Images' ('SeriesInstanceUID') ;
+
+PRAGMA user_version = 1 ;
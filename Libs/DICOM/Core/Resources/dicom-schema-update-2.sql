@@ -0,0 +1,19 @@
+--
+-- Migrate a DICOM database from schema version 1 to version 2: add the
+-- file and directory stats used by ctkDICOMIndexer to skip the files and
+-- the directories that did not change since they were indexed.
+--
+-- Note: the semicolon at the end is necessary for the simple parser to separate
+--       the statements.
+-- ;
+
+ALTER TABLE 'Images' ADD COLUMN 'FileSize' INT NULL ;
+ALTER TABLE 'Images' ADD COLUMN 'FileMTime' INT NULL ;
+ALTER TABLE 'Images' ADD COLUMN 'Inode' INT NULL ;
+
+CREATE TABLE IF NOT EXISTS 'DirectoryJournal' (
+  'Dirname' VARCHAR(1024) NOT NULL ,
+  'MTime' INT NULL ,
+  PRIMARY KEY ('Dirname') );
+
+PRAGMA user_version = 2 ;
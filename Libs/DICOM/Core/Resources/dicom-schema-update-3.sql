@@ -0,0 +1,25 @@
+--
+-- Migrate a DICOM database from schema version 2 to version 3: add the
+-- indexes matching the sort orders of ctkDICOMModel, so that its keyset
+-- queries seek in an index instead of sorting the table. The patients are
+-- sorted by field then UID, the UID is the rowid ending each index. The
+-- studies and series are sorted within their parent by date, name, scan or
+-- number; the physician sorts are left to the few rows of a patient.
+--
+-- Note: the semicolon at the end is necessary for the simple parser to separate
+--       the statements.
+-- ;
+
+CREATE INDEX IF NOT EXISTS 'PatientsNameIndex' ON 'Patients' ('PatientsName') ;
+CREATE INDEX IF NOT EXISTS 'PatientsAgeIndex' ON 'Patients' ('PatientsAge') ;
+CREATE INDEX IF NOT EXISTS 'PatientsBirthDateIndex' ON 'Patients' ('PatientsBirthDate') ;
+CREATE INDEX IF NOT EXISTS 'StudiesPatientDateIndex' ON 'Studies' ('PatientsUID', 'StudyDate', 'StudyInstanceUID') ;
+CREATE INDEX IF NOT EXISTS 'StudiesPatientDescriptionIndex' ON 'Studies' ('PatientsUID', 'StudyDescription', 'StudyInstanceUID') ;
+CREATE INDEX IF NOT EXISTS 'StudiesPatientModalitiesIndex' ON 'Studies' ('PatientsUID', 'ModalitiesInStudy', 'StudyInstanceUID') ;
+CREATE INDEX IF NOT EXISTS 'StudiesPatientAccessionIndex' ON 'Studies' ('PatientsUID', 'AccessionNumber', 'StudyInstanceUID') ;
+CREATE INDEX IF NOT EXISTS 'SeriesStudyDateIndex' ON 'Series' ('StudyInstanceUID', 'SeriesDate', 'SeriesInstanceUID') ;
+CREATE INDEX IF NOT EXISTS 'SeriesStudyDescriptionIndex' ON 'Series' ('StudyInstanceUID', 'SeriesDescription', 'SeriesInstanceUID') ;
+CREATE INDEX IF NOT EXISTS 'SeriesStudyBodyPartIndex' ON 'Series' ('StudyInstanceUID', 'BodyPartExamined', 'SeriesInstanceUID') ;
+CREATE INDEX IF NOT EXISTS 'SeriesStudyAcquisitionIndex' ON 'Series' ('StudyInstanceUID', 'AcquisitionNumber', 'SeriesInstanceUID') ;
+
+PRAGMA user_version = 3 ;
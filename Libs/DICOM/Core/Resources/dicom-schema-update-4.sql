@@ -0,0 +1,31 @@
+--
+-- Migrate a DICOM database from schema version 3 to version 4: add the
+-- aggregates of the images of each series and of the series of each study,
+-- and compute them from the existing rows. The modality of the series is
+-- unknown until the files are indexed again.
+--
+-- Note: the semicolon at the end is necessary for the simple parser to separate
+--       the statements.
+-- ;
+
+ALTER TABLE 'Series' ADD COLUMN 'Modality' VARCHAR(16) NULL ;
+ALTER TABLE 'Series' ADD COLUMN 'InstanceCount' INT NOT NULL DEFAULT 0 ;
+ALTER TABLE 'Series' ADD COLUMN 'TotalBytes' INT NOT NULL DEFAULT 0 ;
+ALTER TABLE 'Studies' ADD COLUMN 'SeriesCount' INT NOT NULL DEFAULT 0 ;
+ALTER TABLE 'Studies' ADD COLUMN 'InstanceCount' INT NOT NULL DEFAULT 0 ;
+ALTER TABLE 'Studies' ADD COLUMN 'TotalBytes' INT NOT NULL DEFAULT 0 ;
+ALTER TABLE 'Studies' ADD COLUMN 'Modalities' VARCHAR(255) NULL ;
+ALTER TABLE 'Studies' ADD COLUMN 'FirstSeriesDate' DATE NULL ;
+ALTER TABLE 'Studies' ADD COLUMN 'LastSeriesDate' DATE NULL ;
+
+UPDATE Series SET
+  InstanceCount = (SELECT COUNT(*) FROM Images WHERE Images.SeriesInstanceUID = Series.SeriesInstanceUID),
+  TotalBytes = (SELECT ifnull(SUM(FileSize), 0) FROM Images WHERE Images.SeriesInstanceUID = Series.SeriesInstanceUID) ;
+UPDATE Studies SET
+  SeriesCount = (SELECT COUNT(*) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID),
+  InstanceCount = (SELECT ifnull(SUM(InstanceCount), 0) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID),
+  TotalBytes = (SELECT ifnull(SUM(TotalBytes), 0) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID),
+  FirstSeriesDate = (SELECT MIN(SeriesDate) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID),
+  LastSeriesDate = (SELECT MAX(SeriesDate) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID) ;
+
+PRAGMA user_version = 4 ;
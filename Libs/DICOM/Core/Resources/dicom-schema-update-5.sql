@@ -0,0 +1,15 @@
+--
+-- Migrate a DICOM database from schema version 4 to version 5: add the
+-- full-text index of the patients, studies and series searched by
+-- ctkDICOMSearch. Databases opened by an earlier CTK may already have an
+-- unversioned one, it is created again. The table is filled by
+-- ctkDICOM::openDatabase() once the migration is done.
+--
+-- Note: the semicolon at the end is necessary for the simple parser to separate
+--       the statements.
+-- ;
+
+DROP TABLE IF EXISTS 'SearchIndex' ;
+CREATE VIRTUAL TABLE SearchIndex USING fts3(Level, UID, Content) ;
+
+PRAGMA user_version = 5 ;
@@ -4,6 +4,17 @@
 -- Note: the semicolon at the end is necessary for the simple parser to separate
 --       the statements since the SQlite driver does not handle multiple
 --       commands per QSqlQuery::exec call!
+--
+-- The schema version is stored in the user_version pragma. When changing
+-- the schema, increment it here and in ctkDICOM.cpp and add a
+-- dicom-schema-update-<version>.sql script migrating the previous version.
+--
+-- The InstanceCount, TotalBytes, SeriesCount, Modalities and series date
+-- range of the Series and Studies tables aggregate the rows below them.
+-- They are maintained by ctkDICOMDatabaseWriter.
+--
+-- SearchIndex is the full-text index of ctkDICOMSearch, the SQLite library
+-- must have the fts3 module.
 -- ;
 
 DROP TABLE IF EXISTS 'Images' ;
@@ -11,11 +22,16 @@ DROP TABLE IF EXISTS 'Patients' ;
 DROP TABLE IF EXISTS 'Series' ;
 DROP TABLE IF EXISTS 'Studies' ;
 DROP TABLE IF EXISTS 'Directories' ;
+DROP TABLE IF EXISTS 'DirectoryJournal' ;
+DROP TABLE IF EXISTS 'SearchIndex' ;
 
 CREATE TABLE 'Images' (
   'Filename' VARCHAR(1024) NOT NULL ,
   'SeriesInstanceUID' VARCHAR(64) NOT NULL ,
   'InsertTimestamp' VARCHAR(20) NOT NULL ,
+  'FileSize' INT NULL ,
+  'FileMTime' INT NULL ,
+  'Inode' INT NULL ,
   PRIMARY KEY ('Filename') );
 CREATE TABLE 'Patients' (
   'UID' INTEGER PRIMARY KEY AUTOINCREMENT,
@@ -40,6 +56,9 @@ CREATE TABLE 'Series' (
   'ScanningSequence' VARCHAR(45) NULL ,
   'EchoNumber' INT NULL ,
   'TemporalPosition' INT NULL ,
+  'Modality' VARCHAR(16) NULL ,
+  'InstanceCount' INT NOT NULL DEFAULT 0 ,
+  'TotalBytes' INT NOT NULL DEFAULT 0 ,
   PRIMARY KEY ('SeriesInstanceUID') );
 CREATE TABLE 'Studies' (
   'StudyInstanceUID' VARCHAR(64) NOT NULL ,
@@ -53,8 +72,39 @@ CREATE TABLE 'Studies' (
   'ReferringPhysician' VARCHAR(255) NULL ,
   'PerformingPhysiciansName' VARCHAR(255) NULL ,
   'StudyDescription' VARCHAR(255) NULL ,
+  'SeriesCount' INT NOT NULL DEFAULT 0 ,
+  'InstanceCount' INT NOT NULL DEFAULT 0 ,
+  'TotalBytes' INT NOT NULL DEFAULT 0 ,
+  'Modalities' VARCHAR(255) NULL ,
+  'FirstSeriesDate' DATE NULL ,
+  'LastSeriesDate' DATE NULL ,
   PRIMARY KEY ('StudyInstanceUID') );
 
 CREATE TABLE 'Directories' (
   'Dirname' VARCHAR(1024) ,
   PRIMARY KEY ('Dirname') );
+CREATE TABLE 'DirectoryJournal' (
+  'Dirname' VARCHAR(1024) NOT NULL ,
+  'MTime' INT NULL ,
+  PRIMARY KEY ('Dirname') );
+
+CREATE VIRTUAL TABLE SearchIndex USING fts3(Level, UID, Content) ;
+
+CREATE INDEX 'PatientsIDIndex' ON 'Patients' ('PatientID', 'PatientsName', 'PatientsBirthDate') ;
+CREATE INDEX 'StudiesPatientIndex' ON 'Studies' ('PatientsUID') ;
+CREATE INDEX 'SeriesStudyIndex' ON 'Series' ('StudyInstanceUID') ;
+CREATE INDEX 'ImagesSeriesIndex' ON 'Images' ('SeriesInstanceUID') ;
+
+CREATE INDEX 'PatientsNameIndex' ON 'Patients' ('PatientsName') ;
+CREATE INDEX 'PatientsAgeIndex' ON 'Patients' ('PatientsAge') ;
+CREATE INDEX 'PatientsBirthDateIndex' ON 'Patients' ('PatientsBirthDate') ;
+CREATE INDEX 'StudiesPatientDateIndex' ON 'Studies' ('PatientsUID', 'StudyDate', 'StudyInstanceUID') ;
+CREATE INDEX 'StudiesPatientDescriptionIndex' ON 'Studies' ('PatientsUID', 'StudyDescription', 'StudyInstanceUID') ;
+CREATE INDEX 'StudiesPatientModalitiesIndex' ON 'Studies' ('PatientsUID', 'ModalitiesInStudy', 'StudyInstanceUID') ;
+CREATE INDEX 'StudiesPatientAccessionIndex' ON 'Studies' ('PatientsUID', 'AccessionNumber', 'StudyInstanceUID') ;
+CREATE INDEX 'SeriesStudyDateIndex' ON 'Series' ('StudyInstanceUID', 'SeriesDate', 'SeriesInstanceUID') ;
+CREATE INDEX 'SeriesStudyDescriptionIndex' ON 'Series' ('StudyInstanceUID', 'SeriesDescription', 'SeriesInstanceUID') ;
+CREATE INDEX 'SeriesStudyBodyPartIndex' ON 'Series' ('StudyInstanceUID', 'BodyPartExamined', 'SeriesInstanceUID') ;
+CREATE INDEX 'SeriesStudyAcquisitionIndex' ON 'Series' ('StudyInstanceUID', 'AcquisitionNumber', 'SeriesInstanceUID') ;
+
+PRAGMA user_version = 5 ;
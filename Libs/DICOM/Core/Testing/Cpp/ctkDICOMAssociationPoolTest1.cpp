@@ -0,0 +1,58 @@
+// Qt includes
+#include <QCoreApplication>
+#include <QTextStream>
+
+// ctkDICOMCore includes
+#include "ctkDICOMAssociationPool.h"
+
+// STD includes
+#include <iostream>
+#include <cstdlib>
+
+int ctkDICOMAssociationPoolTest1(int argc, char * argv []) {
+
+  QCoreApplication app(argc, argv);
+  QTextStream out(stdout);
+
+  if (ctkDICOMAssociationPool::instance() != ctkDICOMAssociationPool::instance() ||
+      ctkDICOMAssociationPool::instance()->parent() != &app)
+    {
+    out << "ERROR: the shared pool must be unique and owned by the application";
+    return EXIT_FAILURE;
+    }
+
+  ctkDICOMAssociationPool pool;
+  if (pool.echoInterval() != 30 ||
+      pool.idleTimeout() != 300 ||
+      pool.maximumIdleAssociations() != 8)
+    {
+    out << "ERROR: unexpected default settings";
+    return EXIT_FAILURE;
+    }
+  pool.setEchoInterval(0);
+  pool.setIdleTimeout(-1);
+  if (pool.echoInterval() != 0 || pool.idleTimeout() != 0)
+    {
+    out << "ERROR: settings not clamped";
+    return EXIT_FAILURE;
+    }
+
+  // nothing listens on the port: no association, nothing pooled
+  if (pool.acquire(ctkDICOMAssociationPool::FindService,
+                   "CTK", "NOBODY", "127.0.0.1", 1, 5) != 0 ||
+      pool.negotiations() != 0 ||
+      pool.reuses() != 0)
+    {
+    out << "ERROR: association acquired without a peer";
+    return EXIT_FAILURE;
+    }
+  pool.release(0);
+  pool.checkAssociations();
+  pool.clear();
+  if (pool.idleAssociations() != 0)
+    {
+    out << "ERROR: unexpected idle associations";
+    return EXIT_FAILURE;
+    }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,194 @@
+// Qt includes
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QSqlQuery>
+#include <QTextStream>
+#include <QVariant>
+
+// ctkDICOMCore includes
+#include "ctkDICOM.h"
+#include "ctkDICOMCleaner.h"
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexerRecord.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcfilefo.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/dcmdata/dcuid.h>
+
+// STD includes
+#include <iostream>
+#include <cstdlib>
+
+namespace
+{
+bool writeFile(const QString& fileName, const QString& seriesInstanceUID)
+{
+  DcmFileFormat fileformat;
+  DcmDataset* dataset = fileformat.getDataset();
+  dataset->putAndInsertString(DCM_SOPClassUID, UID_CTImageStorage);
+  dataset->putAndInsertString(DCM_SOPInstanceUID,
+    QString(fileName).replace('/', '.').toLatin1().constData());
+  dataset->putAndInsertString(DCM_SeriesInstanceUID,
+    seriesInstanceUID.toLatin1().constData());
+  return fileformat.saveFile(fileName.toLocal8Bit().constData(),
+                             EXS_LittleEndianExplicit).good();
+}
+
+int count(const QSqlDatabase& database, const QString& table)
+{
+  QSqlQuery query("SELECT COUNT(*) FROM " + table, database);
+  return query.next() ? query.value(0).toInt() : -1;
+}
+}
+
+int ctkDICOMCleanerTest1(int argc, char * argv []) {
+
+  QApplication app(argc, argv);
+  QTextStream out(stdout);
+  if (argc < 2)
+    {
+    out << "ERROR: missing working directory argument";
+    return EXIT_FAILURE;
+    }
+  QDir workingDir(argv[1]);
+  workingDir.mkpath(".");
+
+  ctkDICOM myCTK;
+  try
+  {
+    myCTK.openDatabase( workingDir.filePath("dicom-cleaner.db") );
+  }
+  catch (std::exception e)
+  {
+    out << "ERROR: " << e.what();
+    return EXIT_FAILURE;
+  }
+  if (! myCTK.initializeDatabase() ) {
+     out << "ERROR: basic DB init failed";
+     return EXIT_FAILURE;
+  }
+
+  // series 1.2.3.1 has 2 valid files, a file that is not DICOM and a file
+  // of another series; the files of 1.2.4.1, only series of the second
+  // patient, are missing
+  QStringList files;
+  for (int i = 0; i < 6; ++i)
+    {
+    files << workingDir.absoluteFilePath(QString("%1.dcm").arg(i));
+    QFile::remove(files.last());
+    }
+  QFile garbage(files[2]);
+  if (!writeFile(files[0], "1.2.3.1") || !writeFile(files[1], "1.2.3.1") ||
+      !writeFile(files[3], "9.9.9") || !garbage.open(QIODevice::WriteOnly) ||
+      garbage.write("not a DICOM file") < 0)
+    {
+    out << "ERROR: could not write the files";
+    return EXIT_FAILURE;
+    }
+  garbage.close();
+
+  {
+  ctkDICOMDatabaseWriter writer(myCTK.database());
+  for (int i = 0; i < 6; ++i)
+    {
+    ctkDICOMIndexerRecord record;
+    record.PatientsName = i < 4 ? "Cleaner^One" : "Cleaner^Two";
+    record.PatientID = i < 4 ? "CLEAN1" : "CLEAN2";
+    record.StudyInstanceUID = i < 4 ? "1.2.3" : "1.2.4";
+    record.SeriesInstanceUID = i < 4 ? "1.2.3.1" : "1.2.4.1";
+    record.Modality = "CT";
+    record.Filename = files[i];
+    if (!writer.insert(record))
+      {
+      out << "ERROR: insert failed";
+      return EXIT_FAILURE;
+      }
+    }
+  // a query result has no images, it is not removed
+  ctkDICOMIndexerRecord queryResult;
+  queryResult.PatientsName = "Query^Result";
+  queryResult.PatientID = "QUERY";
+  queryResult.StudyInstanceUID = "1.2.5";
+  queryResult.SeriesInstanceUID = "1.2.5.1";
+  if (!writer.insert(queryResult))
+    {
+    out << "ERROR: insert failed";
+    return EXIT_FAILURE;
+    }
+  writer.setDirectoryModificationTime(workingDir.absolutePath(), 1);
+  }
+
+  // the dry run leaves the database unchanged
+  ctkDICOMCleaner cleaner;
+  cleaner.setDryRun(true);
+  cleaner.setNumberOfThreads(3);
+  cleaner.setBatchSize(1);
+  if (!cleaner.cleanup(myCTK.database()))
+    {
+    out << "ERROR: dry run failed";
+    return EXIT_FAILURE;
+    }
+  ctkDICOMCleaner::Report report = cleaner.lastReport();
+  if (!report.DryRun || report.ImagesChecked != 6 ||
+      report.MissingFiles != (QStringList() << files[4] << files[5]) ||
+      !report.CorruptedFiles.isEmpty() || report.ImagesRemoved != 2 ||
+      report.SeriesRemoved != 1 || report.StudiesRemoved != 1 ||
+      report.PatientsRemoved != 1)
+    {
+    out << "ERROR: unexpected dry run report";
+    return EXIT_FAILURE;
+    }
+  if (count(myCTK.database(), "Images") != 6 || count(myCTK.database(), "Patients") != 3 ||
+      count(myCTK.database(), "DirectoryJournal") != 1)
+    {
+    out << "ERROR: the dry run changed the database";
+    return EXIT_FAILURE;
+    }
+
+  // the headers are parsed
+  cleaner.setDryRun(false);
+  cleaner.setVerification(ctkDICOMCleaner::HeaderCheck);
+  if (!cleaner.cleanup(myCTK.database()))
+    {
+    out << "ERROR: cleanup failed";
+    return EXIT_FAILURE;
+    }
+  report = cleaner.lastReport();
+  if (report.DryRun || report.MissingFiles.size() != 2 ||
+      report.CorruptedFiles != (QStringList() << files[2] << files[3]) ||
+      report.ImagesRemoved != 4 || report.SeriesRemoved != 1 ||
+      report.PatientsRemoved != 1)
+    {
+    out << "ERROR: unexpected cleanup report";
+    return EXIT_FAILURE;
+    }
+  QSqlQuery series("SELECT InstanceCount FROM Series WHERE SeriesInstanceUID = '1.2.3.1'",
+                   myCTK.database());
+  if (count(myCTK.database(), "Images") != 2 || count(myCTK.database(), "Series") != 2 ||
+      count(myCTK.database(), "Studies") != 2 || count(myCTK.database(), "Patients") != 2 ||
+      count(myCTK.database(), "DirectoryJournal") != 0 ||
+      !series.next() || series.value(0).toInt() != 2 || series.next())
+    {
+    out << "ERROR: unexpected database after cleanup";
+    return EXIT_FAILURE;
+    }
+
+  // nothing left to remove
+  cleaner.setVerification(ctkDICOMCleaner::FullCheck);
+  if (!cleaner.cleanup(myCTK.database()) ||
+      cleaner.lastReport().ImagesChecked != 2 || cleaner.lastReport().ImagesRemoved != 0 ||
+      !cleaner.lastReport().CorruptedFiles.isEmpty())
+    {
+    out << "ERROR: valid files removed";
+    return EXIT_FAILURE;
+    }
+
+  myCTK.closeDatabase();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,206 @@
+
+// Qt includes
+#include <QApplication>
+#include <QSqlQuery>
+#include <QTextStream>
+#include <QVariant>
+
+// ctkDICOMCore includes
+#include "ctkDICOM.h"
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexerRecord.h"
+
+// STD includes
+#include <iostream>
+#include <cstdlib>
+
+namespace
+{
+int count(const QSqlDatabase& database, const QString& table)
+{
+  QSqlQuery query(QString("SELECT COUNT(*) FROM ") + table, database);
+  return query.next() ? query.value(0).toInt() : -1;
+}
+
+int value(const QSqlDatabase& database, const QString& statement)
+{
+  QSqlQuery query(statement, database);
+  return query.next() ? query.value(0).toInt() : -1;
+}
+}
+
+int ctkDICOMDatabaseWriterTest1(int argc, char * argv []) {
+
+  QApplication app(argc, argv);
+  QTextStream out(stdout);
+  ctkDICOM myCTK;
+  try
+  {
+    myCTK.openDatabase( argv[1] );
+  }
+  catch (std::exception e)
+  {
+    out << "ERROR: " << e.what();
+    return EXIT_FAILURE;
+  }
+  /// make sure it is empty and properly initialized
+  if (! myCTK.initializeDatabase() ) {
+     out << "ERROR: basic DB init failed";
+     return EXIT_FAILURE;
+  }
+
+  ctkDICOMDatabaseWriter writer(myCTK.database());
+  writer.setBatchSize(7);
+
+  // 2 patients, 4 studies, 8 series, 40 images, names with quotes
+  for (int i = 0; i < 40; ++i)
+    {
+    ctkDICOMIndexerRecord record;
+    record.PatientsName = QString("O'Brien^Patient%1").arg(i % 2);
+    record.PatientID = QString("ID'%1").arg(i % 2);
+    record.PatientsBirthDate = "19700101";
+    record.StudyInstanceUID = QString("1.2.3.%1").arg(i % 4);
+    record.StudyDescription = "Head 'n' neck";
+    record.SeriesInstanceUID = QString("1.2.3.%1.%2").arg(i % 4).arg(i % 8);
+    record.SeriesDescription = "T1 'axial'";
+    record.Modality = i % 8 < 4 ? "MR" : "CT";
+    record.FileSize = 100;
+    record.Filename = QString("/tmp/images/%1.dcm").arg(i);
+    if (!writer.insert(record))
+      {
+      out << "ERROR: insert failed for record " << i;
+      return EXIT_FAILURE;
+      }
+    }
+  if (!writer.commit())
+    {
+    out << "ERROR: commit failed";
+    return EXIT_FAILURE;
+    }
+
+  if (count(myCTK.database(), "Patients") != 2 ||
+      count(myCTK.database(), "Studies") != 4 ||
+      count(myCTK.database(), "Series") != 8 ||
+      count(myCTK.database(), "Images") != 40)
+    {
+    out << "ERROR: unexpected number of rows";
+    return EXIT_FAILURE;
+    }
+
+  // 5 images per series, 2 series per study
+  if (value(myCTK.database(), "SELECT InstanceCount FROM Series WHERE SeriesInstanceUID = '1.2.3.0.0'") != 5 ||
+      value(myCTK.database(), "SELECT TotalBytes FROM Series WHERE SeriesInstanceUID = '1.2.3.0.0'") != 500 ||
+      value(myCTK.database(), "SELECT InstanceCount FROM Studies WHERE StudyInstanceUID = '1.2.3.0'") != 10 ||
+      value(myCTK.database(), "SELECT SeriesCount FROM Studies WHERE StudyInstanceUID = '1.2.3.0'") != 2 ||
+      value(myCTK.database(), "SELECT COUNT(*) FROM Studies WHERE Modalities = 'CT\\MR'") != 4)
+    {
+    out << "ERROR: unexpected aggregates";
+    return EXIT_FAILURE;
+    }
+
+  QSqlQuery name("SELECT PatientsName FROM Patients WHERE PatientID = 'ID''1'", myCTK.database());
+  if (!name.next() || name.value(0).toString() != "O'Brien^Patient1")
+    {
+    out << "ERROR: patient name with a quote was not stored properly";
+    return EXIT_FAILURE;
+    }
+
+  // each new patient, study and series is looked up once in the database
+  if (writer.cacheMisses() != 2 + 4 + 8 || writer.cacheHits() != 3 * 40 - (2 + 4 + 8))
+    {
+    out << "ERROR: unexpected cache statistics";
+    return EXIT_FAILURE;
+    }
+  // at least one insert per image
+  if (writer.statementCount() < 40 || writer.statementMsecs() < 0.)
+    {
+    out << "ERROR: unexpected statement statistics";
+    return EXIT_FAILURE;
+    }
+
+  // a cache too small for the database must fall back on the database
+  ctkDICOMDatabaseWriter smallCacheWriter(myCTK.database());
+  smallCacheWriter.setCacheSize(1);
+  for (int i = 0; i < 8; ++i)
+    {
+    ctkDICOMIndexerRecord record;
+    record.PatientsName = QString("O'Brien^Patient%1").arg(i % 2);
+    record.PatientID = QString("ID'%1").arg(i % 2);
+    record.PatientsBirthDate = "19700101";
+    record.StudyInstanceUID = QString("1.2.3.%1").arg(i % 4);
+    record.SeriesInstanceUID = QString("1.2.3.%1.%2").arg(i % 4).arg(i % 8);
+    if (!smallCacheWriter.insert(record))
+      {
+      out << "ERROR: insert failed with a small cache";
+      return EXIT_FAILURE;
+      }
+    }
+  smallCacheWriter.commit();
+  if (smallCacheWriter.cacheMisses() == 0 ||
+      count(myCTK.database(), "Patients") != 2 ||
+      count(myCTK.database(), "Studies") != 4 ||
+      count(myCTK.database(), "Series") != 8)
+    {
+    out << "ERROR: duplicated rows with a small cache";
+    return EXIT_FAILURE;
+    }
+
+  // rows inserted by another writer of the connection are not duplicated
+  ctkDICOMIndexerRecord other;
+  other.PatientsName = "Other^Patient";
+  other.PatientID = "OTHER";
+  other.StudyInstanceUID = "1.2.3.9";
+  other.SeriesInstanceUID = "1.2.3.9.0";
+  if (!smallCacheWriter.insert(other) || !smallCacheWriter.commit() ||
+      !writer.insert(other) || !writer.commit() ||
+      count(myCTK.database(), "Patients") != 3 ||
+      count(myCTK.database(), "Studies") != 5 ||
+      count(myCTK.database(), "Series") != 9)
+    {
+    out << "ERROR: duplicated rows inserted by another writer";
+    return EXIT_FAILURE;
+    }
+
+  // removed files and directories
+  if (!writer.removeImage("/tmp/images/0.dcm") ||
+      !writer.setDirectoryModificationTime("/tmp/images", 1000) ||
+      !writer.setDirectoryModificationTime("/tmp/images/sub", 1000) ||
+      !writer.setDirectoryModificationTime("/tmp/images2", 1000) ||
+      !writer.commit() ||
+      count(myCTK.database(), "Images") != 39)
+    {
+    out << "ERROR: image could not be removed";
+    return EXIT_FAILURE;
+    }
+  if (value(myCTK.database(), "SELECT InstanceCount FROM Series WHERE SeriesInstanceUID = '1.2.3.0.0'") != 4 ||
+      value(myCTK.database(), "SELECT TotalBytes FROM Studies WHERE StudyInstanceUID = '1.2.3.0'") != 900)
+    {
+    out << "ERROR: aggregates not updated by the removal of an image";
+    return EXIT_FAILURE;
+    }
+  if (!writer.removeDirectory("/tmp/images") ||
+      !writer.commit() ||
+      count(myCTK.database(), "Images") != 0 ||
+      count(myCTK.database(), "DirectoryJournal") != 1)
+    {
+    out << "ERROR: directory could not be removed";
+    return EXIT_FAILURE;
+    }
+  if (value(myCTK.database(), "SELECT SUM(InstanceCount) FROM Studies") != 0)
+    {
+    out << "ERROR: aggregates not updated by the removal of a directory";
+    return EXIT_FAILURE;
+    }
+
+  // broken aggregates are repaired
+  QSqlQuery("UPDATE Series SET InstanceCount = 12", myCTK.database());
+  if (!writer.refreshAggregates() ||
+      value(myCTK.database(), "SELECT SUM(InstanceCount) FROM Series") != 0)
+    {
+    out << "ERROR: aggregates not repaired";
+    return EXIT_FAILURE;
+    }
+
+  myCTK.closeDatabase();
+  return EXIT_SUCCESS;
+}
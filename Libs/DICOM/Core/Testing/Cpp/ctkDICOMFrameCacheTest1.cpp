@@ -0,0 +1,173 @@
+// Qt includes
+#include <QApplication>
+#include <QDir>
+#include <QTextStream>
+#include <QTime>
+#include <QVector>
+
+// ctkDICOMCore includes
+#include "ctkDICOMFrameCache.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcfilefo.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/dcmdata/dcrleerg.h>
+#include <dcmtk/dcmdata/dcuid.h>
+
+// STD includes
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+/// 4 x 3 unsigned 16 bits frame, pixel i is 100 * value + i
+bool writeFile(const QString& fileName, int value, E_TransferSyntax syntax)
+{
+  DcmFileFormat fileformat;
+  DcmDataset* dataset = fileformat.getDataset();
+  dataset->putAndInsertString(DCM_SOPClassUID, UID_CTImageStorage);
+  dataset->putAndInsertString(DCM_SOPInstanceUID,
+    QString("1.2.3.5.%1").arg(value).toLatin1().constData());
+  dataset->putAndInsertString(DCM_PhotometricInterpretation, "MONOCHROME2");
+  dataset->putAndInsertUint16(DCM_Rows, 3);
+  dataset->putAndInsertUint16(DCM_Columns, 4);
+  dataset->putAndInsertUint16(DCM_SamplesPerPixel, 1);
+  dataset->putAndInsertUint16(DCM_BitsAllocated, 16);
+  dataset->putAndInsertUint16(DCM_BitsStored, 16);
+  dataset->putAndInsertUint16(DCM_HighBit, 15);
+  dataset->putAndInsertUint16(DCM_PixelRepresentation, 0);
+  QVector<Uint16> pixels(12);
+  for (int i = 0; i < pixels.size(); ++i)
+    {
+    pixels[i] = static_cast<Uint16>(100 * value + i);
+    }
+  dataset->putAndInsertUint16Array(DCM_PixelData, pixels.data(), pixels.size());
+  if (!dataset->chooseRepresentation(syntax, NULL).good())
+    {
+    return false;
+    }
+  return fileformat.saveFile(fileName.toLocal8Bit().constData(), syntax).good();
+}
+
+bool checkFrame(const ctkDICOMFrame& frame, int value)
+{
+  Uint16 pixel = 0;
+  if (frame.isNull() || frame.Rows != 3 || frame.Columns != 4 ||
+      frame.BitsAllocated != 16 || frame.Signed || frame.Pixels.size() != 24)
+    {
+    return false;
+    }
+  std::memcpy(&pixel, frame.Pixels.constData() + 2 * 5, sizeof(pixel));
+  return pixel == 100 * value + 5;
+}
+}
+
+int ctkDICOMFrameCacheTest1(int argc, char * argv []) {
+
+  QApplication app(argc, argv);
+  QTextStream out(stdout);
+  if (argc < 2)
+    {
+    out << "ERROR: missing working directory argument";
+    return EXIT_FAILURE;
+    }
+  QDir workingDir(argv[1]);
+  workingDir.mkpath(".");
+
+  // the odd frames are RLE compressed
+  DcmRLEEncoderRegistration::registerCodecs();
+  QStringList files;
+  for (int i = 0; i < 8; ++i)
+    {
+    files << workingDir.filePath(QString("frame%1.dcm").arg(i));
+    if (!writeFile(files.last(), i, i % 2 ? EXS_RLELossless : EXS_LittleEndianExplicit))
+      {
+      out << "ERROR: could not write " << files.last();
+      return EXIT_FAILURE;
+      }
+    }
+  DcmRLEEncoderRegistration::cleanup();
+
+  QString error;
+  if (!checkFrame(ctkDICOMFrameCache::decode(files[1], 0, &error), 1))
+    {
+    out << "ERROR: RLE frame not decoded: " << error;
+    return EXIT_FAILURE;
+    }
+  if (!ctkDICOMFrameCache::decode(files[1], 1, &error).isNull() || error.isEmpty())
+    {
+    out << "ERROR: decoded a missing frame";
+    return EXIT_FAILURE;
+    }
+
+  ctkDICOMFrameCache cache;
+  cache.setNumberOfThreads(2);
+  cache.setPrefetchRadius(2);
+  cache.setFrames(files);
+  if (cache.frameCount() != 8 || !checkFrame(cache.frame(3), 3) ||
+      !checkFrame(cache.frame(3), 3) || cache.hits() != 1 || cache.misses() != 1 ||
+      cache.hitRate() != 0.5 || cache.decodedFrames() != 1 ||
+      cache.residentBytes() != 1024)
+    {
+    out << "ERROR: unexpected statistics of frame()";
+    return EXIT_FAILURE;
+    }
+
+  // the frames 1 to 5 are prefetched around 3
+  cache.setCurrentFrame(3);
+  QTime time;
+  time.start();
+  while ((!cache.isCached(1) || !cache.isCached(5) || cache.decodedFrames() < 5) &&
+         time.elapsed() < 10000)
+    {
+    app.processEvents();
+    }
+  if (cache.decodedFrames() != 5 || cache.isCached(0) || cache.isCached(6))
+    {
+    out << "ERROR: frames not prefetched around the current one";
+    return EXIT_FAILURE;
+    }
+  for (int k = 1; k < 6; ++k)
+    {
+    if (!checkFrame(cache.frame(k), k))
+      {
+      out << "ERROR: unexpected prefetched frame " << k;
+      return EXIT_FAILURE;
+      }
+    }
+  if (cache.hits() != 6 || cache.misses() != 1)
+    {
+    out << "ERROR: prefetched frames not hit";
+    return EXIT_FAILURE;
+    }
+
+  // the least recently used frames are evicted
+  cache.setPrefetchRadius(0);
+  cache.setMemoryBudget(2 * 1024);
+  if (cache.residentBytes() > 2 * 1024 || !cache.isCached(5) ||
+      !cache.isCached(4) || cache.isCached(1))
+    {
+    out << "ERROR: memory budget not respected";
+    return EXIT_FAILURE;
+    }
+  cache.frame(7);
+  if (cache.isCached(4) || !cache.isCached(5) || !cache.isCached(7))
+    {
+    out << "ERROR: unexpected evicted frames";
+    return EXIT_FAILURE;
+    }
+
+  cache.setFrames(QStringList());
+  if (cache.frameCount() != 0 || cache.residentBytes() != 0 ||
+      !cache.frame(0).isNull() || cache.hits() != 0)
+    {
+    out << "ERROR: cache not cleared";
+    return EXIT_FAILURE;
+    }
+  return EXIT_SUCCESS;
+}
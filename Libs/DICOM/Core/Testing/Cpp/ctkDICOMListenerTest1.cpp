@@ -0,0 +1,185 @@
+// Qt includes
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QProcess>
+#include <QSqlQuery>
+#include <QTextStream>
+#include <QTime>
+#include <QVariant>
+
+// ctkDICOMCore includes
+#include "ctkDICOM.h"
+#include "ctkDICOMListener.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcfilefo.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/dcmdata/dcuid.h>
+
+// STD includes
+#include <iostream>
+#include <cstdlib>
+
+namespace
+{
+const int Port = 11117;
+
+/// Instance i of the series, series are 1.2.3.<series>
+bool writeFile(const QString& fileName, int series, int i)
+{
+  DcmFileFormat fileformat;
+  DcmDataset* dataset = fileformat.getDataset();
+  dataset->putAndInsertString(DCM_SOPClassUID, UID_CTImageStorage);
+  dataset->putAndInsertString(DCM_SOPInstanceUID,
+    QString("1.2.3.%1.%2").arg(series).arg(i).toLatin1().constData());
+  dataset->putAndInsertString(DCM_PatientsName, "Listener^Test");
+  dataset->putAndInsertString(DCM_PatientID, "LISTEN");
+  dataset->putAndInsertString(DCM_StudyInstanceUID, "1.2.3");
+  dataset->putAndInsertString(DCM_SeriesInstanceUID,
+    QString("1.2.3.%1").arg(series).toLatin1().constData());
+  dataset->putAndInsertString(DCM_InstanceNumber,
+    QString::number(i + 1).toLatin1().constData());
+  dataset->putAndInsertString(DCM_Modality, "CT");
+  return fileformat.saveFile(fileName.toLocal8Bit().constData(),
+                             EXS_LittleEndianExplicit).good();
+}
+
+QStringList storescuArguments(const QString& calledAETitle, const QStringList& files)
+{
+  return QStringList() << "-aet" << "LISTENERTEST" << "-aec" << calledAETitle
+                       << "localhost" << QString::number(Port) << files;
+}
+}
+
+int ctkDICOMListenerTest1(int argc, char * argv []) {
+
+  QApplication app(argc, argv);
+  QTextStream out(stdout);
+  if (argc < 2)
+    {
+    out << "ERROR: missing working directory argument";
+    return EXIT_FAILURE;
+    }
+  QDir workingDir(argv[1]);
+  workingDir.mkpath(".");
+  const QString storage = workingDir.absoluteFilePath("storage");
+
+  ctkDICOM myCTK;
+  try
+  {
+    myCTK.openDatabase( workingDir.filePath("dicom-listener.db") );
+  }
+  catch (std::exception e)
+  {
+    out << "ERROR: " << e.what();
+    return EXIT_FAILURE;
+  }
+  if (! myCTK.initializeDatabase() ) {
+     out << "ERROR: basic DB init failed";
+     return EXIT_FAILURE;
+  }
+
+  ctkDICOMListener listener;
+  listener.setPort(Port);
+  listener.setMaximumAssociations(4);
+  listener.setDatabase(myCTK.database());
+  if (listener.start() || listener.isListening())
+    {
+    out << "ERROR: listening without storage directory";
+    return EXIT_FAILURE;
+    }
+  listener.setStorageDirectory(storage);
+  if (!listener.start() || !listener.isListening() || listener.start())
+    {
+    out << "ERROR: listener not started once";
+    return EXIT_FAILURE;
+    }
+
+  if (argc < 3 || !QFile::exists(argv[2]))
+    {
+    out << "storescu not found, the transfers are not tested\n";
+    listener.stop();
+    return listener.isListening() ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+  const QString storescu = argv[2];
+
+  // 3 senders of 4 instances at the same time
+  QList<QProcess*> senders;
+  for (int series = 0; series < 3; ++series)
+    {
+    QStringList files;
+    for (int i = 0; i < 4; ++i)
+      {
+      files << workingDir.filePath(QString("sent%1-%2.dcm").arg(series).arg(i));
+      if (!writeFile(files.last(), series, i))
+        {
+        out << "ERROR: could not write " << files.last();
+        return EXIT_FAILURE;
+        }
+      }
+    senders << new QProcess(&app);
+    senders.last()->start(storescu, storescuArguments(listener.AETitle(), files));
+    }
+  // an unknown called AE is rejected
+  QProcess rejected;
+  rejected.start(storescu, storescuArguments("UNKNOWN", QStringList() <<
+                                             workingDir.filePath("sent0-0.dcm")));
+
+  QTime time;
+  time.start();
+  bool running = true;
+  while ((running || listener.statistics().InstancesReceived < 12) &&
+         time.elapsed() < 60000)
+    {
+    app.processEvents();
+    running = rejected.state() != QProcess::NotRunning;
+    foreach(QProcess* sender, senders)
+      {
+      running = running || sender->state() != QProcess::NotRunning;
+      }
+    }
+  foreach(QProcess* sender, senders)
+    {
+    if (sender->exitStatus() != QProcess::NormalExit || sender->exitCode() != 0)
+      {
+      out << "ERROR: storescu failed: " << sender->readAllStandardError();
+      return EXIT_FAILURE;
+      }
+    }
+  if (rejected.exitCode() == 0)
+    {
+    out << "ERROR: unknown called AE title accepted";
+    return EXIT_FAILURE;
+    }
+
+  listener.stop();
+  const ctkDICOMListener::Statistics statistics = listener.statistics();
+  if (listener.isListening() || statistics.Associations != 3 ||
+      statistics.RejectedAssociations != 1 || statistics.ActiveAssociations != 0 ||
+      statistics.PeakAssociations < 1 || statistics.InstancesReceived != 12 ||
+      statistics.InstancesFailed != 0 || statistics.BytesReceived <= 0)
+    {
+    out << "ERROR: unexpected statistics";
+    return EXIT_FAILURE;
+    }
+  if (!QFile::exists(storage + "/1.2.3/1.2.3.2/1.2.3.2.3.dcm"))
+    {
+    out << "ERROR: instance not stored";
+    return EXIT_FAILURE;
+    }
+  QSqlQuery images("SELECT COUNT(*) FROM Images WHERE Filename LIKE '" + storage + "/%'",
+                   myCTK.database());
+  if (!images.next() || images.value(0).toInt() != 12)
+    {
+    out << "ERROR: received instances not indexed";
+    return EXIT_FAILURE;
+    }
+
+  myCTK.closeDatabase();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+
+// Qt includes
+#include <QApplication>
+#include <QSqlQuery>
+#include <QTextStream>
+
+// ctkDICOMCore includes
+#include "ctkDICOM.h"
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMSearch.h"
+
+// STD includes
+#include <iostream>
+#include <cstdlib>
+
+namespace
+{
+bool checkSearch(const ctkDICOMSearch& search, QTextStream& out)
+{
+  if (!search.search("zzz").isEmpty() || !search.search("").isEmpty())
+    {
+    out << "ERROR: unexpected matches";
+    return false;
+    }
+  // a prefix of the name, the patient is matched with its ID
+  QList<ctkDICOMSearchMatch> matches = search.search("smi");
+  if (matches.size() != 1 ||
+      matches[0].Level != ctkDICOMSearch::PatientLevel ||
+      matches[0].Text != "Smith^John PAT1")
+    {
+    out << "ERROR: patient not found by name prefix";
+    return false;
+    }
+  // all the words are required, in any order and case
+  matches = search.search("CT head");
+  if (matches.size() != 1 ||
+      matches[0].Level != ctkDICOMSearch::StudyLevel ||
+      matches[0].StudyInstanceUID != "1.2.3.1" ||
+      matches[0].PatientUID.isEmpty())
+    {
+    out << "ERROR: study not found by description and modality";
+    return false;
+    }
+  // exact words rank before prefixes
+  matches = search.search("ax");
+  if (matches.size() != 2 ||
+      matches[0].Level != ctkDICOMSearch::SeriesLevel ||
+      matches[0].Text != "Ax T1 HEAD")
+    {
+    out << "ERROR: unexpected ranking of series";
+    return false;
+    }
+  if (matches[0].StudyInstanceUID.isEmpty() || matches[0].PatientUID.isEmpty())
+    {
+    out << "ERROR: ancestors of the series are missing";
+    return false;
+    }
+  if (search.search("a", 1).size() != 1)
+    {
+    out << "ERROR: maximum number of matches not respected";
+    return false;
+    }
+  return true;
+}
+}
+
+int ctkDICOMSearchTest1(int argc, char * argv []) {
+
+  QApplication app(argc, argv);
+  QTextStream out(stdout);
+  ctkDICOM myCTK;
+  try
+  {
+    myCTK.openDatabase( argv[1] );
+  }
+  catch (std::exception e)
+  {
+    out << "ERROR: " << e.what();
+    return EXIT_FAILURE;
+  }
+  if (! myCTK.initializeDatabase() ) {
+     out << "ERROR: basic DB init failed";
+     return EXIT_FAILURE;
+  }
+
+  {
+  ctkDICOMDatabaseWriter writer(myCTK.database());
+  const char* series[] = {"Ax T1 HEAD", "Axial T2 brain", "Cor T1", "Sag T2"};
+  for (int i = 0; i < 4; ++i)
+    {
+    ctkDICOMIndexerRecord record;
+    record.PatientsName = i < 2 ? "Smith^John" : "Doe^Jane";
+    record.PatientID = i < 2 ? "PAT1" : "PAT2";
+    record.StudyInstanceUID = QString("1.2.3.%1").arg(i / 2);
+    record.StudyDescription = i < 2 ? "Head" : "Knee";
+    record.ModalitiesInStudy = i < 2 ? "MR" : "CT";
+    record.Modality = i == 3 ? "US" : "MR";
+    record.AccessionNumber = QString("ACC%1").arg(i / 2);
+    record.SeriesInstanceUID = QString("1.2.3.%1.%2").arg(i / 2).arg(i);
+    record.SeriesDescription = series[i];
+    record.Filename = QString("/tmp/search/%1.dcm").arg(i);
+    if (!writer.insert(record))
+      {
+      out << "ERROR: insert failed";
+      return EXIT_FAILURE;
+      }
+    }
+  }
+  // the modalities of the series are indexed with their study
+  QList<ctkDICOMSearchMatch> modalityMatches = ctkDICOMSearch(myCTK.database()).search("us");
+  if (ctkDICOMSearch(myCTK.database()).isIndexed() &&
+      (modalityMatches.size() != 1 ||
+       modalityMatches[0].StudyInstanceUID != "1.2.3.1"))
+    {
+    out << "ERROR: study not found by the modality of its series";
+    return EXIT_FAILURE;
+    }
+  // the second study is a CT of the head, changed behind the writer
+  QSqlQuery update(myCTK.database());
+  update.exec("UPDATE Studies SET StudyDescription = 'Head', ModalitiesInStudy = 'CT' "
+              "WHERE StudyInstanceUID = '1.2.3.1'");
+  update.exec("UPDATE Studies SET StudyDescription = 'Brain' "
+              "WHERE StudyInstanceUID = '1.2.3.0'");
+
+  ctkDICOMSearch search(myCTK.database());
+  if (!search.rebuild() || !checkSearch(search, out))
+    {
+    return EXIT_FAILURE;
+    }
+
+  // without full-text table, the tables are scanned
+  if (search.isIndexed())
+    {
+    update.exec("DROP TABLE SearchIndex");
+    if (search.isIndexed() || !checkSearch(search, out))
+      {
+      out << " (without index)";
+      return EXIT_FAILURE;
+      }
+    }
+
+  myCTK.closeDatabase();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,172 @@
+// Qt includes
+#include <QApplication>
+#include <QDir>
+#include <QTextStream>
+#include <QVector>
+
+// ctkDICOMCore includes
+#include "ctkDICOM.h"
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMSeriesLoader.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcfilefo.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/dcmdata/dcuid.h>
+
+// STD includes
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+/// 4 x 3 signed 16 bits frames at z = position, pixel i of frame f is
+/// 100 * (position + f) + i
+bool writeFile(const QString& fileName, int position, int frames)
+{
+  DcmFileFormat fileformat;
+  DcmDataset* dataset = fileformat.getDataset();
+  dataset->putAndInsertString(DCM_SOPClassUID, UID_CTImageStorage);
+  dataset->putAndInsertString(DCM_SOPInstanceUID,
+    QString("1.2.3.4.%1").arg(position).toLatin1().constData());
+  dataset->putAndInsertString(DCM_SeriesInstanceUID, "1.2.3.4");
+  dataset->putAndInsertString(DCM_PhotometricInterpretation, "MONOCHROME2");
+  dataset->putAndInsertUint16(DCM_Rows, 3);
+  dataset->putAndInsertUint16(DCM_Columns, 4);
+  dataset->putAndInsertUint16(DCM_SamplesPerPixel, 1);
+  dataset->putAndInsertUint16(DCM_BitsAllocated, 16);
+  dataset->putAndInsertUint16(DCM_BitsStored, 16);
+  dataset->putAndInsertUint16(DCM_HighBit, 15);
+  dataset->putAndInsertUint16(DCM_PixelRepresentation, 1);
+  dataset->putAndInsertString(DCM_NumberOfFrames, QString::number(frames).toLatin1().constData());
+  dataset->putAndInsertString(DCM_ImagePositionPatient,
+    QString("10\\20\\%1").arg(position).toLatin1().constData());
+  dataset->putAndInsertString(DCM_ImageOrientationPatient, "1\\0\\0\\0\\1\\0");
+  dataset->putAndInsertString(DCM_PixelSpacing, "0.5\\0.25");
+  dataset->putAndInsertString(DCM_SpacingBetweenSlices, "1");
+  QVector<Uint16> pixels(12 * frames);
+  for (int i = 0; i < pixels.size(); ++i)
+    {
+    pixels[i] = static_cast<Uint16>(100 * (position + i / 12) + i % 12);
+    }
+  dataset->putAndInsertUint16Array(DCM_PixelData, pixels.data(), pixels.size());
+  return fileformat.saveFile(fileName.toLocal8Bit().constData(),
+                             EXS_LittleEndianExplicit).good();
+}
+
+short pixel(const ctkDICOMSeriesLoader& loader, int i, int j, int k)
+{
+  short value;
+  std::memcpy(&value, loader.voxel(i, j, k), sizeof(value));
+  return value;
+}
+}
+
+int ctkDICOMSeriesLoaderTest1(int argc, char * argv []) {
+
+  QApplication app(argc, argv);
+  QTextStream out(stdout);
+  if (argc < 2)
+    {
+    out << "ERROR: missing working directory argument";
+    return EXIT_FAILURE;
+    }
+  QDir workingDir(argv[1]);
+  workingDir.mkpath(".");
+
+  ctkDICOM myCTK;
+  try
+  {
+    myCTK.openDatabase( workingDir.filePath("dicom-loader.db") );
+  }
+  catch (std::exception e)
+  {
+    out << "ERROR: " << e.what();
+    return EXIT_FAILURE;
+  }
+  if (! myCTK.initializeDatabase() ) {
+     out << "ERROR: basic DB init failed";
+     return EXIT_FAILURE;
+  }
+
+  // the files are listed in the reverse order of their positions
+  {
+  ctkDICOMDatabaseWriter writer(myCTK.database());
+  for (int i = 0; i < 3; ++i)
+    {
+    ctkDICOMIndexerRecord record;
+    record.Filename = workingDir.filePath(QString("slice%1.dcm").arg(i));
+    record.PatientsName = "Loader^Test";
+    record.StudyInstanceUID = "1.2.3";
+    record.SeriesInstanceUID = "1.2.3.4";
+    if (!writeFile(record.Filename, 2 - i, 1) || !writer.insert(record))
+      {
+      out << "ERROR: could not write " << record.Filename;
+      return EXIT_FAILURE;
+      }
+    }
+  }
+
+  ctkDICOMSeriesLoader loader(myCTK.database());
+  loader.setNumberOfThreads(2);
+  if (!loader.load("1.2.3.4"))
+    {
+    out << "ERROR: series not loaded: " << loader.lastError();
+    return EXIT_FAILURE;
+    }
+  double origin[3];
+  double spacing[3];
+  loader.origin(origin);
+  loader.spacing(spacing);
+  if (loader.columns() != 4 || loader.rows() != 3 || loader.slices() != 3 ||
+      loader.bitsAllocated() != 16 || !loader.isSigned() ||
+      loader.pixelStride() != 2 || loader.rowStride() != 8 ||
+      origin[0] != 10. || origin[2] != 0. ||
+      spacing[0] != 0.25 || spacing[1] != 0.5 || spacing[2] != 1.)
+    {
+    out << "ERROR: unexpected volume geometry";
+    return EXIT_FAILURE;
+    }
+  for (int k = 0; k < 3; ++k)
+    {
+    if (pixel(loader, 1, 2, k) != 100 * k + 9 ||
+        loader.filename(k) != workingDir.filePath(QString("slice%1.dcm").arg(2 - k)))
+      {
+      out << "ERROR: slices not sorted by position";
+      return EXIT_FAILURE;
+      }
+    }
+  QVector<short> volume(4 * 3 * 3);
+  loader.copyTo(reinterpret_cast<uchar*>(volume.data()));
+  if (volume[12 * 2 + 5] != 205)
+    {
+    out << "ERROR: unexpected copied volume";
+    return EXIT_FAILURE;
+    }
+
+  // the frames of a multi-frame file are contiguous
+  const QString multiFrame = workingDir.filePath("multiframe.dcm");
+  if (!writeFile(multiFrame, 0, 5) ||
+      !loader.loadFiles(QStringList() << multiFrame) ||
+      loader.slices() != 5 || !loader.data() ||
+      pixel(loader, 3, 2, 4) != 411)
+    {
+    out << "ERROR: multi-frame file not loaded: " << loader.lastError();
+    return EXIT_FAILURE;
+    }
+
+  if (loader.load("9.9.9") || loader.isLoaded())
+    {
+    out << "ERROR: unknown series loaded";
+    return EXIT_FAILURE;
+    }
+
+  myCTK.closeDatabase();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,176 @@
+// Qt includes
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QSqlQuery>
+#include <QTextStream>
+#include <QVariant>
+
+// ctkDICOMCore includes
+#include "ctkDICOM.h"
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMSnapshot.h"
+
+// STD includes
+#include <iostream>
+#include <cstdlib>
+
+namespace
+{
+int count(const QSqlDatabase& database, const QString& table)
+{
+  QSqlQuery query("SELECT COUNT(*) FROM " + table, database);
+  return query.next() ? query.value(0).toInt() : -1;
+}
+}
+
+int ctkDICOMSnapshotTest1(int argc, char * argv []) {
+
+  QApplication app(argc, argv);
+  QTextStream out(stdout);
+  if (argc < 2)
+    {
+    out << "ERROR: missing working directory argument";
+    return EXIT_FAILURE;
+    }
+  QDir workingDir(argv[1]);
+  workingDir.mkpath(".");
+  const QString snapshotFile = workingDir.filePath("dicom.snapshot");
+
+  ctkDICOM myCTK;
+  try
+  {
+    myCTK.openDatabase( workingDir.filePath("dicom-snapshot.db") );
+  }
+  catch (std::exception e)
+  {
+    out << "ERROR: " << e.what();
+    return EXIT_FAILURE;
+  }
+  if (! myCTK.initializeDatabase() ) {
+     out << "ERROR: basic DB init failed";
+     return EXIT_FAILURE;
+  }
+
+  // 1 patient, 2 series of 3 images
+  {
+  ctkDICOMDatabaseWriter writer(myCTK.database());
+  for (int i = 0; i < 6; ++i)
+    {
+    ctkDICOMIndexerRecord record;
+    record.PatientsName = "Snapshot^Test";
+    record.PatientID = "SNAP";
+    record.StudyInstanceUID = "1.2.3";
+    record.StudyDescription = "Head";
+    record.SeriesInstanceUID = QString("1.2.3.%1").arg(i / 3);
+    record.Modality = "CT";
+    record.FileSize = 1000 + i;
+    record.Filename = QString("/tmp/snapshot/%1.dcm").arg(i);
+    if (!writer.insert(record))
+      {
+      out << "ERROR: insert failed";
+      return EXIT_FAILURE;
+      }
+    }
+  }
+
+  QSqlQuery update(myCTK.database());
+  update.exec("UPDATE Patients SET PatientsBirthTime = NULL");
+
+  if (!myCTK.exportSnapshot(snapshotFile))
+    {
+    out << "ERROR: export failed: " << myCTK.GetLastError();
+    return EXIT_FAILURE;
+    }
+
+  ctkDICOMSnapshot snapshot;
+  if (!snapshot.open(snapshotFile) ||
+      snapshot.tables() != ctkDICOMSnapshot::defaultTables())
+    {
+    out << "ERROR: snapshot not opened: " << snapshot.lastError();
+    return EXIT_FAILURE;
+    }
+  const int images = snapshot.table("Images");
+  const int filename = snapshot.column(images, "Filename");
+  const int fileSize = snapshot.column(images, "FileSize");
+  const int seriesUID = snapshot.column(images, "SeriesInstanceUID");
+  if (snapshot.rowCount(images) != 6 || filename < 0 || fileSize < 0 || seriesUID < 0 ||
+      snapshot.columnType(images, fileSize) != ctkDICOMSnapshot::IntegerColumn ||
+      snapshot.columnType(images, filename) != ctkDICOMSnapshot::StringColumn)
+    {
+    out << "ERROR: unexpected Images table";
+    return EXIT_FAILURE;
+    }
+  for (int row = 0; row < 6; ++row)
+    {
+    if (snapshot.value(images, filename, row).toString() !=
+          QString("/tmp/snapshot/%1.dcm").arg(row) ||
+        snapshot.integers(images, fileSize)[row] != 1000 + row)
+      {
+      out << "ERROR: unexpected image " << row;
+      return EXIT_FAILURE;
+      }
+    }
+  // the UIDs are stored once
+  const quint32* seriesIds = snapshot.stringIds(images, seriesUID);
+  if (!seriesIds || seriesIds[0] != seriesIds[2] || seriesIds[0] == seriesIds[3] ||
+      snapshot.string(seriesIds[3]) != "1.2.3.1" || snapshot.reals(images, seriesUID))
+    {
+    out << "ERROR: strings are not dictionary encoded";
+    return EXIT_FAILURE;
+    }
+  const int patients = snapshot.table("Patients");
+  const int birthTime = snapshot.column(patients, "PatientsBirthTime");
+  if (snapshot.rowCount(patients) != 1 || birthTime < 0 ||
+      !snapshot.isNull(patients, birthTime, 0) ||
+      !snapshot.value(patients, birthTime, 0).isNull())
+    {
+    out << "ERROR: NULL not preserved";
+    return EXIT_FAILURE;
+    }
+
+  // a truncated file is rejected
+  QFile::remove(workingDir.filePath("truncated.snapshot"));
+  QFile::copy(snapshotFile, workingDir.filePath("truncated.snapshot"));
+  QFile truncated(workingDir.filePath("truncated.snapshot"));
+  truncated.resize(truncated.size() - 8);
+  ctkDICOMSnapshot invalid;
+  if (invalid.open(truncated.fileName()) || invalid.isOpen() || invalid.lastError().isEmpty())
+    {
+    out << "ERROR: truncated snapshot opened";
+    return EXIT_FAILURE;
+    }
+
+  // the rows are imported in another database
+  ctkDICOM copy;
+  try
+  {
+    copy.openDatabase( workingDir.filePath("dicom-snapshot-copy.db") );
+  }
+  catch (std::exception e)
+  {
+    out << "ERROR: " << e.what();
+    return EXIT_FAILURE;
+  }
+  if (!copy.initializeDatabase() || !copy.importSnapshot(snapshotFile) ||
+      count(copy.database(), "Images") != 6 || count(copy.database(), "Series") != 2 ||
+      count(copy.database(), "Patients") != 1)
+    {
+    out << "ERROR: snapshot not imported: " << copy.GetLastError();
+    return EXIT_FAILURE;
+    }
+  QSqlQuery instances("SELECT InstanceCount, TotalBytes FROM Series "
+                      "WHERE SeriesInstanceUID = '1.2.3.1'", copy.database());
+  if (!instances.next() || instances.value(0).toInt() != 3 ||
+      instances.value(1).toLongLong() != 1003 + 1004 + 1005)
+    {
+    out << "ERROR: unexpected imported aggregates";
+    return EXIT_FAILURE;
+    }
+
+  snapshot.close();
+  copy.closeDatabase();
+  myCTK.closeDatabase();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,76 @@
+// Qt includes
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+
+// ctkDICOMCore includes
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMStorage.h"
+
+// STD includes
+#include <iostream>
+#include <cstdlib>
+
+int ctkDICOMStorageTest1(int argc, char * argv []) {
+
+  QCoreApplication app(argc, argv);
+  QTextStream out(stdout);
+  if (argc < 2)
+    {
+    out << "ERROR: missing working directory argument";
+    return EXIT_FAILURE;
+    }
+  QDir workingDir(argv[1]);
+  workingDir.mkpath("source");
+
+  const int modeCount = 4;
+  ctkDICOMStorage::Mode modes[modeCount] = {
+    ctkDICOMStorage::Copy, ctkDICOMStorage::HardLink,
+    ctkDICOMStorage::Clone, ctkDICOMStorage::Move };
+  for (int m = 0; m < modeCount; ++m)
+    {
+    ctkDICOMStorage storage(workingDir.filePath(QString("storage%1").arg(m)));
+    storage.setMode(modes[m]);
+    storage.setMaxConcurrentTransfers(2);
+
+    QStringList destinations;
+    for (int i = 0; i < 10; ++i)
+      {
+      ctkDICOMIndexerRecord record;
+      record.Filename = workingDir.filePath(QString("source/%1-%2").arg(m).arg(i));
+      QFile source(record.Filename);
+      if (!source.open(QIODevice::WriteOnly) ||
+          source.write(QByteArray(1000 + i, 'x')) != 1000 + i)
+        {
+        out << "ERROR: could not write " << record.Filename;
+        return EXIT_FAILURE;
+        }
+      source.close();
+      record.StudyInstanceUID = "1.2.3";
+      record.SeriesInstanceUID = QString("1.2.3.%1").arg(i % 2);
+      // same InstanceNumber in both series, the instances must not collide
+      record.InstanceNumber = QString::number(i / 2);
+      if (i != 9)
+        {
+        record.SOPInstanceUID = QString("1.2.3.4.%1").arg(i);
+        }
+      destinations << storage.store(record);
+      }
+    if (!storage.waitForDone().isEmpty())
+      {
+      out << "ERROR: transfers failed in mode " << m;
+      return EXIT_FAILURE;
+      }
+    for (int i = 0; i < destinations.size(); ++i)
+      {
+      if (destinations.indexOf(destinations[i]) != i ||
+          QFile(destinations[i]).size() != 1000 + i)
+        {
+        out << "ERROR: wrong destination " << destinations[i] << " in mode " << m;
+        return EXIT_FAILURE;
+        }
+      }
+    }
+  return EXIT_SUCCESS;
+}
@@ -24,6 +24,10 @@ int ctkDICOMTest1(int argc, char * argv []) {
        out << "ERROR: basic DB init failed";
        return EXIT_FAILURE;
     };
+    if ( myCTK.schemaVersion() != ctkDICOM::currentSchemaVersion() ) {
+       out << "ERROR: unexpected schema version " << myCTK.schemaVersion();
+       return EXIT_FAILURE;
+    }
     /// insert some sample data
     if (! myCTK.initializeDatabase(argv[2]) ) {
        out << "ERROR: sample DB init failed";
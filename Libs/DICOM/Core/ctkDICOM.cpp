@@ -25,20 +25,31 @@
 #include <QSqlQuery>
 #include <QFile>
 #include <QStringList>
+#include <QTextStream>
+#include <QVariant>
 
 // ctkDICOM includes
 #include "ctkDICOM.h"
+#include "ctkDICOMSearch.h"
+#include "ctkDICOMSnapshot.h"
+#include "ctkLogger.h"
 
 // STD includes
 #include <iostream>
 #include <stdexcept>
 
+static ctkLogger logger ( "org.commontk.dicom.DICOM" );
+
+/// Must match the user_version set by Resources/dicom-schema.sql
+static const int SchemaVersion = 5;
+
 //----------------------------------------------------------------------------
 class ctkDICOMPrivate: public ctkPrivate<ctkDICOM>
 {
 public:
   ctkDICOMPrivate(); 
   bool executeScript(const QString& script);
+  void applyProfile(ctkDICOM::DatabaseProfile profile);
 
   QSqlDatabase  Database;
   QString       DatabaseFileName;
@@ -68,7 +79,7 @@ ctkDICOM::~ctkDICOM()
 }
 
 //----------------------------------------------------------------------------
-void ctkDICOM::openDatabase(const QString& databaseFileName)
+void ctkDICOM::openDatabase(const QString& databaseFileName, DatabaseProfile profile)
 {
   CTK_D(ctkDICOM);
   d->Database = QSqlDatabase::addDatabase("QSQLITE","DICOM-DB");
@@ -78,10 +89,90 @@ void ctkDICOM::openDatabase(const QString& databaseFileName)
     d->LastError = d->Database.lastError().text();
     throw std::runtime_error(qPrintable(d->LastError));
     }
+  d->applyProfile(profile);
   if ( d->Database.tables().empty() ) 
     {
     initializeDatabase();
     }
+  else if ( this->schemaVersion() < ctkDICOM::currentSchemaVersion() )
+    {
+    if ( !this->updateDatabaseSchema() )
+      {
+      d->LastError = QString("Could not update the schema of ") + databaseFileName;
+      throw std::runtime_error(qPrintable(d->LastError));
+      }
+    // the migrations create the search index empty
+    if ( !ctkDICOMSearch(d->Database).rebuild() )
+      {
+      d->LastError = QString("Could not build the search index of ") + databaseFileName;
+      throw std::runtime_error(qPrintable(d->LastError));
+      }
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMPrivate::applyProfile(ctkDICOM::DatabaseProfile profile)
+{
+  if (profile != ctkDICOM::PerformanceProfile)
+    {
+    return;
+    }
+  // Unknown pragmas are ignored by older SQLite versions
+  QStringList pragmas;
+  pragmas << "PRAGMA journal_mode = WAL"
+          << "PRAGMA synchronous = NORMAL"
+          << "PRAGMA temp_store = MEMORY"
+          // in pages, 64MB with the default page size of 4096 bytes
+          << "PRAGMA cache_size = 16384"
+          << "PRAGMA mmap_size = 268435456";
+  QSqlQuery query(this->Database);
+  foreach(const QString& pragma, pragmas)
+    {
+    if (!query.exec(pragma))
+      {
+      logger.warn ( "Could not apply " + pragma + ": " + query.lastError().text() );
+      }
+    }
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOM::schemaVersion()const
+{
+  CTK_D(const ctkDICOM);
+  QSqlQuery query("PRAGMA user_version", d->Database);
+  return query.next() ? query.value(0).toInt() : 0;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOM::currentSchemaVersion()
+{
+  return SchemaVersion;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOM::updateDatabaseSchema()
+{
+  CTK_D(ctkDICOM);
+  for (int version = this->schemaVersion() + 1;
+       version <= ctkDICOM::currentSchemaVersion(); ++version)
+    {
+    logger.info ( QString("Updating database schema to version %1").arg(version) );
+    // A script and its user_version bump are applied together or not at
+    // all: a failed migration can be run again on the next opening
+    if (!d->Database.transaction())
+      {
+      logger.error ( "Could not start the schema update: " + d->Database.lastError().text() );
+      return false;
+      }
+    if (!d->executeScript(QString(":/dicom/dicom-schema-update-%1.sql").arg(version)) ||
+        !d->Database.commit())
+      {
+      d->Database.rollback();
+      logger.error ( QString("Could not update database schema to version %1").arg(version) );
+      return false;
+      }
+    }
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -135,7 +226,17 @@ bool ctkDICOMPrivate::executeScript(const QString& script) {
 bool ctkDICOM::initializeDatabase(const char* sqlFileName)
 {
   CTK_D(ctkDICOM);
-  return d->executeScript(sqlFileName);
+  if (!d->executeScript(sqlFileName))
+    {
+    return false;
+    }
+  // the script may insert rows, they are indexed with the others
+  if (!ctkDICOMSearch(d->Database).rebuild())
+    {
+    d->LastError = QString("Could not build the search index of ") + sqlFileName;
+    return false;
+    }
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -144,3 +245,32 @@ void ctkDICOM::closeDatabase()
   CTK_D(ctkDICOM);
   d->Database.close();
 }
+
+//------------------------------------------------------------------------------
+bool ctkDICOM::exportSnapshot(const QString& file)
+{
+  CTK_D(ctkDICOM);
+  return ctkDICOMSnapshot::write(d->Database, file,
+                                 ctkDICOMSnapshot::defaultTables(), &d->LastError);
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOM::importSnapshot(const QString& file)
+{
+  CTK_D(ctkDICOM);
+  ctkDICOMSnapshot snapshot;
+  if (!snapshot.open(file))
+    {
+    d->LastError = snapshot.lastError();
+    logger.error ( "Could not open the snapshot " + file + ": " + d->LastError );
+    return false;
+    }
+  if (!snapshot.restore(d->Database))
+    {
+    d->LastError = QString("Could not import ") + file;
+    return false;
+    }
+  // without full-text support, ctkDICOMSearch scans the imported tables
+  ctkDICOMSearch(d->Database).rebuild();
+  return true;
+}
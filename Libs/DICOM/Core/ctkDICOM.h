@@ -38,12 +38,24 @@ public:
   typedef QObject Superclass;
   explicit ctkDICOM(QObject* parent = 0);
   virtual ~ctkDICOM();
-  
+
+  enum DatabaseProfile
+  {
+    /// Keep the SQLite defaults
+    DefaultProfile,
+    /// Write-ahead log, relaxed synchronous mode, large page cache and
+    /// memory mapped I/O. Trades durability on power loss (not database
+    /// integrity) for much faster imports and queries on large databases.
+    PerformanceProfile
+  };
+
   ///
   /// open the SQLite database in @param file. If the file does not
   /// exist, a new database is created and initialized with the
-  /// default schema
-  virtual void openDatabase(const QString& file);
+  /// default schema. An existing database with an older schema
+  /// version is updated, see updateDatabaseSchema(). The search index
+  /// of ctkDICOMSearch is created if missing.
+  virtual void openDatabase(const QString& file, DatabaseProfile profile = DefaultProfile);
 
   const QSqlDatabase& database() const;
   const QString& GetLastError() const; 
@@ -54,6 +66,31 @@ public:
   ///
   /// delete all data and reinitialize the database.
   bool initializeDatabase(const char* schemaFile = ":/dicom/dicom-schema.sql");
+
+  ///
+  /// Version of the schema of the opened database, 0 for databases
+  /// created before the schema was versioned.
+  int schemaVersion()const;
+  ///
+  /// Version of the schema created by initializeDatabase().
+  static int currentSchemaVersion();
+  ///
+  /// Migrate the opened database to currentSchemaVersion(), one
+  /// :/dicom/dicom-schema-update-<version>.sql script at a time, each in
+  /// its own transaction. Data is kept. Return false if a script failed,
+  /// the database is then left at the version before it.
+  bool updateDatabaseSchema();
+
+  ///
+  /// Write the patients, studies, series and images of the opened
+  /// database in a columnar snapshot file, see ctkDICOMSnapshot.
+  bool exportSnapshot(const QString& file);
+  ///
+  /// Replace the patients, studies, series and images of the opened
+  /// database by the ones of a snapshot and rebuild the search index.
+  /// The caches of the ctkDICOMDatabaseWriter of the database must be
+  /// cleared.
+  bool importSnapshot(const QString& file);
 private:
   CTK_DECLARE_PRIVATE(ctkDICOM);
 };
@@ -0,0 +1,485 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QCoreApplication>
+#include <QPointer>
+
+// ctkDICOM includes
+#include "ctkDICOMAssociationPool.h"
+#include "ctkDICOMAssociationPool_p.h"
+#include "ctkLogger.h"
+
+// DCMTK includes
+#include <dcmtk/dcmdata/dcuid.h>
+#include <dcmtk/ofstd/ofstd.h>
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMAssociationPool" );
+
+namespace
+{
+//------------------------------------------------------------------------------
+const char* TransferSyntaxes[] = {
+  UID_LittleEndianExplicitTransferSyntax,
+  UID_BigEndianExplicitTransferSyntax,
+  UID_LittleEndianImplicitTransferSyntax };
+const int TransferSyntaxCount = 3;
+
+//------------------------------------------------------------------------------
+OFCondition addPresentationContexts(T_ASC_Parameters* params,
+                                    ctkDICOMAssociationPool::Service service)
+{
+  // presentation context IDs are odd numbers
+  T_ASC_PresentationContextID presID = 1;
+  OFCondition cond = ASC_addPresentationContext(params, presID,
+    UID_VerificationSOPClass, TransferSyntaxes, TransferSyntaxCount);
+  switch (service)
+    {
+    case ctkDICOMAssociationPool::FindService:
+      presID += 2;
+      cond = cond.good() ? ASC_addPresentationContext(params, presID,
+        UID_FINDStudyRootQueryRetrieveInformationModel,
+        TransferSyntaxes, TransferSyntaxCount) : cond;
+      break;
+    case ctkDICOMAssociationPool::MoveService:
+      presID += 2;
+      cond = cond.good() ? ASC_addPresentationContext(params, presID,
+        UID_MOVEStudyRootQueryRetrieveInformationModel,
+        TransferSyntaxes, TransferSyntaxCount) : cond;
+      break;
+    case ctkDICOMAssociationPool::GetService:
+      presID += 2;
+      cond = cond.good() ? ASC_addPresentationContext(params, presID,
+        UID_GETStudyRootQueryRetrieveInformationModel,
+        TransferSyntaxes, TransferSyntaxCount) : cond;
+      // The instances come back on the association: offer to be the
+      // storage SCP, within the 128 presentation contexts allowed
+      for (int i = 0; cond.good() && i < numberOfDcmLongSCUStorageSOPClassUIDs && presID < 253; ++i)
+        {
+        presID += 2;
+        cond = ASC_addPresentationContext(params, presID,
+          dcmLongSCUStorageSOPClassUIDs[i], TransferSyntaxes, TransferSyntaxCount,
+          ASC_SC_ROLE_SCP);
+        }
+      break;
+    }
+  return cond;
+}
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMAssociation methods
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociation::ctkDICOMAssociation()
+{
+  this->Timeout = 0;
+  this->Network = 0;
+  this->Association = 0;
+  this->Aborted = false;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociation::~ctkDICOMAssociation()
+{
+  if (this->Association)
+    {
+    if (this->Aborted || ASC_releaseAssociation(this->Association).bad())
+      {
+      ASC_abortAssociation(this->Association);
+      }
+    ASC_destroyAssociation(&this->Association);
+    }
+  if (this->Network)
+    {
+    ASC_dropNetwork(&this->Network);
+    }
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociation* ctkDICOMAssociation::negotiate(ctkDICOMAssociationPool::Service service,
+                                                    const QString& callingAETitle,
+                                                    const QString& calledAETitle,
+                                                    const QString& host, int port, int timeout)
+{
+  ctkDICOMAssociation* association = new ctkDICOMAssociation;
+  association->Timeout = timeout;
+  T_ASC_Parameters* params = 0;
+  OFCondition cond = ASC_initializeNetwork(NET_REQUESTOR, 0, timeout, &association->Network);
+  if (cond.good())
+    {
+    cond = ASC_createAssociationParameters(&params, ASC_DEFAULTMAXPDU);
+    }
+  if (cond.good())
+    {
+    const QString peer = host + ":" + QString::number(port);
+    ASC_setAPTitles(params, callingAETitle.toLatin1().constData(),
+                    calledAETitle.toLatin1().constData(), NULL);
+    ASC_setPresentationAddresses(params, OFStandard::getHostName().c_str(),
+                                 peer.toLatin1().constData());
+    cond = addPresentationContexts(params, service);
+    }
+  if (cond.good())
+    {
+    // the parameters belong to the association once it is created
+    cond = ASC_requestAssociation(association->Network, params, &association->Association);
+    params = 0;
+    }
+  if (cond.good() && ASC_countAcceptedPresentationContexts(association->Association->params) == 0)
+    {
+    cond = ASC_NOPRESENTATIONCONTEXTSACCEPTED;
+    }
+  if (cond.bad())
+    {
+    logger.error ( "Could not open an association to " + calledAETitle + "@" + host +
+                   ":" + QString::number(port) + ": " + cond.text() );
+    if (params)
+      {
+      ASC_destroyAssociationParameters(&params);
+      }
+    association->abort();
+    delete association;
+    return 0;
+    }
+  return association;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMAssociation::echo(int timeout)
+{
+  DIC_US status = 0;
+  DcmDataset* statusDetail = NULL;
+  OFCondition cond = DIMSE_echoUser(this->Association, this->Association->nextMsgID++,
+                                    timeout > 0 ? DIMSE_NONBLOCKING : DIMSE_BLOCKING,
+                                    timeout, &status, &statusDetail);
+  delete statusDetail;
+  return cond.good() && status == STATUS_Success;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMAssociation::isEstablished()const
+{
+  return this->Association && !this->Aborted &&
+    !ASC_dataWaiting(this->Association, 0);
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMAssociation::abort()
+{
+  this->Aborted = true;
+}
+
+//------------------------------------------------------------------------------
+T_ASC_PresentationContextID ctkDICOMAssociation::presentationContextID(const char* abstractSyntax)const
+{
+  return ASC_findAcceptedPresentationContextID(this->Association, abstractSyntax);
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMAssociationCheckTask methods
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociationCheckTask::ctkDICOMAssociationCheckTask(ctkDICOMAssociationPoolPrivate* pool)
+{
+  this->Pool = pool;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMAssociationCheckTask::run()
+{
+  this->Pool->check();
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMAssociationPoolPrivate methods
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociationPoolPrivate::ctkDICOMAssociationPoolPrivate()
+{
+  this->EchoInterval = 30;
+  this->IdleTimeout = 300;
+  this->MaximumIdleAssociations = 8;
+  this->Negotiations = 0;
+  this->Reuses = 0;
+  this->CheckPool.setMaxThreadCount(1);
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMAssociationPoolPrivate::key(ctkDICOMAssociationPool::Service service,
+                                            const QString& callingAETitle,
+                                            const QString& calledAETitle,
+                                            const QString& host, int port)
+{
+  return QString("%1 %2 %3 %4:%5").arg(service).arg(callingAETitle)
+    .arg(calledAETitle).arg(host).arg(port);
+}
+
+//------------------------------------------------------------------------------
+QList<ctkDICOMAssociation*> ctkDICOMAssociationPoolPrivate::takeIdle()
+{
+  QMutexLocker locker(&this->Mutex);
+  QList<ctkDICOMAssociation*> idle;
+  qSwap(idle, this->Idle);
+  return idle;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMAssociationPoolPrivate::check()
+{
+  int idleTimeout = 0;
+    {
+    QMutexLocker locker(&this->Mutex);
+    idleTimeout = this->IdleTimeout;
+    }
+  // The associations are out of the pool while they are checked: an
+  // acquire() meanwhile negotiates a new one rather than waiting
+  QList<ctkDICOMAssociation*> checked;
+  foreach(ctkDICOMAssociation* association, this->takeIdle())
+    {
+    if (association->Idle.elapsed() >= idleTimeout * 1000)
+      {
+      delete association;
+      }
+    else if (!association->isEstablished() ||
+             !association->echo(ctkDICOMAssociationPoolPrivate::EchoTimeout))
+      {
+      logger.debug ( "Association " + association->Key + " does not answer" );
+      association->abort();
+      delete association;
+      }
+    else
+      {
+      checked << association;
+      }
+    }
+  QMutexLocker locker(&this->Mutex);
+  this->Idle << checked;
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMAssociationPool methods
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociationPool::ctkDICOMAssociationPool(QObject* _parent)
+  : QObject(_parent)
+{
+  CTK_INIT_PRIVATE(ctkDICOMAssociationPool);
+  CTK_D(ctkDICOMAssociationPool);
+  connect(&d->EchoTimer, SIGNAL(timeout()), this, SLOT(checkAssociations()));
+  this->setEchoInterval(d->EchoInterval);
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociationPool::~ctkDICOMAssociationPool()
+{
+  CTK_D(ctkDICOMAssociationPool);
+  // a running check gives the associations back when it is done
+  d->CheckPool.waitForDone();
+  this->clear();
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociationPool* ctkDICOMAssociationPool::instance()
+{
+  static QMutex mutex;
+  static QPointer<ctkDICOMAssociationPool> pool;
+  QMutexLocker locker(&mutex);
+  if (pool.isNull())
+    {
+    pool = new ctkDICOMAssociationPool(QCoreApplication::instance());
+    }
+  return pool;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMAssociationPool::setEchoInterval(int seconds)
+{
+  CTK_D(ctkDICOMAssociationPool);
+  d->EchoInterval = qMax(seconds, 0);
+  d->EchoTimer.stop();
+  if (d->EchoInterval > 0)
+    {
+    d->EchoTimer.start(d->EchoInterval * 1000);
+    }
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMAssociationPool::echoInterval()const
+{
+  CTK_D(const ctkDICOMAssociationPool);
+  return d->EchoInterval;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMAssociationPool::setIdleTimeout(int seconds)
+{
+  CTK_D(ctkDICOMAssociationPool);
+  QMutexLocker locker(&d->Mutex);
+  d->IdleTimeout = qMax(seconds, 0);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMAssociationPool::idleTimeout()const
+{
+  CTK_D(const ctkDICOMAssociationPool);
+  QMutexLocker locker(&d->Mutex);
+  return d->IdleTimeout;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMAssociationPool::setMaximumIdleAssociations(int associations)
+{
+  CTK_D(ctkDICOMAssociationPool);
+  QMutexLocker locker(&d->Mutex);
+  d->MaximumIdleAssociations = qMax(associations, 0);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMAssociationPool::maximumIdleAssociations()const
+{
+  CTK_D(const ctkDICOMAssociationPool);
+  QMutexLocker locker(&d->Mutex);
+  return d->MaximumIdleAssociations;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociation* ctkDICOMAssociationPool::acquire(Service service,
+                                                      const QString& callingAETitle,
+                                                      const QString& calledAETitle,
+                                                      const QString& host, int port,
+                                                      int timeout)
+{
+  CTK_D(ctkDICOMAssociationPool);
+  const QString key = ctkDICOMAssociationPoolPrivate::key(service, callingAETitle,
+                                                          calledAETitle, host, port);
+  while (true)
+    {
+    ctkDICOMAssociation* association = 0;
+      {
+      QMutexLocker locker(&d->Mutex);
+      for (int i = 0; i < d->Idle.size(); ++i)
+        {
+        if (d->Idle[i]->Key == key)
+          {
+          association = d->Idle.takeAt(i);
+          break;
+          }
+        }
+      if (association && association->isEstablished())
+        {
+        ++d->Reuses;
+        association->Timeout = timeout;
+        return association;
+        }
+      }
+    if (!association)
+      {
+      break;
+      }
+    // released by the peer while idle, try the next one
+    logger.debug ( "Association " + key + " was closed by the peer" );
+    association->abort();
+    delete association;
+    }
+
+  ctkDICOMAssociation* association = ctkDICOMAssociation::negotiate(
+    service, callingAETitle, calledAETitle, host, port, timeout);
+  if (association)
+    {
+    association->Key = key;
+    QMutexLocker locker(&d->Mutex);
+    ++d->Negotiations;
+    }
+  return association;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMAssociationPool::release(ctkDICOMAssociation* association, bool reusable)
+{
+  CTK_D(ctkDICOMAssociationPool);
+  if (!association)
+    {
+    return;
+    }
+  if (!reusable || !association->isEstablished())
+    {
+    association->abort();
+    delete association;
+    return;
+    }
+  association->Idle.start();
+    {
+    QMutexLocker locker(&d->Mutex);
+    int sameKey = 0;
+    foreach(ctkDICOMAssociation* idle, d->Idle)
+      {
+      sameKey += idle->Key == association->Key ? 1 : 0;
+      }
+    if (sameKey < d->MaximumIdleAssociations)
+      {
+      d->Idle.prepend(association);
+      return;
+      }
+    }
+  delete association;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMAssociationPool::idleAssociations()const
+{
+  CTK_D(const ctkDICOMAssociationPool);
+  QMutexLocker locker(&d->Mutex);
+  return d->Idle.size();
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMAssociationPool::negotiations()const
+{
+  CTK_D(const ctkDICOMAssociationPool);
+  QMutexLocker locker(&d->Mutex);
+  return d->Negotiations;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMAssociationPool::reuses()const
+{
+  CTK_D(const ctkDICOMAssociationPool);
+  QMutexLocker locker(&d->Mutex);
+  return d->Reuses;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMAssociationPool::clear()
+{
+  CTK_D(ctkDICOMAssociationPool);
+  qDeleteAll(d->takeIdle());
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMAssociationPool::checkAssociations()
+{
+  CTK_D(ctkDICOMAssociationPool);
+  ctkDICOMAssociationCheckTask* task = new ctkDICOMAssociationCheckTask(d);
+  if (!d->CheckPool.tryStart(task))
+    {
+    // the previous check is still running
+    delete task;
+    }
+}
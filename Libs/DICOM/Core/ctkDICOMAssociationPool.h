@@ -0,0 +1,120 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMAssociationPool_h
+#define __ctkDICOMAssociationPool_h
+
+// Qt includes
+#include <QObject>
+#include <QString>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMCoreExport.h"
+
+class ctkDICOMAssociation;
+class ctkDICOMAssociationPoolPrivate;
+
+///
+/// Associations to remote AEs kept open between the operations.
+/// ctkDICOMQuery and ctkDICOMRetrieve acquire their associations from a
+/// pool and give them back when they are done, so that back-to-back
+/// operations on the same called AE don't negotiate a new association.
+/// The idle associations are checked with a C-ECHO every echoInterval()
+/// seconds and released after idleTimeout() seconds.
+/// acquire() and release() can be called from any thread, the checks run
+/// in a worker thread of the pool.
+class CTK_DICOM_CORE_EXPORT ctkDICOMAssociationPool : public QObject
+{
+  Q_OBJECT
+  Q_PROPERTY(int echoInterval READ echoInterval WRITE setEchoInterval);
+  Q_PROPERTY(int idleTimeout READ idleTimeout WRITE setIdleTimeout);
+  Q_PROPERTY(int maximumIdleAssociations READ maximumIdleAssociations WRITE setMaximumIdleAssociations);
+public:
+  /// Services the presentation contexts of an association are proposed for.
+  /// Verification is always proposed.
+  enum Service
+  {
+    FindService,
+    /// The storage contexts are proposed with the SCP role
+    GetService,
+    MoveService
+  };
+
+  explicit ctkDICOMAssociationPool(QObject* parent = 0);
+  /// Release all the idle associations
+  virtual ~ctkDICOMAssociationPool();
+
+  ///
+  /// Pool shared by the ctkDICOMQuery and ctkDICOMRetrieve objects that
+  /// don't have their own, owned by the application object.
+  static ctkDICOMAssociationPool* instance();
+
+  ///
+  /// Seconds between the C-ECHO checks of the idle associations, 0 to
+  /// disable the checks. Default is 30.
+  void setEchoInterval(int seconds);
+  int echoInterval()const;
+
+  ///
+  /// Seconds after which an idle association is released. Default is 300.
+  void setIdleTimeout(int seconds);
+  int idleTimeout()const;
+
+  ///
+  /// Idle associations kept for the same service and AE, the others are
+  /// released. Default is 8.
+  void setMaximumIdleAssociations(int associations);
+  int maximumIdleAssociations()const;
+
+  ///
+  /// Return an idle association for the service to calledAETitle@host:port,
+  /// or negotiate a new one with timeout seconds for the negotiation.
+  /// Return 0 if the association can't be negotiated.
+  ctkDICOMAssociation* acquire(Service service,
+                               const QString& callingAETitle,
+                               const QString& calledAETitle,
+                               const QString& host, int port, int timeout);
+  ///
+  /// Give back an association returned by acquire(). If reusable is false,
+  /// or the association is not established anymore, it is aborted.
+  void release(ctkDICOMAssociation* association, bool reusable = true);
+
+  int idleAssociations()const;
+  /// Number of associations negotiated and reused since the creation
+  int negotiations()const;
+  int reuses()const;
+
+public slots:
+  ///
+  /// Release all the idle associations
+  void clear();
+  ///
+  /// Send a C-ECHO on the idle associations and release the ones that
+  /// don't answer or are idle for too long. The check runs in a worker
+  /// thread, nothing is done if the previous one is still running.
+  void checkAssociations();
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMAssociationPool);
+};
+
+#endif
@@ -0,0 +1,125 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMAssociationPool_p_h
+#define __ctkDICOMAssociationPool_p_h
+
+// Qt includes
+#include <QList>
+#include <QMutex>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QTime>
+#include <QTimer>
+
+// ctkDICOM includes
+#include "ctkDICOMAssociationPool.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmnet/assoc.h>
+#include <dcmtk/dcmnet/dimse.h>
+
+//------------------------------------------------------------------------------
+/// An established association and its requestor network. It is used by one
+/// thread at a time: the one that acquired it from the pool.
+class ctkDICOMAssociation
+{
+public:
+  ctkDICOMAssociation();
+  /// Release the association and drop the network
+  ~ctkDICOMAssociation();
+
+  ///
+  /// Negotiate an association for the service, return 0 on failure
+  static ctkDICOMAssociation* negotiate(ctkDICOMAssociationPool::Service service,
+                                        const QString& callingAETitle,
+                                        const QString& calledAETitle,
+                                        const QString& host, int port, int timeout);
+
+  /// Send a C-ECHO, false if the peer doesn't answer within timeout seconds
+  bool echo(int timeout);
+  /// False if the peer sent something while the association was idle:
+  /// that can only be a release request or an abort.
+  bool isEstablished()const;
+  /// Abort instead of releasing when the association is destroyed
+  void abort();
+
+  /// Accepted presentation context of the abstract syntax, 0 if none
+  T_ASC_PresentationContextID presentationContextID(const char* abstractSyntax)const;
+
+  QString            Key;
+  int                Timeout;
+  T_ASC_Network*     Network;
+  T_ASC_Association* Association;
+  /// Restarted each time the association is given back
+  QTime              Idle;
+  bool               Aborted;
+};
+
+//------------------------------------------------------------------------------
+class ctkDICOMAssociationPoolPrivate: public ctkPrivate<ctkDICOMAssociationPool>
+{
+public:
+  ctkDICOMAssociationPoolPrivate();
+
+  static QString key(ctkDICOMAssociationPool::Service service,
+                     const QString& callingAETitle, const QString& calledAETitle,
+                     const QString& host, int port);
+  /// Remove and return the idle associations, to be destroyed or checked
+  /// without holding the mutex
+  QList<ctkDICOMAssociation*> takeIdle();
+  /// Echo the idle associations, see ctkDICOMAssociationPool::checkAssociations()
+  void check();
+
+  /// Seconds an idle association has to answer a C-ECHO. Much shorter than
+  /// the timeout of the operations: a peer that is up answers at once.
+  static const int EchoTimeout = 5;
+
+  int    EchoInterval;
+  int    IdleTimeout;
+  int    MaximumIdleAssociations;
+  QTimer EchoTimer;
+  /// One thread, the checks don't block the thread of the pool and don't
+  /// overlap
+  QThreadPool CheckPool;
+
+  mutable QMutex              Mutex;
+  /// Most recently used first
+  QList<ctkDICOMAssociation*> Idle;
+  int                         Negotiations;
+  int                         Reuses;
+};
+
+//------------------------------------------------------------------------------
+/// Check of the idle associations started by the echo timer
+class ctkDICOMAssociationCheckTask : public QRunnable
+{
+public:
+  ctkDICOMAssociationCheckTask(ctkDICOMAssociationPoolPrivate* pool);
+  virtual void run();
+
+private:
+  ctkDICOMAssociationPoolPrivate* Pool;
+};
+
+#endif
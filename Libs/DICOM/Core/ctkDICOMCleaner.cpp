@@ -0,0 +1,531 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QFileInfo>
+#include <QSet>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QThread>
+#include <QThreadPool>
+#include <QVariant>
+
+// ctkDICOM includes
+#include "ctkDICOMCleaner.h"
+#include "ctkDICOMCleaner_p.h"
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexer_p.h"
+#include "ctkDICOMSearch.h"
+#include "ctkDICOMTimer_p.h"
+#include "ctkLogger.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcfilefo.h>
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/ofstd/ofcond.h>
+#include <dcmtk/ofstd/ofstring.h>
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMCleaner" );
+
+/// In HeaderCheck, values longer than this are skipped instead of read
+static const Uint32 HeaderCheckMaxReadLength = 4096;
+
+namespace
+{
+//------------------------------------------------------------------------------
+/// Size of the file of @param database, -1 if it has none
+qint64 databaseSize(const QSqlDatabase& database)
+{
+  QFileInfo info(database.databaseName());
+  return info.exists() ? info.size() : -1;
+}
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMCleaner::Report::Report()
+{
+  this->DryRun = false;
+  this->ImagesChecked = 0;
+  this->ImagesRemoved = 0;
+  this->SeriesRemoved = 0;
+  this->StudiesRemoved = 0;
+  this->PatientsRemoved = 0;
+  this->DatabaseBytesBefore = -1;
+  this->DatabaseBytesAfter = -1;
+  this->CheckMsecs = 0.;
+  this->DatabaseMsecs = 0.;
+  this->CompactMsecs = 0.;
+  this->TotalMsecs = 0.;
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMCleanerTask methods
+
+//------------------------------------------------------------------------------
+ctkDICOMCleanerTask::ctkDICOMCleanerTask(ctkDICOMCleanerPrivate* cleaner,
+                                         const QStringList& files,
+                                         const QStringList& series)
+{
+  this->Cleaner = cleaner;
+  this->Files = files;
+  this->Series = series;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMCleanerTask::run()
+{
+  QStringList missingFiles;
+  QList<QPair<QString, QString> > corruptedFiles;
+  for (int i = 0; i < this->Files.size() && !this->Cleaner->Canceled; ++i)
+    {
+    const QString& file = this->Files[i];
+    ctkDICOMIndexerFileStat stat;
+    QString error;
+    if (!stat.read(file))
+      {
+      missingFiles << file;
+      }
+    else if (this->Cleaner->Verification != ctkDICOMCleaner::ExistenceCheck &&
+             !this->Cleaner->verify(file, this->Series[i], &error))
+      {
+      corruptedFiles << qMakePair(file, error);
+      }
+    }
+  {
+  QMutexLocker locker(&this->Cleaner->Mutex);
+  this->Cleaner->MissingFiles << missingFiles;
+  this->Cleaner->CorruptedFiles << corruptedFiles;
+  }
+  this->Cleaner->CheckedCount.fetchAndAddOrdered(this->Files.size());
+  this->Cleaner->Batches.release();
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMCleanerPrivate methods
+
+//------------------------------------------------------------------------------
+ctkDICOMCleanerPrivate::ctkDICOMCleanerPrivate()
+{
+  this->Verification = ctkDICOMCleaner::ExistenceCheck;
+  this->NumberOfThreads = 2 * QThread::idealThreadCount();
+  this->BatchSize = 1024;
+  this->DryRun = false;
+  this->Compact = true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMCleanerPrivate::verify(const QString& file, const QString& seriesInstanceUID,
+                                    QString* error)const
+{
+  const QByteArray fileName = file.toLocal8Bit();
+  DcmFileFormat fileformat;
+  OFCondition status;
+  if (this->Verification == ctkDICOMCleaner::FullCheck)
+    {
+    status = fileformat.loadFile(fileName.constData());
+    }
+  else
+    {
+    status = fileformat.loadFile(fileName.constData(), EXS_Unknown,
+      EGL_noChange, HeaderCheckMaxReadLength, ERM_autoDetect);
+    }
+  if (!status.good())
+    {
+    *error = QString("DCMTK says: ") + status.text();
+    return false;
+    }
+  OFString value;
+  fileformat.getDataset()->findAndGetOFString(DCM_SeriesInstanceUID, value);
+  if (seriesInstanceUID != value.c_str())
+    {
+    *error = QString("the file is in series ") + value.c_str() +
+      ", not in " + seriesInstanceUID;
+    return false;
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMCleanerPrivate::removeRows(QSqlDatabase database)
+{
+  ctkDICOMCleaner::Report& report = this->LastReport;
+  const bool indexed = ctkDICOMSearch(database).isIndexed();
+  if (!database.transaction())
+    {
+    logger.error ( "Could not start the cleanup transaction: " + database.lastError().text() );
+    return false;
+    }
+  QSqlQuery query(database);
+  bool res = query.exec("CREATE TEMP TABLE IF NOT EXISTS CleanedFiles "
+                        "( 'Filename' VARCHAR(1024) PRIMARY KEY )") &&
+             query.exec("DELETE FROM CleanedFiles") &&
+             query.exec("CREATE TEMP TABLE IF NOT EXISTS CleanedSeries "
+                        "( 'SeriesInstanceUID' VARCHAR(255) PRIMARY KEY )") &&
+             query.exec("DELETE FROM CleanedSeries") &&
+             query.exec("CREATE TEMP TABLE IF NOT EXISTS CleanedStudies "
+                        "( 'StudyInstanceUID' VARCHAR(255) PRIMARY KEY )") &&
+             query.exec("DELETE FROM CleanedStudies") &&
+             query.exec("CREATE TEMP TABLE IF NOT EXISTS CleanedPatients "
+                        "( 'UID' INTEGER PRIMARY KEY )") &&
+             query.exec("DELETE FROM CleanedPatients");
+
+  // The directories of the removed files are listed again by the next
+  // import, a corrupted file that is replaced is indexed again.
+  QStringList files = this->MissingFiles;
+  for (int i = 0; i < this->CorruptedFiles.size(); ++i)
+    {
+    files << this->CorruptedFiles[i].first;
+    }
+  QSet<QString> directories;
+  QSqlQuery insertFile(database);
+  res = res && insertFile.prepare("INSERT OR IGNORE INTO CleanedFiles VALUES ( ? )");
+  foreach(const QString& file, files)
+    {
+    if (!res)
+      {
+      break;
+      }
+    insertFile.bindValue(0, file);
+    res = insertFile.exec();
+    directories.insert(file.left(file.lastIndexOf('/')));
+    }
+  QSqlQuery removeDirectory(database);
+  res = res && removeDirectory.prepare("DELETE FROM DirectoryJournal WHERE Dirname = ?");
+  foreach(const QString& directory, directories)
+    {
+    if (!res)
+      {
+      break;
+      }
+    removeDirectory.bindValue(0, directory);
+    res = removeDirectory.exec();
+    }
+
+  // Only the series, studies and patients of the removed images are
+  // removed once empty: the results of ctkDICOMQuery have no images.
+  res = res && query.exec("INSERT OR IGNORE INTO CleanedSeries SELECT SeriesInstanceUID "
+                          "FROM Images WHERE Filename IN ( SELECT Filename FROM CleanedFiles )") &&
+               query.exec("INSERT OR IGNORE INTO CleanedStudies SELECT StudyInstanceUID "
+                          "FROM Series WHERE SeriesInstanceUID IN ( SELECT SeriesInstanceUID FROM CleanedSeries )") &&
+               query.exec("INSERT OR IGNORE INTO CleanedPatients SELECT PatientsUID "
+                          "FROM Studies WHERE StudyInstanceUID IN ( SELECT StudyInstanceUID FROM CleanedStudies )");
+  res = res && query.exec("DELETE FROM Images WHERE Filename IN "
+                          "( SELECT Filename FROM CleanedFiles )");
+  report.ImagesRemoved = res ? query.numRowsAffected() : 0;
+  res = res && query.exec("DELETE FROM Series WHERE SeriesInstanceUID IN "
+                          "( SELECT SeriesInstanceUID FROM CleanedSeries ) AND NOT EXISTS "
+                          "( SELECT 1 FROM Images WHERE Images.SeriesInstanceUID = Series.SeriesInstanceUID )");
+  report.SeriesRemoved = res ? query.numRowsAffected() : 0;
+  res = res && query.exec("DELETE FROM Studies WHERE StudyInstanceUID IN "
+                          "( SELECT StudyInstanceUID FROM CleanedStudies ) AND NOT EXISTS "
+                          "( SELECT 1 FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID )");
+  report.StudiesRemoved = res ? query.numRowsAffected() : 0;
+  res = res && query.exec("DELETE FROM Patients WHERE UID IN "
+                          "( SELECT UID FROM CleanedPatients ) AND NOT EXISTS "
+                          "( SELECT 1 FROM Studies WHERE Studies.PatientsUID = Patients.UID )");
+  report.PatientsRemoved = res ? query.numRowsAffected() : 0;
+
+  // The aggregates and the search index are updated in the transaction,
+  // a failure leaves the database unchanged
+  if (res && !this->DryRun)
+    {
+    // only the series and studies that lost rows
+    res = ctkDICOMDatabaseWriter::refreshAggregates(database,
+      "SELECT SeriesInstanceUID FROM CleanedSeries",
+      "SELECT StudyInstanceUID FROM CleanedStudies");
+    }
+  if (res && !this->DryRun && indexed)
+    {
+    res = query.exec(QString("DELETE FROM SearchIndex WHERE Level = %1 AND UID IN "
+                             "( SELECT SeriesInstanceUID FROM CleanedSeries WHERE NOT EXISTS "
+                             "( SELECT 1 FROM Series WHERE Series.SeriesInstanceUID = CleanedSeries.SeriesInstanceUID ) )")
+                     .arg(ctkDICOMSearch::SeriesLevel)) &&
+          query.exec(QString("DELETE FROM SearchIndex WHERE Level = %1 AND UID IN "
+                             "( SELECT StudyInstanceUID FROM CleanedStudies WHERE NOT EXISTS "
+                             "( SELECT 1 FROM Studies WHERE Studies.StudyInstanceUID = CleanedStudies.StudyInstanceUID ) )")
+                     .arg(ctkDICOMSearch::StudyLevel)) &&
+          query.exec(QString("DELETE FROM SearchIndex WHERE Level = %1 AND UID IN "
+                             "( SELECT UID FROM CleanedPatients WHERE NOT EXISTS "
+                             "( SELECT 1 FROM Patients WHERE Patients.UID = CleanedPatients.UID ) )")
+                     .arg(ctkDICOMSearch::PatientLevel));
+    // the studies left may have lost the modalities of their removed series
+    QSqlQuery keptStudies(database);
+    res = res && keptStudies.exec("SELECT StudyInstanceUID FROM CleanedStudies WHERE EXISTS "
+                                  "( SELECT 1 FROM Studies WHERE Studies.StudyInstanceUID = CleanedStudies.StudyInstanceUID )");
+    ctkDICOMSearch search(database);
+    while (res && keptStudies.next())
+      {
+      res = search.reindex(ctkDICOMSearch::StudyLevel, keptStudies.value(0).toString());
+      }
+    }
+  res = res && query.exec("DROP TABLE CleanedFiles") &&
+               query.exec("DROP TABLE CleanedSeries") &&
+               query.exec("DROP TABLE CleanedStudies") &&
+               query.exec("DROP TABLE CleanedPatients");
+
+  if (!res)
+    {
+    logger.error ( "Error removing the images: " + query.lastError().text() +
+                   insertFile.lastError().text() + removeDirectory.lastError().text() );
+    }
+  if (!res || this->DryRun)
+    {
+    database.rollback();
+    return res;
+    }
+  if (!database.commit())
+    {
+    logger.error ( "Error committing the cleanup: " + database.lastError().text() );
+    database.rollback();
+    return false;
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMCleaner methods
+
+//------------------------------------------------------------------------------
+ctkDICOMCleaner::ctkDICOMCleaner(QObject* parent)
+  : Superclass(parent)
+{
+  CTK_INIT_PRIVATE(ctkDICOMCleaner);
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMCleaner::~ctkDICOMCleaner()
+{
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMCleaner::setVerification(Verification verification)
+{
+  CTK_D(ctkDICOMCleaner);
+  d->Verification = verification;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMCleaner::Verification ctkDICOMCleaner::verification()const
+{
+  CTK_D(const ctkDICOMCleaner);
+  return d->Verification;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMCleaner::setNumberOfThreads(int threads)
+{
+  CTK_D(ctkDICOMCleaner);
+  d->NumberOfThreads = qMax(threads, 1);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMCleaner::numberOfThreads()const
+{
+  CTK_D(const ctkDICOMCleaner);
+  return d->NumberOfThreads;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMCleaner::setBatchSize(int images)
+{
+  CTK_D(ctkDICOMCleaner);
+  d->BatchSize = qMax(images, 1);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMCleaner::batchSize()const
+{
+  CTK_D(const ctkDICOMCleaner);
+  return d->BatchSize;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMCleaner::setDryRun(bool dryRun)
+{
+  CTK_D(ctkDICOMCleaner);
+  d->DryRun = dryRun;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMCleaner::dryRun()const
+{
+  CTK_D(const ctkDICOMCleaner);
+  return d->DryRun;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMCleaner::setCompact(bool compact)
+{
+  CTK_D(ctkDICOMCleaner);
+  d->Compact = compact;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMCleaner::compact()const
+{
+  CTK_D(const ctkDICOMCleaner);
+  return d->Compact;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMCleaner::Report ctkDICOMCleaner::lastReport()const
+{
+  CTK_D(const ctkDICOMCleaner);
+  return d->LastReport;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMCleaner::cancel()
+{
+  CTK_D(ctkDICOMCleaner);
+  d->Canceled.fetchAndStoreOrdered(1);
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMCleaner::cleanup(QSqlDatabase database)
+{
+  CTK_D(ctkDICOMCleaner);
+  ctkDICOMTimer totalTimer;
+  d->Canceled.fetchAndStoreOrdered(0);
+  d->CheckedCount.fetchAndStoreOrdered(0);
+  d->MissingFiles.clear();
+  d->CorruptedFiles.clear();
+  d->LastReport = Report();
+  Report& report = d->LastReport;
+  report.DryRun = d->DryRun;
+  report.DatabaseBytesBefore = databaseSize(database);
+
+  QSqlQuery count(database);
+  const int total = count.exec("SELECT COUNT(*) FROM Images") && count.next() ?
+    count.value(0).toInt() : 0;
+  count.finish();
+
+  // two batches per thread are queued, the next ones are read once a
+  // thread is done
+  const int maxBatches = 2 * d->NumberOfThreads;
+  if (d->Batches.available() < maxBatches)
+    {
+    d->Batches.release(maxBatches - d->Batches.available());
+    }
+  else
+    {
+    d->Batches.acquire(d->Batches.available() - maxBatches);
+    }
+  QThreadPool pool;
+  pool.setMaxThreadCount(d->NumberOfThreads);
+
+  ctkDICOMTimer timer;
+  QSqlQuery images(database);
+  images.setForwardOnly(true);
+  bool res = images.exec("SELECT Filename, SeriesInstanceUID FROM Images");
+  QStringList files;
+  QStringList series;
+  int lastPercent = -1;
+  bool finished = !res || !images.next();
+  while (!finished && !d->Canceled)
+    {
+    files << images.value(0).toString();
+    series << images.value(1).toString();
+    finished = !images.next();
+    if (files.size() < d->BatchSize && !finished)
+      {
+      continue;
+      }
+    d->Batches.acquire();
+    pool.start(new ctkDICOMCleanerTask(d, files, series));
+    files.clear();
+    series.clear();
+    const int percent = total > 0 ?
+      qMin(99, static_cast<int>(d->CheckedCount) * 100 / total) : 0;
+    if (percent > lastPercent)
+      {
+      lastPercent = percent;
+      emit this->progress(percent);
+      }
+    }
+  // the rows are removed in another transaction
+  images.finish();
+  pool.waitForDone();
+  report.CheckMsecs = timer.elapsed() / 1000.;
+  report.ImagesChecked = d->CheckedCount;
+
+  if (!res)
+    {
+    logger.error ( "Could not read the images: " + images.lastError().text() );
+    }
+  if (d->Canceled || !res)
+    {
+    if (d->Canceled)
+      {
+      logger.warn ( QString("Cleanup canceled after checking %1 images")
+                    .arg(report.ImagesChecked) );
+      }
+    report.TotalMsecs = totalTimer.elapsed() / 1000.;
+    return false;
+    }
+
+  // the tasks finish in any order
+  d->MissingFiles.sort();
+  qSort(d->CorruptedFiles);
+  report.MissingFiles = d->MissingFiles;
+  for (int i = 0; i < d->CorruptedFiles.size(); ++i)
+    {
+    logger.warn ( "Corrupted file " + d->CorruptedFiles[i].first + ": " +
+                  d->CorruptedFiles[i].second );
+    report.CorruptedFiles << d->CorruptedFiles[i].first;
+    }
+
+  timer.start();
+  res = d->removeRows(database);
+  const bool removed = report.ImagesRemoved > 0 || report.SeriesRemoved > 0 ||
+    report.StudiesRemoved > 0 || report.PatientsRemoved > 0;
+  report.DatabaseMsecs = timer.elapsed() / 1000.;
+
+  timer.start();
+  if (res && removed && !d->DryRun && d->Compact)
+    {
+    QSqlQuery vacuum(database);
+    if (!vacuum.exec("VACUUM"))
+      {
+      logger.warn ( "Could not compact the database: " + vacuum.lastError().text() );
+      }
+    }
+  report.CompactMsecs = timer.elapsed() / 1000.;
+  report.DatabaseBytesAfter = databaseSize(database);
+  report.TotalMsecs = totalTimer.elapsed() / 1000.;
+  if (lastPercent < 100)
+    {
+    emit this->progress(100);
+    }
+
+  logger.info ( QString("%1 %2 images: %3 missing and %4 corrupted files, "
+                        "%5 images, %6 series, %7 studies and %8 patients removed "
+                        "in %9 ms")
+                .arg(d->DryRun ? "Checked (dry run)" : "Cleaned up")
+                .arg(report.ImagesChecked).arg(report.MissingFiles.size())
+                .arg(report.CorruptedFiles.size()).arg(report.ImagesRemoved)
+                .arg(report.SeriesRemoved).arg(report.StudiesRemoved)
+                .arg(report.PatientsRemoved).arg(report.TotalMsecs) );
+  return res;
+}
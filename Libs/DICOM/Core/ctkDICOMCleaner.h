@@ -0,0 +1,155 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMCleaner_h
+#define __ctkDICOMCleaner_h
+
+// Qt includes
+#include <QObject>
+#include <QSqlDatabase>
+#include <QStringList>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMCoreExport.h"
+
+class ctkDICOMCleanerPrivate;
+
+///
+/// Remove from a DICOM database the images whose file is missing or
+/// corrupted, and the series, studies and patients left without images by
+/// their removal. Rows that had no images before, e.g. the results of
+/// ctkDICOMQuery, are kept.
+/// The files are checked by worker threads, in batches of batchSize()
+/// images, while the calling thread reads the next rows of the Images
+/// table. The rows are then removed, and the aggregates of the series and
+/// studies they belonged to and the search index are updated, in one
+/// transaction. The
+/// database is compacted after the commit.
+/// In dry run, the rows are removed and the transaction is rolled back:
+/// the report counts exactly what would be removed.
+/// The cleaner must be used from the thread owning the database connection.
+class CTK_DICOM_CORE_EXPORT ctkDICOMCleaner : public QObject
+{
+  Q_OBJECT
+  Q_PROPERTY(Verification verification READ verification WRITE setVerification);
+  Q_PROPERTY(int numberOfThreads READ numberOfThreads WRITE setNumberOfThreads);
+  Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize);
+  Q_PROPERTY(bool dryRun READ dryRun WRITE setDryRun);
+  Q_PROPERTY(bool compact READ compact WRITE setCompact);
+  Q_ENUMS(Verification);
+public:
+  typedef QObject Superclass;
+
+  enum Verification
+  {
+    /// Only check that the files exist
+    ExistenceCheck,
+    /// Also parse the header of the files: a file that can't be parsed or
+    /// that is not in the series it is indexed in is corrupted
+    HeaderCheck,
+    /// Also read the whole files, pixel data included, to find the
+    /// truncated and unreadable ones
+    FullCheck
+  };
+
+  /// Result of the last cleanup call
+  struct Report
+  {
+    Report();
+    /// True if the database was left unchanged
+    bool        DryRun;
+    /// Images whose file was checked
+    int         ImagesChecked;
+    /// Files that don't exist anymore
+    QStringList MissingFiles;
+    /// Files that failed the verification
+    QStringList CorruptedFiles;
+    /// Rows removed, or that would be removed in dry run
+    int         ImagesRemoved;
+    int         SeriesRemoved;
+    int         StudiesRemoved;
+    int         PatientsRemoved;
+    /// Size of the database file before and after the cleanup, -1 if unknown
+    qint64      DatabaseBytesBefore;
+    qint64      DatabaseBytesAfter;
+    /// Wall time spent checking the files, removing the rows and
+    /// refreshing the aggregates and the search index, and compacting
+    double      CheckMsecs;
+    double      DatabaseMsecs;
+    double      CompactMsecs;
+    double      TotalMsecs;
+  };
+
+  explicit ctkDICOMCleaner(QObject* parent = 0);
+  virtual ~ctkDICOMCleaner();
+
+  ///
+  /// How the indexed files are checked. Default is ExistenceCheck.
+  void setVerification(Verification verification);
+  Verification verification()const;
+
+  ///
+  /// Number of threads checking the files.
+  /// Default is twice QThread::idealThreadCount(), the existence checks
+  /// mostly wait for the file system.
+  void setNumberOfThreads(int threads);
+  int numberOfThreads()const;
+
+  ///
+  /// Number of images checked by a thread at once. Default is 1024.
+  void setBatchSize(int images);
+  int batchSize()const;
+
+  ///
+  /// Only report what would be removed. Default is false.
+  void setDryRun(bool dryRun);
+  bool dryRun()const;
+
+  ///
+  /// Vacuum the database after removing rows. Default is true.
+  void setCompact(bool compact);
+  bool compact()const;
+
+  ///
+  /// Check the files of all the images of @param database and remove the
+  /// missing and corrupted ones with the rows left empty. Return false if
+  /// the cleanup is canceled or a statement fails, the database is then
+  /// unchanged.
+  bool cleanup(QSqlDatabase database);
+
+  Report lastReport()const;
+
+public slots:
+  ///
+  /// Stop the running cleanup before any row is removed. Can be called
+  /// from any thread.
+  void cancel();
+
+signals:
+  /// Percentage of the images checked
+  void progress(int percent);
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMCleaner);
+};
+
+#endif
@@ -0,0 +1,88 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMCleaner_p_h
+#define __ctkDICOMCleaner_p_h
+
+// Qt includes
+#include <QAtomicInt>
+#include <QMutex>
+#include <QPair>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QStringList>
+
+// ctkDICOM includes
+#include "ctkDICOMCleaner.h"
+
+class ctkDICOMCleanerPrivate;
+
+//------------------------------------------------------------------------------
+/// Check of a batch of images: their file and the series they are indexed in
+class ctkDICOMCleanerTask : public QRunnable
+{
+public:
+  ctkDICOMCleanerTask(ctkDICOMCleanerPrivate* cleaner,
+                      const QStringList& files, const QStringList& series);
+  virtual void run();
+
+private:
+  ctkDICOMCleanerPrivate* Cleaner;
+  QStringList Files;
+  QStringList Series;
+};
+
+//------------------------------------------------------------------------------
+class ctkDICOMCleanerPrivate: public ctkPrivate<ctkDICOMCleaner>
+{
+public:
+  ctkDICOMCleanerPrivate();
+
+  /// Check one file, called by the tasks. Return false and set
+  /// @param error if the file is corrupted.
+  bool verify(const QString& file, const QString& seriesInstanceUID,
+              QString* error)const;
+
+  /// Remove the images of MissingFiles and CorruptedFiles and the rows
+  /// they leave empty, and update the aggregates and the search index, in
+  /// one transaction. The transaction is rolled back in dry run.
+  bool removeRows(QSqlDatabase database);
+
+  ctkDICOMCleaner::Verification Verification;
+  int  NumberOfThreads;
+  int  BatchSize;
+  bool DryRun;
+  bool Compact;
+
+  QAtomicInt Canceled;
+  QAtomicInt CheckedCount;
+  /// Bounds the number of batches waiting in the pool, the rows of the
+  /// Images table are not all in memory at once
+  QSemaphore Batches;
+
+  /// Written by the tasks
+  QMutex                         Mutex;
+  QStringList                    MissingFiles;
+  QList<QPair<QString, QString> > CorruptedFiles;
+
+  ctkDICOMCleaner::Report LastReport;
+};
+
+#endif
@@ -0,0 +1,940 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QCache>
+#include <QHash>
+#include <QSet>
+#include <QStringList>
+#include <QDate>
+#include <QDateTime>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QTime>
+#include <QVariant>
+
+// ctkDICOM includes
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMSearch.h"
+#include "ctkDICOMTimer_p.h"
+#include "ctkLogger.h"
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMDatabaseWriter" );
+
+//------------------------------------------------------------------------------
+/// Bounded LRU cache of the keys of one table. The value is the patient UID
+/// for the Patients table, unused otherwise.
+class ctkDICOMDatabaseWriterCache
+{
+public:
+  ctkDICOMDatabaseWriterCache() {}
+
+  bool find(const QString& key, int& value)const
+    {
+    int* cached = this->Entries.object(key);
+    if (cached)
+      {
+      value = *cached;
+      }
+    return cached != 0;
+    }
+
+  void insert(const QString& key, int value)
+    {
+    this->Entries.insert(key, new int(value));
+    }
+
+  void clear()
+    {
+    this->Entries.clear();
+    }
+
+  /// A key that is not found may still be in the database: the indexer,
+  /// the query, the retrieve and the listener insert rows on the same
+  /// connection without going through this cache.
+  QCache<QString, int> Entries;
+};
+
+//------------------------------------------------------------------------------
+/// Images added to and removed from a series since the last commit
+struct ctkDICOMDatabaseWriterDelta
+{
+  ctkDICOMDatabaseWriterDelta() : Instances(0), Bytes(0) {}
+  /// Empty if not known by the writer
+  QString StudyInstanceUID;
+  int     Instances;
+  qint64  Bytes;
+};
+
+namespace
+{
+/// Aggregates of the series, recomputed from the Images table
+const char* RefreshSeries =
+  "UPDATE Series SET "
+  "InstanceCount = (SELECT COUNT(*) FROM Images WHERE Images.SeriesInstanceUID = Series.SeriesInstanceUID), "
+  "TotalBytes = (SELECT ifnull(SUM(FileSize), 0) FROM Images WHERE Images.SeriesInstanceUID = Series.SeriesInstanceUID)";
+/// Aggregates of the studies, recomputed from the Series table
+const char* RefreshStudies =
+  "UPDATE Studies SET "
+  "SeriesCount = (SELECT COUNT(*) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID), "
+  "InstanceCount = (SELECT ifnull(SUM(InstanceCount), 0) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID), "
+  "TotalBytes = (SELECT ifnull(SUM(TotalBytes), 0) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID), "
+  "Modalities = (SELECT group_concat(Modality, '\\') FROM "
+  "  (SELECT DISTINCT Modality FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID "
+  "   AND Modality != '' ORDER BY Modality)), "
+  "FirstSeriesDate = (SELECT MIN(SeriesDate) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID), "
+  "LastSeriesDate = (SELECT MAX(SeriesDate) FROM Series WHERE Series.StudyInstanceUID = Studies.StudyInstanceUID)";
+}
+
+//------------------------------------------------------------------------------
+class ctkDICOMDatabaseWriterPrivate: public ctkPrivate<ctkDICOMDatabaseWriter>
+{
+public:
+  ctkDICOMDatabaseWriterPrivate();
+
+  /// Prepare the statements if not already done for the current database
+  bool prepare();
+  bool exec(QSqlQuery& statement);
+  /// Open a transaction if none is pending
+  void begin();
+  /// Commit if the batch is full or too old
+  bool commitIfNeeded();
+  /// Forget all the cached rows
+  void clearCache();
+  /// Fill the caches with the rows of the database, up to CacheSize rows
+  /// per table
+  bool preload();
+  static QString patientKey(const QString& id, const QString& name,
+                            const QString& birthDate);
+
+  int  patientUID(const ctkDICOMIndexerRecord& record);
+  bool insertStudy(const ctkDICOMIndexerRecord& record, int patientUID);
+  bool insertSeries(const ctkDICOMIndexerRecord& record);
+  bool insertImage(const ctkDICOMIndexerRecord& record);
+  /// Account for the image row of filename before it is removed or
+  /// replaced, if there is one
+  bool subtractImage(const QString& filename);
+  /// Apply the pending deltas to the series and refresh the aggregates of
+  /// their studies
+  bool updateAggregates();
+  /// Index the text of a new patient, study or series, if the database
+  /// has a search index
+  bool index(ctkDICOMSearch::Level level, const QVariant& uid,
+             const ctkDICOMIndexerRecord& record);
+
+  QSqlDatabase Database;
+  bool         Prepared;
+  int          BatchSize;
+  int          BatchInterval;
+
+  bool  InTransaction;
+  int   PendingCount;
+  QTime TransactionTime;
+
+  QSqlQuery SelectPatient;
+  QSqlQuery InsertPatient;
+  QSqlQuery SelectStudy;
+  QSqlQuery InsertStudy;
+  QSqlQuery SelectSeries;
+  QSqlQuery InsertSeries;
+  QSqlQuery InsertImage;
+  QSqlQuery SelectImage;
+  QSqlQuery RemoveImage;
+  QSqlQuery RemoveImages;
+  QSqlQuery InsertDirectory;
+  QSqlQuery RemoveDirectories;
+  bool      Searchable;
+  QSqlQuery InsertSearch;
+  QSqlQuery UpdateSeries;
+  QSqlQuery SelectSeriesStudy;
+  QSqlQuery SelectDirectorySeries;
+  QSqlQuery RefreshOneSeries;
+  QSqlQuery RefreshOneStudy;
+
+  /// The aggregates of the series and studies are updated when the
+  /// transaction is committed, once per series and study instead of once
+  /// per image
+  QHash<QString, ctkDICOMDatabaseWriterDelta> SeriesDeltas;
+  /// Studies with new series
+  QSet<QString>                               NewSeriesStudies;
+
+  /// Rows known to be in the database. Most files of an import belong
+  /// to patients, studies and series already seen, even when the
+  /// directories are interleaved.
+  int                         CacheSize;
+  bool                        Preloaded;
+  ctkDICOMDatabaseWriterCache Patients;
+  ctkDICOMDatabaseWriterCache Studies;
+  ctkDICOMDatabaseWriterCache Series;
+  int                         CacheHits;
+  int                         CacheMisses;
+
+  /// Statements executed and commits, and their duration in microseconds
+  int                         StatementCount;
+  qint64                      StatementTime;
+};
+
+//------------------------------------------------------------------------------
+// ctkDICOMDatabaseWriterPrivate methods
+
+//------------------------------------------------------------------------------
+ctkDICOMDatabaseWriterPrivate::ctkDICOMDatabaseWriterPrivate()
+{
+  this->Prepared = false;
+  this->Searchable = false;
+  this->BatchSize = 500;
+  this->BatchInterval = 1000;
+  this->InTransaction = false;
+  this->PendingCount = 0;
+  this->CacheSize = 50000;
+  this->Preloaded = false;
+  this->Patients.Entries.setMaxCost(this->CacheSize);
+  this->Studies.Entries.setMaxCost(this->CacheSize);
+  this->Series.Entries.setMaxCost(this->CacheSize);
+  this->CacheHits = 0;
+  this->CacheMisses = 0;
+  this->StatementCount = 0;
+  this->StatementTime = 0;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMDatabaseWriterPrivate::clearCache()
+{
+  this->Patients.clear();
+  this->Studies.clear();
+  this->Series.clear();
+  this->Preloaded = false;
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMDatabaseWriterPrivate::patientKey(const QString& id, const QString& name,
+                                                  const QString& birthDate)
+{
+  return id + QChar(0) + name + QChar(0) + birthDate;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::preload()
+{
+  if (this->Preloaded)
+    {
+    return true;
+    }
+  this->clearCache();
+  QSqlQuery query(this->Database);
+  query.setForwardOnly(true);
+
+  query.prepare("SELECT UID, PatientID, PatientsName, PatientsBirthDate FROM Patients LIMIT ?");
+  query.bindValue(0, this->CacheSize + 1);
+  if (!this->exec(query))
+    {
+    return false;
+    }
+  int rows = 0;
+  while (query.next() && ++rows <= this->CacheSize)
+    {
+    this->Patients.insert(patientKey(query.value(1).toString(), query.value(2).toString(),
+                                     query.value(3).toString()),
+                          query.value(0).toInt());
+    }
+
+  query.prepare("SELECT StudyInstanceUID FROM Studies LIMIT ?");
+  query.bindValue(0, this->CacheSize + 1);
+  if (!this->exec(query))
+    {
+    return false;
+    }
+  rows = 0;
+  while (query.next() && ++rows <= this->CacheSize)
+    {
+    this->Studies.insert(query.value(0).toString(), 0);
+    }
+
+  query.prepare("SELECT SeriesInstanceUID FROM Series LIMIT ?");
+  query.bindValue(0, this->CacheSize + 1);
+  if (!this->exec(query))
+    {
+    return false;
+    }
+  rows = 0;
+  while (query.next() && ++rows <= this->CacheSize)
+    {
+    this->Series.insert(query.value(0).toString(), 0);
+    }
+
+  this->Preloaded = true;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::prepare()
+{
+  if (this->Prepared)
+    {
+    return true;
+    }
+  if (!this->Database.isOpen())
+    {
+    logger.error ( "Database is not open" );
+    return false;
+    }
+  this->SelectPatient = QSqlQuery(this->Database);
+  this->InsertPatient = QSqlQuery(this->Database);
+  this->SelectStudy = QSqlQuery(this->Database);
+  this->InsertStudy = QSqlQuery(this->Database);
+  this->SelectSeries = QSqlQuery(this->Database);
+  this->InsertSeries = QSqlQuery(this->Database);
+  this->InsertImage = QSqlQuery(this->Database);
+  this->SelectImage = QSqlQuery(this->Database);
+  this->RemoveImage = QSqlQuery(this->Database);
+  this->RemoveImages = QSqlQuery(this->Database);
+  this->InsertDirectory = QSqlQuery(this->Database);
+  this->RemoveDirectories = QSqlQuery(this->Database);
+  this->InsertSearch = QSqlQuery(this->Database);
+  this->UpdateSeries = QSqlQuery(this->Database);
+  this->SelectSeriesStudy = QSqlQuery(this->Database);
+  this->SelectDirectorySeries = QSqlQuery(this->Database);
+  this->RefreshOneSeries = QSqlQuery(this->Database);
+  this->RefreshOneStudy = QSqlQuery(this->Database);
+
+  /// PatientID is not unique in DICOM, so we also compare Name and BirthDate
+  /// and assume this is sufficient
+  bool res = this->SelectPatient.prepare (
+    "SELECT UID FROM Patients WHERE PatientID = ? AND PatientsName = ? AND PatientsBirthDate = ?" );
+  res = res && this->InsertPatient.prepare (
+    "INSERT INTO Patients ( 'UID', 'PatientsName', 'PatientID', 'PatientsBirthDate', 'PatientsBirthTime', 'PatientsSex', 'PatientsAge', 'PatientsComments' ) "
+    "VALUES ( NULL, ?, ?, ?, ?, ?, ?, ? )" );
+  res = res && this->SelectStudy.prepare (
+    "SELECT StudyInstanceUID FROM Studies WHERE StudyInstanceUID = ?" );
+  res = res && this->InsertStudy.prepare (
+    "INSERT INTO Studies ( 'StudyInstanceUID', 'PatientsUID', 'StudyID', 'StudyDate', 'StudyTime', 'AccessionNumber', 'ModalitiesInStudy', 'InstitutionName', 'ReferringPhysician', 'PerformingPhysiciansName', 'StudyDescription' ) "
+    "VALUES ( ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ? )" );
+  res = res && this->SelectSeries.prepare (
+    "SELECT SeriesInstanceUID FROM Series WHERE SeriesInstanceUID = ?" );
+  res = res && this->InsertSeries.prepare (
+    "INSERT INTO Series ( 'SeriesInstanceUID', 'StudyInstanceUID', 'SeriesNumber', 'SeriesDate', 'SeriesTime', 'SeriesDescription', 'BodyPartExamined', 'FrameOfReferenceUID', 'AcquisitionNumber', 'ContrastAgent', 'ScanningSequence', 'EchoNumber', 'TemporalPosition', 'Modality' ) "
+    "VALUES ( ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ? )" );
+  res = res && this->InsertImage.prepare (
+    "INSERT OR REPLACE INTO Images ( 'Filename', 'SeriesInstanceUID', 'InsertTimestamp', 'FileSize', 'FileMTime', 'Inode' ) "
+    "VALUES ( ?, ?, ?, ?, ?, ? )" );
+  res = res && this->SelectImage.prepare (
+    "SELECT SeriesInstanceUID, FileSize FROM Images WHERE Filename = ?" );
+  res = res && this->RemoveImage.prepare (
+    "DELETE FROM Images WHERE Filename = ?" );
+  /// LIKE would need the wildcards of the directory name to be escaped
+  res = res && this->RemoveImages.prepare (
+    "DELETE FROM Images WHERE substr(Filename, 1, length(?)) = ?" );
+  res = res && this->InsertDirectory.prepare (
+    "INSERT OR REPLACE INTO DirectoryJournal ( 'Dirname', 'MTime' ) VALUES ( ?, ? )" );
+  res = res && this->RemoveDirectories.prepare (
+    "DELETE FROM DirectoryJournal WHERE Dirname = ? OR substr(Dirname, 1, length(?)) = ?" );
+  res = res && this->UpdateSeries.prepare (
+    "UPDATE Series SET InstanceCount = InstanceCount + ?, TotalBytes = TotalBytes + ? "
+    "WHERE SeriesInstanceUID = ?" );
+  res = res && this->SelectSeriesStudy.prepare (
+    "SELECT StudyInstanceUID FROM Series WHERE SeriesInstanceUID = ?" );
+  res = res && this->SelectDirectorySeries.prepare (
+    "SELECT DISTINCT SeriesInstanceUID FROM Images WHERE substr(Filename, 1, length(?)) = ?" );
+  res = res && this->RefreshOneSeries.prepare (
+    QString(RefreshSeries) + " WHERE SeriesInstanceUID = ?" );
+  res = res && this->RefreshOneStudy.prepare (
+    QString(RefreshStudies) + " WHERE StudyInstanceUID = ?" );
+  this->Searchable = ctkDICOMSearch(this->Database).isIndexed();
+  if (this->Searchable)
+    {
+    res = res && this->InsertSearch.prepare (
+      "INSERT INTO SearchIndex ( Level, UID, Content ) VALUES ( ?, ?, ? )" );
+    }
+  if (!res)
+    {
+    logger.error ( "Error preparing statements: " + this->Database.lastError().text() );
+    return false;
+    }
+  this->Prepared = true;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::exec(QSqlQuery& statement)
+{
+  ctkDICOMTimer timer;
+  const bool res = statement.exec();
+  ++this->StatementCount;
+  this->StatementTime += timer.elapsed();
+  if (!res)
+    {
+    logger.error ( "Error executing statement: " + statement.lastQuery() +
+                   " Error: " + statement.lastError().text() );
+    return false;
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMDatabaseWriterPrivate::begin()
+{
+  if (this->InTransaction)
+    {
+    return;
+    }
+  // Without a transaction, each statement is committed on its own
+  this->InTransaction = this->Database.transaction();
+  this->PendingCount = 0;
+  this->TransactionTime.start();
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::commitIfNeeded()
+{
+  CTK_P(ctkDICOMDatabaseWriter);
+  if (this->PendingCount >= this->BatchSize ||
+      this->TransactionTime.elapsed() >= this->BatchInterval)
+    {
+    return p->commit();
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMDatabaseWriterPrivate::patientUID(const ctkDICOMIndexerRecord& record)
+{
+  //The patient UID is a unique number within the database, generated by the sqlite autoincrement
+  int patientUID = -1;
+  const QString key = patientKey(record.PatientID, record.PatientsName, record.PatientsBirthDate);
+  if (this->Patients.find(key, patientUID))
+    {
+    ++this->CacheHits;
+    return patientUID;
+    }
+
+  // the row may have been inserted by another writer of the connection
+  ++this->CacheMisses;
+  this->SelectPatient.bindValue ( 0, record.PatientID );
+  this->SelectPatient.bindValue ( 1, record.PatientsName );
+  this->SelectPatient.bindValue ( 2, record.PatientsBirthDate );
+  if (!this->exec(this->SelectPatient))
+    {
+    return -1;
+    }
+  if (this->SelectPatient.next())
+    {
+    patientUID = this->SelectPatient.value(0).toInt();
+    }
+  this->SelectPatient.finish();
+
+  if (patientUID == -1)
+    {
+    this->InsertPatient.bindValue ( 0, record.PatientsName );
+    this->InsertPatient.bindValue ( 1, record.PatientID );
+    this->InsertPatient.bindValue ( 2, record.PatientsBirthDate );
+    this->InsertPatient.bindValue ( 3, record.PatientsBirthTime );
+    this->InsertPatient.bindValue ( 4, record.PatientsSex );
+    this->InsertPatient.bindValue ( 5, record.PatientsAge );
+    this->InsertPatient.bindValue ( 6, record.PatientComments );
+    if (!this->exec(this->InsertPatient))
+      {
+      return -1;
+      }
+    patientUID = this->InsertPatient.lastInsertId().toInt();
+    logger.debug ( "New patient inserted: " + QString().setNum ( patientUID ) );
+    if (!this->index(ctkDICOMSearch::PatientLevel, patientUID, record))
+      {
+      return -1;
+      }
+    }
+
+  this->Patients.insert(key, patientUID);
+  return patientUID;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::insertStudy(const ctkDICOMIndexerRecord& record, int patientUID)
+{
+  int unused;
+  if (this->Studies.find(record.StudyInstanceUID, unused))
+    {
+    ++this->CacheHits;
+    return true;
+    }
+  ++this->CacheMisses;
+  this->SelectStudy.bindValue ( 0, record.StudyInstanceUID );
+  if (!this->exec(this->SelectStudy))
+    {
+    return false;
+    }
+  const bool exists = this->SelectStudy.next();
+  this->SelectStudy.finish();
+  if (!exists)
+    {
+    this->InsertStudy.bindValue ( 0, record.StudyInstanceUID );
+    this->InsertStudy.bindValue ( 1, patientUID );
+    this->InsertStudy.bindValue ( 2, record.StudyID );
+    this->InsertStudy.bindValue ( 3, QDate::fromString ( record.StudyDate, "yyyyMMdd" ) );
+    this->InsertStudy.bindValue ( 4, record.StudyTime );
+    this->InsertStudy.bindValue ( 5, record.AccessionNumber );
+    this->InsertStudy.bindValue ( 6, record.ModalitiesInStudy );
+    this->InsertStudy.bindValue ( 7, record.InstitutionName );
+    this->InsertStudy.bindValue ( 8, record.ReferringPhysician );
+    this->InsertStudy.bindValue ( 9, record.PerformingPhysiciansName );
+    this->InsertStudy.bindValue ( 10, record.StudyDescription );
+    if (!this->exec(this->InsertStudy) ||
+        !this->index(ctkDICOMSearch::StudyLevel, record.StudyInstanceUID, record))
+      {
+      return false;
+      }
+    }
+  this->Studies.insert(record.StudyInstanceUID, 0);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::insertSeries(const ctkDICOMIndexerRecord& record)
+{
+  int unused;
+  if (this->Series.find(record.SeriesInstanceUID, unused))
+    {
+    ++this->CacheHits;
+    return true;
+    }
+  ++this->CacheMisses;
+  this->SelectSeries.bindValue ( 0, record.SeriesInstanceUID );
+  if (!this->exec(this->SelectSeries))
+    {
+    return false;
+    }
+  const bool exists = this->SelectSeries.next();
+  this->SelectSeries.finish();
+  if (!exists)
+    {
+    this->InsertSeries.bindValue ( 0, record.SeriesInstanceUID );
+    this->InsertSeries.bindValue ( 1, record.StudyInstanceUID );
+    this->InsertSeries.bindValue ( 2, record.SeriesNumber );
+    this->InsertSeries.bindValue ( 3, QDate::fromString ( record.SeriesDate, "yyyyMMdd" ) );
+    this->InsertSeries.bindValue ( 4, record.SeriesTime );
+    this->InsertSeries.bindValue ( 5, record.SeriesDescription );
+    this->InsertSeries.bindValue ( 6, record.BodyPartExamined );
+    this->InsertSeries.bindValue ( 7, record.FrameOfReferenceUID );
+    this->InsertSeries.bindValue ( 8, record.AcquisitionNumber );
+    this->InsertSeries.bindValue ( 9, record.ContrastAgent );
+    this->InsertSeries.bindValue ( 10, record.ScanningSequence );
+    this->InsertSeries.bindValue ( 11, record.EchoNumber );
+    this->InsertSeries.bindValue ( 12, record.TemporalPosition );
+    this->InsertSeries.bindValue ( 13, record.Modality );
+    if (!this->exec(this->InsertSeries) ||
+        !this->index(ctkDICOMSearch::SeriesLevel, record.SeriesInstanceUID, record))
+      {
+      return false;
+      }
+    this->NewSeriesStudies.insert(record.StudyInstanceUID);
+    }
+  this->Series.insert(record.SeriesInstanceUID, 0);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::insertImage(const ctkDICOMIndexerRecord& record)
+{
+  // the image replaces the row of a previous version of the file
+  if (!this->subtractImage(record.Filename))
+    {
+    return false;
+    }
+  ctkDICOMDatabaseWriterDelta& delta = this->SeriesDeltas[record.SeriesInstanceUID];
+  delta.StudyInstanceUID = record.StudyInstanceUID;
+  delta.Instances += 1;
+  delta.Bytes += qMax(record.FileSize, static_cast<qint64>(0));
+
+  this->InsertImage.bindValue ( 0, record.Filename );
+  this->InsertImage.bindValue ( 1, record.SeriesInstanceUID );
+  this->InsertImage.bindValue ( 2, QDateTime::currentDateTime().toString(Qt::ISODate) );
+  // unknown stats are stored as NULL
+  const QVariant unknown(QVariant::LongLong);
+  this->InsertImage.bindValue ( 3, record.FileSize >= 0 ? QVariant(record.FileSize) : unknown );
+  this->InsertImage.bindValue ( 4, record.FileMTime >= 0 ? QVariant(record.FileMTime) : unknown );
+  this->InsertImage.bindValue ( 5, record.Inode >= 0 ? QVariant(record.Inode) : unknown );
+  return this->exec(this->InsertImage);
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::subtractImage(const QString& filename)
+{
+  this->SelectImage.bindValue ( 0, filename );
+  if (!this->exec(this->SelectImage))
+    {
+    return false;
+    }
+  if (this->SelectImage.next())
+    {
+    ctkDICOMDatabaseWriterDelta& delta = this->SeriesDeltas[this->SelectImage.value(0).toString()];
+    delta.Instances -= 1;
+    delta.Bytes -= this->SelectImage.value(1).toLongLong();
+    }
+  this->SelectImage.finish();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::updateAggregates()
+{
+  bool res = true;
+  QSet<QString> studies = this->NewSeriesStudies;
+  QHash<QString, ctkDICOMDatabaseWriterDelta>::const_iterator it;
+  for (it = this->SeriesDeltas.constBegin(); it != this->SeriesDeltas.constEnd(); ++it)
+    {
+    if (it.value().Instances != 0 || it.value().Bytes != 0)
+      {
+      this->UpdateSeries.bindValue ( 0, it.value().Instances );
+      this->UpdateSeries.bindValue ( 1, it.value().Bytes );
+      this->UpdateSeries.bindValue ( 2, it.key() );
+      res = this->exec(this->UpdateSeries) && res;
+      }
+    if (!it.value().StudyInstanceUID.isEmpty())
+      {
+      studies.insert(it.value().StudyInstanceUID);
+      continue;
+      }
+    this->SelectSeriesStudy.bindValue ( 0, it.key() );
+    if (this->exec(this->SelectSeriesStudy) && this->SelectSeriesStudy.next())
+      {
+      studies.insert(this->SelectSeriesStudy.value(0).toString());
+      }
+    this->SelectSeriesStudy.finish();
+    }
+  foreach(const QString& study, studies)
+    {
+    this->RefreshOneStudy.bindValue ( 0, study );
+    res = this->exec(this->RefreshOneStudy) && res;
+    }
+  // the modalities of the studies with new series are searchable
+  if (this->Searchable)
+    {
+    ctkDICOMSearch search(this->Database);
+    foreach(const QString& study, this->NewSeriesStudies)
+      {
+      res = search.reindex(ctkDICOMSearch::StudyLevel, study) && res;
+      }
+    }
+  this->SeriesDeltas.clear();
+  this->NewSeriesStudies.clear();
+  return res;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriterPrivate::index(ctkDICOMSearch::Level level, const QVariant& uid,
+                                          const ctkDICOMIndexerRecord& record)
+{
+  if (!this->Searchable)
+    {
+    return true;
+    }
+  this->InsertSearch.bindValue ( 0, static_cast<int>(level) );
+  this->InsertSearch.bindValue ( 1, uid.toString() );
+  this->InsertSearch.bindValue ( 2, ctkDICOMSearch::indexedText(level, record) );
+  return this->exec(this->InsertSearch);
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMDatabaseWriter methods
+
+//------------------------------------------------------------------------------
+ctkDICOMDatabaseWriter::ctkDICOMDatabaseWriter(QSqlDatabase database)
+{
+  CTK_INIT_PRIVATE(ctkDICOMDatabaseWriter);
+  CTK_D(ctkDICOMDatabaseWriter);
+  d->Database = database;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMDatabaseWriter::~ctkDICOMDatabaseWriter()
+{
+  this->commit();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMDatabaseWriter::setDatabase(QSqlDatabase database)
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  this->commit();
+  d->Database = database;
+  d->Prepared = false;
+  d->clearCache();
+}
+
+//------------------------------------------------------------------------------
+QSqlDatabase ctkDICOMDatabaseWriter::database()const
+{
+  CTK_D(const ctkDICOMDatabaseWriter);
+  return d->Database;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMDatabaseWriter::setBatchSize(int records)
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  d->BatchSize = qMax(records, 1);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMDatabaseWriter::batchSize()const
+{
+  CTK_D(const ctkDICOMDatabaseWriter);
+  return d->BatchSize;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMDatabaseWriter::setBatchInterval(int msecs)
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  d->BatchInterval = qMax(msecs, 0);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMDatabaseWriter::batchInterval()const
+{
+  CTK_D(const ctkDICOMDatabaseWriter);
+  return d->BatchInterval;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMDatabaseWriter::setCacheSize(int entries)
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  d->CacheSize = qMax(entries, 1);
+  d->Patients.Entries.setMaxCost(d->CacheSize);
+  d->Studies.Entries.setMaxCost(d->CacheSize);
+  d->Series.Entries.setMaxCost(d->CacheSize);
+  // shrinking evicts entries, reload to know again if the caches are complete
+  d->clearCache();
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMDatabaseWriter::cacheSize()const
+{
+  CTK_D(const ctkDICOMDatabaseWriter);
+  return d->CacheSize;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMDatabaseWriter::clearCache()
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  d->clearCache();
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMDatabaseWriter::cacheHits()const
+{
+  CTK_D(const ctkDICOMDatabaseWriter);
+  return d->CacheHits;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMDatabaseWriter::cacheMisses()const
+{
+  CTK_D(const ctkDICOMDatabaseWriter);
+  return d->CacheMisses;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMDatabaseWriter::statementCount()const
+{
+  CTK_D(const ctkDICOMDatabaseWriter);
+  return d->StatementCount;
+}
+
+//------------------------------------------------------------------------------
+double ctkDICOMDatabaseWriter::statementMsecs()const
+{
+  CTK_D(const ctkDICOMDatabaseWriter);
+  return d->StatementTime / 1000.;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriter::insert(const ctkDICOMIndexerRecord& record)
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  if (!d->prepare() || !d->preload())
+    {
+    return false;
+    }
+  d->begin();
+
+  bool res = true;
+  int patientUID = -1;
+  if (!record.PatientID.isEmpty() || !record.PatientsName.isEmpty())
+    {
+    patientUID = d->patientUID(record);
+    res = patientUID != -1;
+    }
+  if (res && !record.StudyInstanceUID.isEmpty())
+    {
+    res = d->insertStudy(record, patientUID);
+    }
+  if (res && !record.SeriesInstanceUID.isEmpty())
+    {
+    res = d->insertSeries(record);
+    }
+  if (res && !record.Filename.isEmpty())
+    {
+    res = d->insertImage(record);
+    }
+
+  ++d->PendingCount;
+  return d->commitIfNeeded() && res;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriter::removeImage(const QString& filename)
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  if (!d->prepare())
+    {
+    return false;
+    }
+  d->begin();
+  d->RemoveImage.bindValue ( 0, filename );
+  bool res = d->subtractImage(filename) && d->exec(d->RemoveImage);
+  ++d->PendingCount;
+  return d->commitIfNeeded() && res;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriter::setDirectoryModificationTime(const QString& dirname, qint64 mtime)
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  if (!d->prepare())
+    {
+    return false;
+    }
+  d->begin();
+  d->InsertDirectory.bindValue ( 0, dirname );
+  d->InsertDirectory.bindValue ( 1, mtime >= 0 ? QVariant(mtime) : QVariant(QVariant::LongLong) );
+  bool res = d->exec(d->InsertDirectory);
+  ++d->PendingCount;
+  return d->commitIfNeeded() && res;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriter::removeDirectory(const QString& dirname)
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  if (!d->prepare())
+    {
+    return false;
+    }
+  d->begin();
+  const QString prefix = dirname + "/";
+  // the series of the directory are counted again once its images are
+  // removed, the pending deltas must be applied first
+  bool res = d->updateAggregates();
+  QStringList series;
+  d->SelectDirectorySeries.bindValue ( 0, prefix );
+  d->SelectDirectorySeries.bindValue ( 1, prefix );
+  res = res && d->exec(d->SelectDirectorySeries);
+  while (res && d->SelectDirectorySeries.next())
+    {
+    series << d->SelectDirectorySeries.value(0).toString();
+    }
+  d->SelectDirectorySeries.finish();
+
+  d->RemoveImages.bindValue ( 0, prefix );
+  d->RemoveImages.bindValue ( 1, prefix );
+  d->RemoveDirectories.bindValue ( 0, dirname );
+  d->RemoveDirectories.bindValue ( 1, prefix );
+  d->RemoveDirectories.bindValue ( 2, prefix );
+  res = res && d->exec(d->RemoveImages) && d->exec(d->RemoveDirectories);
+  foreach(const QString& seriesInstanceUID, series)
+    {
+    d->RefreshOneSeries.bindValue ( 0, seriesInstanceUID );
+    res = res && d->exec(d->RefreshOneSeries);
+    // the study is refreshed by the next commit
+    d->SeriesDeltas[seriesInstanceUID];
+    }
+  ++d->PendingCount;
+  return d->commitIfNeeded() && res;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriter::commit()
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  if (!d->InTransaction)
+    {
+    return true;
+    }
+  const bool aggregated = d->updateAggregates();
+  d->InTransaction = false;
+  d->PendingCount = 0;
+  ctkDICOMTimer timer;
+  const bool committed = d->Database.commit();
+  ++d->StatementCount;
+  d->StatementTime += timer.elapsed();
+  if (!committed)
+    {
+    logger.error ( "Error committing transaction: " + d->Database.lastError().text() );
+    d->Database.rollback();
+    // the rows inserted in this transaction are gone
+    d->clearCache();
+    return false;
+    }
+  return aggregated;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriter::refreshAggregates()
+{
+  CTK_D(ctkDICOMDatabaseWriter);
+  if (!d->prepare() || !this->commit())
+    {
+    return false;
+    }
+  d->begin();
+  const bool res = ctkDICOMDatabaseWriter::refreshAggregates(d->Database);
+  return this->commit() && res;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriter::refreshAggregates(QSqlDatabase database)
+{
+  QSqlQuery query(database);
+  const bool res = query.exec(RefreshSeries) && query.exec(RefreshStudies);
+  if (!res)
+    {
+    logger.error ( "Error refreshing the aggregates: " + query.lastError().text() );
+    }
+  return res;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMDatabaseWriter::refreshAggregates(QSqlDatabase database,
+                                               const QString& seriesQuery,
+                                               const QString& studiesQuery)
+{
+  QSqlQuery query(database);
+  const bool res =
+    query.exec(QString(RefreshSeries) + " WHERE SeriesInstanceUID IN ( " + seriesQuery + " )") &&
+    query.exec(QString(RefreshStudies) + " WHERE StudyInstanceUID IN ( " + studiesQuery + " )");
+  if (!res)
+    {
+    logger.error ( "Error refreshing the aggregates: " + query.lastError().text() );
+    }
+  return res;
+}
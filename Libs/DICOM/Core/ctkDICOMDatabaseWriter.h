@@ -0,0 +1,155 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMDatabaseWriter_h
+#define __ctkDICOMDatabaseWriter_h
+
+// Qt includes
+#include <QSqlDatabase>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMCoreExport.h"
+
+struct ctkDICOMIndexerRecord;
+class ctkDICOMDatabaseWriterPrivate;
+
+///
+/// Write patients, studies, series and images in the DICOM database.
+/// The statements are prepared once per database and the inserts are
+/// grouped in transactions that are committed every batchSize() images or
+/// every batchInterval() milliseconds, whichever comes first.
+/// Pending inserts are committed by commit() and by the destructor.
+/// The batch interval is only checked by the writes: a writer left idle
+/// keeps its transaction open, and the database locked, until commit() is
+/// called. A caller writing in bursts must commit once a burst is over,
+/// e.g. ctkDICOMListener commits with a single-shot timer restarted by
+/// each received instance.
+/// The patients, studies and series of the database are cached in memory
+/// so that most inserts don't need to check the database for existing rows.
+/// Rows missing from the cache are always looked up in the database, other
+/// writers on the same connection may have inserted them.
+/// The InstanceCount, TotalBytes, SeriesCount, Modalities and series date
+/// range of the series and studies are updated by the commits, from the
+/// images and series inserted and removed by the writer.
+/// New patients, studies and series are added to the search index of
+/// ctkDICOMSearch if the database has one when the writer prepares its
+/// statements.
+/// The writer must be used from the thread owning the database connection.
+class CTK_DICOM_CORE_EXPORT ctkDICOMDatabaseWriter
+{
+public:
+  explicit ctkDICOMDatabaseWriter(QSqlDatabase database = QSqlDatabase());
+  virtual ~ctkDICOMDatabaseWriter();
+
+  ///
+  /// Set the database to write into. Pending inserts in the previous
+  /// database are committed first.
+  void setDatabase(QSqlDatabase database);
+  QSqlDatabase database()const;
+
+  ///
+  /// Number of inserted records after which the transaction is committed.
+  /// 1 commits every record. Default is 500.
+  void setBatchSize(int records);
+  int batchSize()const;
+
+  ///
+  /// Maximum time in ms an open transaction is kept before being committed
+  /// by the next write, see the class documentation. Default is 1000.
+  void setBatchInterval(int msecs);
+  int batchInterval()const;
+
+  ///
+  /// Maximum number of patients, and of studies and of series, kept in
+  /// the cache. The cache is filled from the database on the first insert.
+  /// Default is 50000.
+  void setCacheSize(int entries);
+  int cacheSize()const;
+
+  ///
+  /// The cache is kept coherent with the inserts of this writer only.
+  /// It must be cleared if rows are removed by other means.
+  void clearCache();
+
+  ///
+  /// Number of patient, study and series lookups answered by the cache
+  int cacheHits()const;
+  ///
+  /// Number of lookups that had to query the database
+  int cacheMisses()const;
+
+  ///
+  /// Number of statements and commits executed by the writer, and the
+  /// time spent executing them, to profile imports
+  int statementCount()const;
+  double statementMsecs()const;
+
+  ///
+  /// Insert the patient, study and series of @param record if they are not
+  /// already in the database, and the image if record.Filename is not
+  /// empty. An existing image row is replaced.
+  /// Return false if a statement failed.
+  bool insert(const ctkDICOMIndexerRecord& record);
+
+  ///
+  /// Remove the image row of @param filename. Patients, studies and series
+  /// left without images are kept.
+  bool removeImage(const QString& filename);
+
+  ///
+  /// Record the modification time (seconds since the epoch, -1 if unknown)
+  /// of a directory whose content is indexed.
+  bool setDirectoryModificationTime(const QString& dirname, qint64 mtime);
+
+  ///
+  /// Remove the images and the recorded modification times of
+  /// @param dirname and of all its subdirectories.
+  bool removeDirectory(const QString& dirname);
+
+  ///
+  /// Commit the pending inserts. Return false if the commit failed.
+  bool commit();
+
+  ///
+  /// Recompute the aggregates of all the series and studies from the
+  /// Images and Series tables, after they were changed by other means.
+  /// Pending inserts are committed first.
+  bool refreshAggregates();
+
+  ///
+  /// Recompute the aggregates of all the series and studies of
+  /// @param database in its current transaction, without committing it.
+  /// Used to update the aggregates in the transaction that removed rows.
+  static bool refreshAggregates(QSqlDatabase database);
+
+  ///
+  /// Recompute the aggregates of the series and studies whose UIDs are
+  /// returned by the SELECT statements @param seriesQuery and
+  /// @param studiesQuery, in the current transaction of @param database.
+  static bool refreshAggregates(QSqlDatabase database, const QString& seriesQuery,
+                                const QString& studiesQuery);
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMDatabaseWriter);
+};
+
+#endif
@@ -0,0 +1,600 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QMutexLocker>
+#include <QThread>
+#include <QTime>
+
+// ctkDICOM includes
+#include "ctkDICOMFrameCache.h"
+#include "ctkDICOMFrameCache_p.h"
+#include "ctkLogger.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcfilefo.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/dcmdata/dcuid.h>
+#if OFFIS_DCMTK_VERSION_NUMBER >= 360
+#include <dcmtk/dcmdata/dcfcache.h>
+#endif
+#include <dcmtk/dcmdata/dcrledrg.h>
+#ifdef CTK_DICOM_HAS_DCMJPEG
+#include <dcmtk/dcmjpeg/djdecode.h>
+#endif
+#ifdef CTK_DICOM_HAS_DCMJPLS
+#include <dcmtk/dcmjpls/djdecode.h>
+#endif
+#include <dcmtk/ofstd/ofcond.h>
+
+// STD includes
+#include <climits>
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMFrameCache" );
+
+namespace
+{
+//------------------------------------------------------------------------------
+/// The DCMTK codec registrations are global and not thread safe
+void registerCodecs()
+{
+  static QMutex mutex;
+  static bool registered = false;
+  QMutexLocker locker(&mutex);
+  if (!registered)
+    {
+#ifdef CTK_DICOM_HAS_DCMJPEG
+    DJDecoderRegistration::registerCodecs();
+#endif
+#ifdef CTK_DICOM_HAS_DCMJPLS
+    DJLSDecoderRegistration::registerCodecs();
+#endif
+    DcmRLEDecoderRegistration::registerCodecs();
+    registered = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+int kilobytes(const QByteArray& pixels)
+{
+  return qMax(1, (pixels.size() + 1023) / 1024);
+}
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMFrameCacheTask::ctkDICOMFrameCacheTask(ctkDICOMFrameCachePrivate* cache,
+                                               int frame, int generation)
+{
+  this->Cache = cache;
+  this->Frame = frame;
+  this->Generation = generation;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCacheTask::run()
+{
+  this->Cache->prefetch(this->Frame, this->Generation);
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMFrameCachePrivate::ctkDICOMFrameCachePrivate()
+{
+  this->MemoryBudget = Q_INT64_C(256) * 1024 * 1024;
+  this->PrefetchRadius = 8;
+  this->Current = -1;
+  this->Generation = 0;
+  this->Cache.setMaxCost(static_cast<int>(this->MemoryBudget / 1024));
+  this->Hits = 0;
+  this->Misses = 0;
+  this->DecodedFrames = 0;
+  this->DecodeMsecs = 0;
+  this->Pool.setMaxThreadCount(QThread::idealThreadCount());
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMFrameCachePrivate::isInPrefetchRange(int k)const
+{
+  return this->Current >= 0 && k >= 0 && k < this->Files.size() &&
+    qAbs(k - this->Current) <= this->PrefetchRadius;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCachePrivate::insert(int k, const ctkDICOMFrame& frame, int msecs)
+{
+  ++this->DecodedFrames;
+  this->DecodeMsecs += msecs;
+  if (!frame.isNull())
+    {
+    // QCache deletes the frame if it is larger than the whole budget
+    this->Cache.insert(k, new ctkDICOMFrame(frame), kilobytes(frame.Pixels));
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCachePrivate::schedule()
+{
+  // nearest first, alternately after and before the current frame
+  for (int distance = 1; distance <= this->PrefetchRadius; ++distance)
+    {
+    for (int side = 0; side < 2; ++side)
+      {
+      const int k = side ? this->Current - distance : this->Current + distance;
+      if (!this->isInPrefetchRange(k) || this->Cache.contains(k) ||
+          this->Pending.contains(k) || this->Running.contains(k))
+        {
+        continue;
+        }
+      this->Pending.insert(k);
+      this->Pool.start(new ctkDICOMFrameCacheTask(this, k, this->Generation));
+      }
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCachePrivate::cancel()
+{
+  this->Pending.clear();
+  ++this->Generation;
+  while (!this->Running.isEmpty())
+    {
+    this->FrameDecoded.wait(&this->Mutex);
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCachePrivate::prefetch(int k, int generation)
+{
+  CTK_P(ctkDICOMFrameCache);
+  QString file;
+  int frameNumber = 0;
+  {
+  QMutexLocker locker(&this->Mutex);
+  if (generation != this->Generation || !this->Pending.remove(k))
+    {
+    return;
+    }
+  if (!this->isInPrefetchRange(k))
+    {
+    return;
+    }
+  this->Running.insert(k);
+  file = this->Files[k];
+  frameNumber = this->Frames[k];
+  }
+
+  QTime time;
+  time.start();
+  QString error;
+  ctkDICOMFrame frame = ctkDICOMFrameCache::decode(file, frameNumber, &error);
+  const int msecs = time.elapsed();
+  if (frame.isNull())
+    {
+    logger.warn("Frame " + QString::number(frameNumber) + " of " + file +
+                " not prefetched: " + error);
+    }
+
+  QMutexLocker locker(&this->Mutex);
+  this->Running.remove(k);
+  if (generation == this->Generation)
+    {
+    this->insert(k, frame, msecs);
+    if (!frame.isNull())
+      {
+      // emitted in the thread of the cache
+      QMetaObject::invokeMethod(p, "frameDecoded", Qt::QueuedConnection, Q_ARG(int, k));
+      }
+    }
+  this->FrameDecoded.wakeAll();
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMFrameCache::ctkDICOMFrameCache(QObject* parent)
+  : QObject(parent)
+{
+  CTK_INIT_PRIVATE(ctkDICOMFrameCache);
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMFrameCache::~ctkDICOMFrameCache()
+{
+  CTK_D(ctkDICOMFrameCache);
+  {
+  QMutexLocker locker(&d->Mutex);
+  d->cancel();
+  }
+  // the dropped tasks still reference the private
+  d->Pool.waitForDone();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCache::setFrames(const QStringList& files, const QList<int>& frames)
+{
+  CTK_D(ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  d->cancel();
+  d->Files = files;
+  d->Frames = frames;
+  while (d->Frames.size() < d->Files.size())
+    {
+    d->Frames << 0;
+    }
+  d->Current = -1;
+  d->Cache.clear();
+  d->Hits = 0;
+  d->Misses = 0;
+  d->DecodedFrames = 0;
+  d->DecodeMsecs = 0;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMFrameCache::frameCount()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->Files.size();
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMFrameCache::filename(int k)const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->Files.value(k);
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCache::setMemoryBudget(qint64 bytes)
+{
+  CTK_D(ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  d->MemoryBudget = qMax(Q_INT64_C(0), bytes);
+  d->Cache.setMaxCost(static_cast<int>(qMin(d->MemoryBudget / 1024, qint64(INT_MAX))));
+}
+
+//------------------------------------------------------------------------------
+qint64 ctkDICOMFrameCache::memoryBudget()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->MemoryBudget;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCache::setPrefetchRadius(int frames)
+{
+  CTK_D(ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  d->PrefetchRadius = qMax(0, frames);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMFrameCache::prefetchRadius()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->PrefetchRadius;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCache::setNumberOfThreads(int threads)
+{
+  CTK_D(ctkDICOMFrameCache);
+  d->Pool.setMaxThreadCount(qMax(1, threads));
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMFrameCache::numberOfThreads()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  return d->Pool.maxThreadCount();
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMFrameCache::currentFrame()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->Current;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCache::setCurrentFrame(int k)
+{
+  CTK_D(ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  if (k < 0 || k >= d->Files.size())
+    {
+    return;
+    }
+  d->Current = k;
+  // the tasks of the dropped frames return as soon as they run
+  QSet<int> pending = d->Pending;
+  foreach(int queued, pending)
+    {
+    if (!d->isInPrefetchRange(queued))
+      {
+      d->Pending.remove(queued);
+      }
+    }
+  d->schedule();
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMFrame ctkDICOMFrameCache::frame(int k)
+{
+  CTK_D(ctkDICOMFrameCache);
+  QString file;
+  int frameNumber = 0;
+  int generation = 0;
+  {
+  QMutexLocker locker(&d->Mutex);
+  if (k < 0 || k >= d->Files.size())
+    {
+    return ctkDICOMFrame();
+    }
+  while (d->Running.contains(k))
+    {
+    d->FrameDecoded.wait(&d->Mutex);
+    }
+  if (ctkDICOMFrame* cached = d->Cache.object(k))
+    {
+    ++d->Hits;
+    return *cached;
+    }
+  ++d->Misses;
+  // a queued prefetch of the frame is dropped, it is decoded here
+  d->Pending.remove(k);
+  file = d->Files[k];
+  frameNumber = d->Frames[k];
+  generation = d->Generation;
+  }
+
+  QTime time;
+  time.start();
+  QString error;
+  ctkDICOMFrame frame = ctkDICOMFrameCache::decode(file, frameNumber, &error);
+  if (frame.isNull())
+    {
+    logger.error("Frame " + QString::number(frameNumber) + " of " + file +
+                 " not decoded: " + error);
+    }
+  QMutexLocker locker(&d->Mutex);
+  if (generation == d->Generation)
+    {
+    d->insert(k, frame, time.elapsed());
+    }
+  return frame;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMFrameCache::isCached(int k)const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->Cache.contains(k);
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCache::clear()
+{
+  CTK_D(ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  d->Cache.clear();
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMFrameCache::hits()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->Hits;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMFrameCache::misses()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->Misses;
+}
+
+//------------------------------------------------------------------------------
+double ctkDICOMFrameCache::hitRate()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  const int calls = d->Hits + d->Misses;
+  return calls ? static_cast<double>(d->Hits) / calls : 0.;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMFrameCache::decodedFrames()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->DecodedFrames;
+}
+
+//------------------------------------------------------------------------------
+qint64 ctkDICOMFrameCache::decodeMsecs()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->DecodeMsecs;
+}
+
+//------------------------------------------------------------------------------
+double ctkDICOMFrameCache::meanDecodeMsecs()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return d->DecodedFrames ?
+    static_cast<double>(d->DecodeMsecs) / d->DecodedFrames : 0.;
+}
+
+//------------------------------------------------------------------------------
+qint64 ctkDICOMFrameCache::residentBytes()const
+{
+  CTK_D(const ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  return qint64(d->Cache.totalCost()) * 1024;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMFrameCache::resetStatistics()
+{
+  CTK_D(ctkDICOMFrameCache);
+  QMutexLocker locker(&d->Mutex);
+  d->Hits = 0;
+  d->Misses = 0;
+  d->DecodedFrames = 0;
+  d->DecodeMsecs = 0;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMFrame ctkDICOMFrameCache::decode(const QString& file, int frameNumber,
+                                         QString* error)
+{
+  registerCodecs();
+  ctkDICOMFrame frame;
+  QString message;
+  DcmFileFormat fileformat;
+  // the pixel data is left in the file, getUncompressedFrame() reads the
+  // fragments of the frame only
+  OFCondition status = fileformat.loadFile(file.toLocal8Bit().constData(),
+                                           EXS_Unknown, EGL_noChange, 4096);
+  DcmDataset* dataset = fileformat.getDataset();
+  DcmElement* pixelData = 0;
+  Uint16 rows = 0, columns = 0, samples = 1, bits = 0, representation = 0;
+  Sint32 frames = 1;
+  if (!status.good())
+    {
+    message = status.text();
+    }
+  else if (!dataset->findAndGetElement(DCM_PixelData, pixelData).good() ||
+           !dataset->findAndGetUint16(DCM_Rows, rows).good() ||
+           !dataset->findAndGetUint16(DCM_Columns, columns).good() ||
+           !dataset->findAndGetUint16(DCM_BitsAllocated, bits).good())
+    {
+    message = "no pixel data";
+    }
+  else
+    {
+    dataset->findAndGetUint16(DCM_SamplesPerPixel, samples);
+    dataset->findAndGetUint16(DCM_PixelRepresentation, representation);
+    dataset->findAndGetSint32(DCM_NumberOfFrames, frames);
+    }
+  if (message.isEmpty() && (frameNumber < 0 || frameNumber >= qMax(1, int(frames))))
+    {
+    message = "no frame " + QString::number(frameNumber);
+    }
+
+#if OFFIS_DCMTK_VERSION_NUMBER >= 360
+  Uint32 frameSize = 0;
+  if (message.isEmpty())
+    {
+    status = pixelData->getUncompressedFrameSize(dataset, frameSize);
+    if (!status.good() || frameSize == 0)
+      {
+      message = status.good() ? "empty frame" : status.text();
+      }
+    }
+  if (message.isEmpty())
+    {
+    frame.Pixels.resize(static_cast<int>(frameSize));
+    Uint32 startFragment = 0;
+    OFString colorModel;
+    DcmFileCache fileCache;
+    status = pixelData->getUncompressedFrame(dataset, static_cast<Uint32>(frameNumber),
+                                             startFragment,
+                                             frame.Pixels.data(), frameSize,
+                                             colorModel, &fileCache);
+    if (!status.good())
+      {
+      message = status.text();
+      frame.Pixels.clear();
+      }
+    else
+      {
+      frame.ColorModel = colorModel.c_str();
+      }
+    }
+#else
+  // Older DCMTK decodes the frames all at once, then the frame is copied
+  const Uint32 frameSize = Uint32(rows) * columns * samples * (bits / 8);
+  if (message.isEmpty())
+    {
+    status = dataset->chooseRepresentation(EXS_LittleEndianExplicit, NULL);
+    Uint8* bytes = 0;
+    if (status.good() && pixelData->getUint8Array(bytes).bad())
+      {
+      Uint16* words = 0;
+      status = pixelData->getUint16Array(words);
+      bytes = reinterpret_cast<Uint8*>(words);
+      }
+    if (!status.good() || !bytes)
+      {
+      message = status.good() ? "no pixel data" : status.text();
+      }
+    else if (frameSize == 0 ||
+             pixelData->getLength() < (Uint32(frameNumber) + 1) * frameSize)
+      {
+      message = "empty frame";
+      }
+    else
+      {
+      frame.Pixels = QByteArray(reinterpret_cast<const char*>(bytes) +
+                                Uint32(frameNumber) * frameSize,
+                                static_cast<int>(frameSize));
+      }
+    }
+#endif
+  if (!message.isEmpty())
+    {
+    if (error)
+      {
+      *error = message;
+      }
+    return frame;
+    }
+
+  // the frame size is rounded up to an even number of bytes
+  frame.Rows = rows;
+  frame.Columns = columns;
+  frame.SamplesPerPixel = samples;
+  frame.BitsAllocated = bits;
+  frame.Signed = representation == 1;
+  const int size = rows * columns * samples * (bits / 8);
+  if (size > 0 && size < frame.Pixels.size())
+    {
+    frame.Pixels.truncate(size);
+    }
+  if (frame.ColorModel.isEmpty())
+    {
+    OFString photometric;
+    dataset->findAndGetOFString(DCM_PhotometricInterpretation, photometric);
+    frame.ColorModel = photometric.c_str();
+    }
+  return frame;
+}
@@ -0,0 +1,158 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMFrameCache_h
+#define __ctkDICOMFrameCache_h
+
+// Qt includes
+#include <QByteArray>
+#include <QList>
+#include <QObject>
+#include <QStringList>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMCoreExport.h"
+
+class ctkDICOMFrameCachePrivate;
+
+///
+/// Decoded pixels of one frame. Pixels is implicitly shared with the
+/// cache: copies are cheap and stay valid after the frame is evicted.
+struct CTK_DICOM_CORE_EXPORT ctkDICOMFrame
+{
+  ctkDICOMFrame() : Rows(0), Columns(0), SamplesPerPixel(0),
+                    BitsAllocated(0), Signed(false) {}
+  /// True if the frame could not be decoded
+  bool isNull()const { return this->Pixels.isEmpty(); }
+
+  /// Rows * Columns * SamplesPerPixel values of BitsAllocated bits, in the
+  /// byte order of the machine
+  QByteArray Pixels;
+  int        Rows;
+  int        Columns;
+  int        SamplesPerPixel;
+  int        BitsAllocated;
+  bool       Signed;
+  /// Photometric interpretation of the decoded pixels, e.g. RGB for a
+  /// YBR_FULL_422 JPEG
+  QString    ColorModel;
+};
+
+///
+/// Cache of decoded frames of a series, for scrolling through compressed
+/// instances (JPEG, JPEG-LS, RLE) without decoding each frame on display.
+/// The JPEG and JPEG-LS instances are only decoded if DCMTK was built with
+/// dcmjpeg and dcmjpls respectively.
+/// The frames are given in display order by setFrames(). setCurrentFrame()
+/// decodes the frames around the current one in a thread pool, nearest
+/// first and alternately after and before it. The least recently used
+/// frames are evicted once memoryBudget() is exceeded.
+/// frameDecoded() is emitted in the thread of the cache when a prefetched
+/// frame is available, e.g. to refresh a view showing it.
+class CTK_DICOM_CORE_EXPORT ctkDICOMFrameCache : public QObject
+{
+  Q_OBJECT
+  Q_PROPERTY(qint64 memoryBudget READ memoryBudget WRITE setMemoryBudget);
+  Q_PROPERTY(int prefetchRadius READ prefetchRadius WRITE setPrefetchRadius);
+  Q_PROPERTY(int numberOfThreads READ numberOfThreads WRITE setNumberOfThreads);
+  Q_PROPERTY(int currentFrame READ currentFrame WRITE setCurrentFrame);
+public:
+  explicit ctkDICOMFrameCache(QObject* parent = 0);
+  virtual ~ctkDICOMFrameCache();
+
+  ///
+  /// Frames of the series in display order: the frames[k]-th frame of
+  /// files[k], the first frame of each file if frames is empty.
+  /// Clear the cache and the statistics.
+  void setFrames(const QStringList& files, const QList<int>& frames = QList<int>());
+  int frameCount()const;
+  QString filename(int k)const;
+
+  ///
+  /// Bytes of decoded pixels kept in memory. Default is 256MB.
+  void setMemoryBudget(qint64 bytes);
+  qint64 memoryBudget()const;
+
+  ///
+  /// Number of frames decoded ahead on each side of the current frame.
+  /// Default is 8.
+  void setPrefetchRadius(int frames);
+  int prefetchRadius()const;
+
+  ///
+  /// Number of threads decoding the prefetched frames.
+  /// Default is QThread::idealThreadCount().
+  void setNumberOfThreads(int threads);
+  int numberOfThreads()const;
+
+  int currentFrame()const;
+
+  ///
+  /// Decoded k-th frame. If it is not cached it is decoded in the calling
+  /// thread, or awaited if a prefetch is decoding it.
+  /// Does not change the current frame.
+  ctkDICOMFrame frame(int k);
+  bool isCached(int k)const;
+
+  ///
+  /// Evict all the frames, the statistics are kept
+  void clear();
+
+  ///
+  /// Calls to frame() that found the frame decoded
+  int hits()const;
+  int misses()const;
+  /// hits / (hits + misses), 0 without calls
+  double hitRate()const;
+  ///
+  /// Frames decoded, prefetched or not, and the total and mean time
+  /// spent decoding them in all the threads
+  int decodedFrames()const;
+  qint64 decodeMsecs()const;
+  double meanDecodeMsecs()const;
+  ///
+  /// Bytes of decoded pixels in memory, rounded up to the KB per frame
+  qint64 residentBytes()const;
+  void resetStatistics();
+
+  ///
+  /// Decode a frame in the calling thread. The uncompressed, RLE, JPEG and
+  /// JPEG-LS transfer syntaxes are supported, see the class documentation.
+  /// With DCMTK 3.6.0 or later only the fragments of the frame are read,
+  /// older versions decode all the frames of the file.
+  static ctkDICOMFrame decode(const QString& file, int frame, QString* error = 0);
+
+public slots:
+  ///
+  /// Prefetch the frames around @param k, typically connected to the
+  /// slider of a viewer. Pending prefetches of frames out of the new range
+  /// are dropped.
+  void setCurrentFrame(int k);
+
+signals:
+  void frameDecoded(int k);
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMFrameCache);
+};
+
+#endif
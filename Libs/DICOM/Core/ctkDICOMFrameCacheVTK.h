@@ -0,0 +1,81 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMFrameCacheVTK_h
+#define __ctkDICOMFrameCacheVTK_h
+
+/// Header only: CTKDICOMCore doesn't depend on VTK, applications linking
+/// with VTK include this file to show cached frames, e.g. with
+/// ctkVTKSliceView::setImageData() on ctkDICOMFrameCache::frameDecoded().
+
+// CTK includes
+#include "ctkDICOMFrameCache.h"
+
+// VTK includes
+#include <vtkDataArray.h>
+#include <vtkImageData.h>
+#include <vtkPointData.h>
+#include <vtkType.h>
+
+// STD includes
+#include <cstring>
+
+///
+/// Set @param imageData to a single slice image of the pixels of
+/// @param frame. The pixels are copied: the frame can be evicted from the
+/// cache while the image is shown.
+/// Return false if the frame is null.
+inline bool ctkDICOMFrameToImageData(const ctkDICOMFrame& frame,
+                                     vtkImageData* imageData)
+{
+  if (frame.isNull() || !imageData)
+    {
+    return false;
+    }
+  int scalarType = VTK_UNSIGNED_SHORT;
+  switch (frame.BitsAllocated)
+    {
+    case 8:
+      scalarType = frame.Signed ? VTK_SIGNED_CHAR : VTK_UNSIGNED_CHAR;
+      break;
+    case 16:
+      scalarType = frame.Signed ? VTK_SHORT : VTK_UNSIGNED_SHORT;
+      break;
+    case 32:
+      scalarType = frame.Signed ? VTK_INT : VTK_UNSIGNED_INT;
+      break;
+    }
+  imageData->SetDimensions(frame.Columns, frame.Rows, 1);
+  imageData->SetScalarType(scalarType);
+  imageData->SetNumberOfScalarComponents(frame.SamplesPerPixel);
+
+  vtkDataArray* scalars = vtkDataArray::CreateDataArray(scalarType);
+  scalars->SetNumberOfComponents(frame.SamplesPerPixel);
+  scalars->SetNumberOfTuples(static_cast<vtkIdType>(frame.Columns) * frame.Rows);
+  const int size = frame.Columns * frame.Rows * frame.SamplesPerPixel *
+    (frame.BitsAllocated / 8);
+  std::memcpy(scalars->GetVoidPointer(0), frame.Pixels.constData(),
+              qMin(size, frame.Pixels.size()));
+  imageData->GetPointData()->SetScalars(scalars);
+  scalars->Delete();
+  return true;
+}
+
+#endif
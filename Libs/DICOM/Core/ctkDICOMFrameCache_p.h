@@ -0,0 +1,95 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMFrameCache_p_h
+#define __ctkDICOMFrameCache_p_h
+
+// Qt includes
+#include <QCache>
+#include <QMutex>
+#include <QRunnable>
+#include <QSet>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+// ctkDICOM includes
+#include "ctkDICOMFrameCache.h"
+
+class ctkDICOMFrameCachePrivate;
+
+//------------------------------------------------------------------------------
+/// Prefetch of one frame. The task is dropped if the frame was taken out of
+/// the pending frames before it runs: decoded by frame(), out of the
+/// prefetch range or part of a previous series.
+class ctkDICOMFrameCacheTask : public QRunnable
+{
+public:
+  ctkDICOMFrameCacheTask(ctkDICOMFrameCachePrivate* cache, int frame, int generation);
+  virtual void run();
+
+private:
+  ctkDICOMFrameCachePrivate* Cache;
+  int Frame;
+  int Generation;
+};
+
+//------------------------------------------------------------------------------
+class ctkDICOMFrameCachePrivate: public ctkPrivate<ctkDICOMFrameCache>
+{
+public:
+  ctkDICOMFrameCachePrivate();
+
+  /// Decode a queued frame, called by the tasks
+  void prefetch(int k, int generation);
+
+  /// The following methods are called with Mutex locked
+  bool isInPrefetchRange(int k)const;
+  void insert(int k, const ctkDICOMFrame& frame, int msecs);
+  /// Queue the frames around Current that are neither cached nor queued
+  void schedule();
+  /// Drop the queued frames and wait for the running ones
+  void cancel();
+
+  QStringList Files;
+  QList<int>  Frames;
+  qint64      MemoryBudget;
+  int         PrefetchRadius;
+  int         Current;
+  /// Incremented by setFrames() so that the running tasks of the previous
+  /// series don't insert their frames
+  int         Generation;
+
+  mutable QMutex Mutex;
+  QWaitCondition FrameDecoded;
+  /// Cost of the frames in KB, QCache costs are int
+  QCache<int, ctkDICOMFrame> Cache;
+  /// Frames queued in the pool and frames being decoded by a task
+  QSet<int> Pending;
+  QSet<int> Running;
+
+  int    Hits;
+  int    Misses;
+  int    DecodedFrames;
+  qint64 DecodeMsecs;
+
+  QThreadPool Pool;
+};
+
+#endif
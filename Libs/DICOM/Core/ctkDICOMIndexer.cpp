@@ -20,416 +20,755 @@
 
 // Qt includes
 #include <QSqlQuery>
-#include <QSqlRecord>
 #include <QVariant>
 #include <QDate>
 #include <QStringList>
 #include <QSet>
 #include <QFile>
+#include <QDir>
 #include <QDirIterator>
 #include <QFileInfo>
+#include <QThread>
+#include <QThreadPool>
 #include <QDebug>
 
 // ctkDICOM includes
 #include "ctkDICOMIndexer.h"
+#include "ctkDICOMIndexer_p.h"
+#include "ctkDICOMTimer_p.h"
+#include "ctkLogger.h"
 
 // DCMTK includes
 #ifndef WIN32
   #define HAVE_CONFIG_H 
 #endif
 #include <dcmtk/dcmdata/dcfilefo.h>
-#include <dcmtk/dcmdata/dcfilefo.h>
 #include <dcmtk/dcmdata/dcdeftag.h>
 #include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/dcmdata/dcuid.h>
 #include <dcmtk/ofstd/ofcond.h>
 #include <dcmtk/ofstd/ofstring.h>
-#include <dcmtk/ofstd/ofstd.h>        /* for class OFStandard */
-#include <dcmtk/dcmdata/dcddirif.h>   /* for class DicomDirInterface */
 
-#define MITK_ERROR std::cout
-#define MITK_INFO std::cout
+#ifdef Q_OS_UNIX
+#include <sys/resource.h>
+#include <sys/stat.h>
+#endif
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMIndexer" );
+
+/// In HeaderOnly mode, values longer than this are not loaded in memory,
+/// DCMTK reads them from the file if they are accessed.
+static const Uint32 HeaderOnlyMaxReadLength = 4096;
 
+namespace
+{
 //------------------------------------------------------------------------------
-class ctkDICOMIndexerPrivate: public ctkPrivate<ctkDICOMIndexer>
+/// Bytes read by the calling thread since it started, -1 if unknown
+qint64 threadBytesRead()
 {
-public:
-  ctkDICOMIndexerPrivate();
-  ~ctkDICOMIndexerPrivate();
+#ifdef Q_OS_LINUX
+  QFile io("/proc/thread-self/io");
+  if (io.open(QIODevice::ReadOnly))
+    {
+    // the first line is "rchar: <bytes>"
+    QList<QByteArray> fields = io.readLine().simplified().split(' ');
+    if (fields.size() == 2 && fields[0] == "rchar:")
+      {
+      return fields[1].toLongLong();
+      }
+    }
+#endif
+  return -1;
+}
 
-};
+//------------------------------------------------------------------------------
+/// Directory containing @param path, paths use '/' on all platforms
+QString parentPath(const QString& path)
+{
+  const int slash = path.lastIndexOf('/');
+  return slash > 0 ? path.left(slash) : QString("/");
+}
 
 //------------------------------------------------------------------------------
-// ctkDICOMIndexerPrivate methods
+/// Peak resident set size of the process in bytes, -1 if unknown
+qint64 peakResidentSetSize()
+{
+#ifdef Q_OS_UNIX
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+# ifdef Q_OS_MAC
+    return static_cast<qint64>(usage.ru_maxrss);
+# else
+    return static_cast<qint64>(usage.ru_maxrss) * 1024;
+# endif
+    }
+#endif
+  return -1;
+}
 
 //------------------------------------------------------------------------------
-ctkDICOMIndexerPrivate::ctkDICOMIndexerPrivate()
+OFCondition loadFile(DcmFileFormat& fileformat, const QString& filePath,
+                     ctkDICOMIndexer::ParsingMode mode)
 {
+  const QByteArray fileName = filePath.toLocal8Bit();
+  if (mode == ctkDICOMIndexer::FullDataset)
+    {
+    return fileformat.loadFile(fileName.constData());
+    }
+#if OFFIS_DCMTK_VERSION_NUMBER >= 361
+  return fileformat.loadFileUntilTag(fileName.constData(), EXS_Unknown,
+    EGL_noChange, HeaderOnlyMaxReadLength, ERM_autoDetect, DCM_PixelData);
+#else
+  // Older DCMTK can't stop the parsing: the pixel data element is still
+  // visited but, as any large value, it is skipped instead of being read.
+  return fileformat.loadFile(fileName.constData(), EXS_Unknown,
+    EGL_noChange, HeaderOnlyMaxReadLength, ERM_autoDetect);
+#endif
+}
 }
 
 //------------------------------------------------------------------------------
-ctkDICOMIndexerPrivate::~ctkDICOMIndexerPrivate()
+ctkDICOMIndexer::Statistics::Statistics()
 {
+  this->FilesParsed = 0;
+  this->BytesRead = 0;
+  this->MaxBytesReadPerFile = 0;
+  this->PeakResidentSetSize = -1;
+  this->CacheHits = 0;
+  this->CacheMisses = 0;
+  this->FilesSkipped = 0;
+  this->FilesRemoved = 0;
+  this->DirectoriesSkipped = 0;
+  this->DirectoriesRemoved = 0;
+  this->FilesIndexed = 0;
+  this->TotalMsecs = 0.;
+  this->ScanMsecs = 0.;
+  this->ParseMsecs = 0.;
+  this->DatabaseMsecs = 0.;
+  this->StorageMsecs = 0.;
+  this->SqlStatements = 0;
+  this->SqlMsecs = 0.;
 }
 
 //------------------------------------------------------------------------------
-// ctkDICOMIndexer methods
+// ctkDICOMIndexerFileStat methods
 
 //------------------------------------------------------------------------------
-ctkDICOMIndexer::ctkDICOMIndexer()
+bool ctkDICOMIndexerFileStat::read(const QString& path)
 {
+#ifdef Q_OS_UNIX
+  struct stat info;
+  if (::stat(QFile::encodeName(path).constData(), &info) != 0)
+    {
+    return false;
+    }
+  this->Size = static_cast<qint64>(info.st_size);
+  this->MTime = static_cast<qint64>(info.st_mtime);
+  this->Inode = static_cast<qint64>(info.st_ino);
+#else
+  QFileInfo info(path);
+  if (!info.exists())
+    {
+    return false;
+    }
+  this->Size = info.size();
+  this->MTime = static_cast<qint64>(info.lastModified().toTime_t());
+  this->Inode = -1;
+#endif
+  return true;
 }
 
 //------------------------------------------------------------------------------
-ctkDICOMIndexer::~ctkDICOMIndexer()
+// ctkDICOMIndexerPipeline methods
+
+//------------------------------------------------------------------------------
+ctkDICOMIndexerPipeline::ctkDICOMIndexerPipeline(int queueSize, int parserCount,
+                                                 ctkDICOMIndexer::ParsingMode mode)
+  : ParsingMode(mode)
+  , Files(queueSize, 1)
+  , Parsed(queueSize, parserCount)
 {
 }
 
 //------------------------------------------------------------------------------
-void ctkDICOMIndexer::addDirectory(QSqlDatabase database, const QString& directoryName,const QString& destinationDirectoryName)
+void ctkDICOMIndexerPipeline::addParsedFile(qint64 bytes, qint64 microseconds)
 {
-  QSqlDatabase db = database;
-  const std::string src_directory(directoryName.toStdString());
-
-  OFList<OFString> originalDcmtkFileNames;
-  OFList<OFString> dcmtkFileNames;
-  OFStandard::searchDirectoryRecursively( src_directory.c_str(), originalDcmtkFileNames, "", "");
-
-  // hack to reverse list of filenames (not neccessary when image loading works correctly)
-  for ( OFListIterator(OFString) iter = originalDcmtkFileNames.begin(); iter != originalDcmtkFileNames.end(); ++iter )
-  {
-    dcmtkFileNames.push_front( *iter );
-  }
-
-  DcmFileFormat fileformat;
-
-  OFListIterator(OFString) iter = dcmtkFileNames.begin();
-  OFListIterator(OFString) last = dcmtkFileNames.end();
-
-  if(iter == last) return;
-
-  QSqlQuery query(database);
-
-
-  /// these are for optimizing the import of image sequences
-  /// since most information are identical for all slices
-  OFString lastPatientID = "";
-  OFString lastPatientsName = "";
-  OFString lastPatientsBirthDate = "";
-  OFString lastStudyInstanceUID = "";
-  OFString lastSeriesInstanceUID = "";
-  int lastPatientUID = -1;
-
-  /* iterate over all input filenames */
-  while (iter != last)
-  {
-    std::string filename((*iter).c_str());
-    QString qfilename(filename.c_str()); 
-    /// first we check if the file is already in the database
-    QSqlQuery fileExists(database);
-    fileExists.prepare("SELECT InsertTimestamp FROM Images WHERE Filename == ?"); 
-    fileExists.bindValue(0,qfilename);
-    fileExists.exec();
-    if (
-      fileExists.next() && 
-      QFileInfo(qfilename).lastModified() < QDateTime::fromString(fileExists.value(0).toString(),Qt::ISODate)      
-      )
-      {
-      MITK_INFO << "File " << filename << " already added.";
-      continue;
-      }
-
-    MITK_INFO << filename << "\n";
-    OFCondition status = fileformat.loadFile(filename.c_str());
-    ++iter;
-
-    if (!status.good())
+  QMutexLocker locker(&this->StatisticsMutex);
+  ++this->Statistics.FilesParsed;
+  this->Statistics.ParseMsecs += microseconds / 1000.;
+  if (bytes < 0 || this->Statistics.BytesRead < 0)
     {
-      MITK_ERROR << "Could not load " << filename << "\nDCMTK says: " << status.text();
-      continue;
+    this->Statistics.BytesRead = -1;
+    this->Statistics.MaxBytesReadPerFile = -1;
+    return;
     }
+  this->Statistics.BytesRead += bytes;
+  this->Statistics.MaxBytesReadPerFile =
+    qMax(this->Statistics.MaxBytesReadPerFile, bytes);
+}
 
-    OFString patientsName, patientID, patientsBirthDate, patientsBirthTime, patientsSex,
-      patientComments, patientsAge;
-
-    OFString studyInstanceUID, studyID, studyDate, studyTime,
-      accessionNumber, modalitiesInStudy, institutionName, performingPhysiciansName, referringPhysician, studyDescription;
-
-    OFString seriesInstanceUID, seriesDate, seriesTime,
-      seriesDescription, bodyPartExamined, frameOfReferenceUID,
-      contrastAgent, scanningSequence;
-    OFString instanceNumber;
-
-    Sint32 seriesNumber = 0, acquisitionNumber = 0, echoNumber = 0, temporalPosition = 0;
+//------------------------------------------------------------------------------
+// ctkDICOMIndexerScanTask methods
 
-    //The patient UID is a unique number within the database, generated by the sqlite autoincrement
-    int patientUID = -1;
+//------------------------------------------------------------------------------
+ctkDICOMIndexerScanTask::ctkDICOMIndexerScanTask(ctkDICOMIndexerPipeline* pipeline,
+                                                 const QString& directory,
+                                                 const QAtomicInt* canceled)
+  : Pipeline(pipeline), Directory(directory), Canceled(canceled)
+{
+}
 
-    //If the following fields can not be evaluated, cancel evaluation of the DICOM file
-    if (!fileformat.getDataset()->findAndGetOFString(DCM_PatientsName, patientsName).good())
+//------------------------------------------------------------------------------
+bool ctkDICOMIndexerScanTask::queue(ctkDICOMIndexerScannedFile& file,
+                                    qint64 recentTime, qint64& blockedTime)
+{
+  QHash<QString, ctkDICOMIndexerFileStat>::const_iterator indexed =
+    this->Pipeline->IndexedFiles.find(file.Path);
+  if (indexed != this->Pipeline->IndexedFiles.end() &&
+      (indexed.value().Size < 0 ? file.Stat.MTime < indexed.value().MTime :
+                                  indexed.value() == file.Stat))
     {
-      MITK_ERROR << "Could not read DCM_PatientsName from " << filename;
-      continue;
+    this->Pipeline->SkippedCount.ref();
+    return true;
     }
-
-    if (!fileformat.getDataset()->findAndGetOFString(DCM_StudyInstanceUID, studyInstanceUID).good())
+  if (file.Stat.MTime >= recentTime)
     {
-      MITK_ERROR << "Could not read DCM_StudyInstanceUID from " << filename;
-      continue;
+    file.Stat.MTime = -1;
+    }
+  ctkDICOMTimer pushTimer;
+  const bool pushed = this->Pipeline->Files.push(file);
+  blockedTime += pushTimer.elapsed();
+  if (!pushed)
+    {
+    return false;
     }
+  this->Pipeline->ScannedCount.ref();
+  return true;
+}
 
-    if (!fileformat.getDataset()->findAndGetOFString(DCM_SeriesInstanceUID, seriesInstanceUID).good())
+//------------------------------------------------------------------------------
+void ctkDICOMIndexerScanTask::run()
+{
+  ctkDICOMTimer timer;
+  qint64 blockedTime = 0;
+  // A file or directory modified during the last second may be modified
+  // again within the same second, it must be checked again next time
+  const qint64 recentTime = static_cast<qint64>(QDateTime::currentDateTime().toTime_t()) - 1;
+
+  for (QHash<QString, ctkDICOMIndexerFileStat>::const_iterator it =
+         this->Pipeline->IndexedFiles.begin();
+       it != this->Pipeline->IndexedFiles.end(); ++it)
     {
-      MITK_ERROR << "Could not read DCM_SeriesInstanceUID from " << filename;
-      continue;
+    this->KnownFiles[parentPath(it.key())].append(it.key());
     }
-    if (!fileformat.getDataset()->findAndGetOFString(DCM_InstanceNumber, instanceNumber).good())
+  for (QHash<QString, qint64>::const_iterator it =
+         this->Pipeline->IndexedDirectories.begin();
+       it != this->Pipeline->IndexedDirectories.end(); ++it)
     {
-      MITK_ERROR << "Could not read DCM_InstanceNumber from " << filename;
-      continue;
+    this->KnownDirectories[parentPath(it.key())].append(it.key());
     }
 
-
-    fileformat.getDataset()->findAndGetOFString(DCM_PatientID, patientID);
-    fileformat.getDataset()->findAndGetOFString(DCM_PatientsBirthDate, patientsBirthDate);
-    fileformat.getDataset()->findAndGetOFString(DCM_PatientsBirthTime, patientsBirthTime);
-    fileformat.getDataset()->findAndGetOFString(DCM_PatientsSex, patientsSex);
-    fileformat.getDataset()->findAndGetOFString(DCM_PatientsAge, patientsAge);
-    fileformat.getDataset()->findAndGetOFString(DCM_PatientComments, patientComments);
-    fileformat.getDataset()->findAndGetOFString(DCM_StudyID, studyID);
-    fileformat.getDataset()->findAndGetOFString(DCM_StudyDate, studyDate);
-    fileformat.getDataset()->findAndGetOFString(DCM_StudyTime, studyTime);
-    fileformat.getDataset()->findAndGetOFString(DCM_AccessionNumber, accessionNumber);
-    fileformat.getDataset()->findAndGetOFString(DCM_ModalitiesInStudy, modalitiesInStudy);
-    fileformat.getDataset()->findAndGetOFString(DCM_InstitutionName, institutionName);
-    fileformat.getDataset()->findAndGetOFString(DCM_PerformingPhysiciansName, performingPhysiciansName);
-    fileformat.getDataset()->findAndGetOFString(DCM_ReferringPhysiciansName, referringPhysician);
-    fileformat.getDataset()->findAndGetOFString(DCM_StudyDescription, studyDescription);
-
-    fileformat.getDataset()->findAndGetOFString(DCM_SeriesDate, seriesDate);
-    fileformat.getDataset()->findAndGetOFString(DCM_SeriesTime, seriesTime);
-    fileformat.getDataset()->findAndGetOFString(DCM_SeriesDescription, seriesDescription);
-    fileformat.getDataset()->findAndGetOFString(DCM_BodyPartExamined, bodyPartExamined);
-    fileformat.getDataset()->findAndGetOFString(DCM_FrameOfReferenceUID, frameOfReferenceUID);
-    fileformat.getDataset()->findAndGetOFString(DCM_ContrastBolusAgent, contrastAgent);
-    fileformat.getDataset()->findAndGetOFString(DCM_ScanningSequence, scanningSequence);
-
-    fileformat.getDataset()->findAndGetSint32(DCM_SeriesNumber, seriesNumber);
-    fileformat.getDataset()->findAndGetSint32(DCM_AcquisitionNumber, acquisitionNumber);
-    fileformat.getDataset()->findAndGetSint32(DCM_EchoNumbers, echoNumber);
-    fileformat.getDataset()->findAndGetSint32(DCM_TemporalPositionIdentifier, temporalPosition);
-
-    MITK_INFO << "Adding new items to database:";
-    MITK_INFO << "studyID: " << studyID;
-    MITK_INFO << "seriesInstanceUID: " << seriesInstanceUID;
-    MITK_INFO << "Patient's Name: " << patientsName;
-
-    //-----------------------
-    //Add Patient to Database
-    //-----------------------
-
-    //Speed up: Check if patient is the same as in last file; very probable, as all images belonging to a study have the same patient
-    bool patientExists = false;
-    if(lastPatientID.compare(patientID) || lastPatientsBirthDate.compare(patientsBirthDate) || lastPatientsName.compare(patientsName))
+  bool aborted = false;
+  QStringList pending;
+  pending << QDir(this->Directory).absolutePath();
+  while (!pending.isEmpty() && !aborted && !*this->Canceled)
     {
-      //Check if patient is already present in the db
-      QSqlQuery check_exists_query(database);
-      std::stringstream check_exists_query_string;
-      check_exists_query_string << "SELECT * FROM Patients WHERE PatientID = '" << patientID << "'";
-      check_exists_query.exec(check_exists_query_string.str().c_str());
-
-      /// we check only patients with the same PatientID
-      /// PatientID is not unique in DICOM, so we also compare Name and BirthDate
-      /// and assume this is sufficient
-      while (check_exists_query.next())
+    const QString dirname = pending.takeLast();
+    ctkDICOMIndexerFileStat dirStat;
+    if (!dirStat.read(dirname))
+      {
+      this->removeDirectory(dirname);
+      continue;
+      }
+
+    const QStringList knownFiles = this->KnownFiles.value(dirname);
+    const QStringList knownDirectories = this->KnownDirectories.value(dirname);
+    QHash<QString, qint64>::const_iterator indexedDir =
+      this->Pipeline->IndexedDirectories.find(dirname);
+    if (indexedDir != this->Pipeline->IndexedDirectories.end() &&
+        indexedDir.value() >= 0 && indexedDir.value() == dirStat.MTime)
       {
-        if (
-            check_exists_query.record().value("PatientsName").toString() == patientsName.c_str() &&
-            check_exists_query.record().value("PatientsBirthDate").toString() == patientsBirthDate.c_str()
-           )
+      // No entry was added, removed or renamed, the directory is not
+      // listed. A file rewritten in place doesn't change the directory,
+      // the known files are still checked against the journal.
+      this->Pipeline->SkippedDirectoryCount.ref();
+      foreach(const QString& knownFile, knownFiles)
         {
-          /// found it
-          patientUID = check_exists_query.value(check_exists_query.record().indexOf("UID")).toInt();
+        ctkDICOMIndexerScannedFile file;
+        file.Path = knownFile;
+        if (!file.Stat.read(file.Path))
+          {
+          this->Pipeline->RemovedFiles << knownFile;
+          continue;
+          }
+        if (!this->queue(file, recentTime, blockedTime))
+          {
+          aborted = true;
           break;
+          }
         }
+      pending << knownDirectories;
+      continue;
       }
+    this->Pipeline->ScannedDirectories.insert(dirname,
+      dirStat.MTime >= recentTime ? -1 : dirStat.MTime);
 
-      if(!patientExists)
+    QSet<QString> entries;
+    QDirIterator it(dirname, QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot);
+    while (it.hasNext())
+      {
+      ctkDICOMIndexerScannedFile file;
+      file.Path = it.next();
+      entries.insert(file.Path);
+      if (it.fileInfo().isDir())
+        {
+        // symbolic links to directories are not followed
+        if (!it.fileInfo().isSymLink())
+          {
+          pending << file.Path;
+          }
+        continue;
+        }
+      if (!file.Stat.read(file.Path))
+        {
+        continue;
+        }
+      if (!this->queue(file, recentTime, blockedTime))
+        {
+        aborted = true;
+        break;
+        }
+      }
+    if (aborted)
       {
+      break;
+      }
 
-        std::stringstream query_string;
+    foreach(const QString& knownFile, knownFiles)
+      {
+      if (!entries.contains(knownFile))
+        {
+        this->Pipeline->RemovedFiles << knownFile;
+        }
+      }
+    foreach(const QString& knownDirectory, knownDirectories)
+      {
+      if (!entries.contains(knownDirectory))
+        {
+        this->removeDirectory(knownDirectory);
+        }
+      }
+    }
+  {
+  QMutexLocker locker(&this->Pipeline->StatisticsMutex);
+  this->Pipeline->Statistics.ScanMsecs = (timer.elapsed() - blockedTime) / 1000.;
+  }
+  this->Pipeline->ScanFinished.fetchAndStoreOrdered(1);
+  this->Pipeline->Files.producerFinished();
+}
 
-        query_string << "INSERT INTO Patients VALUES( NULL,'" 
-        << patientsName << "','" 
-        << patientID << "','" 
-        << patientsBirthDate << "','"
-        << patientsBirthTime << "','" 
-        << patientsSex << "','" 
-        << patientsAge << "','" 
-        << patientComments << "')";
+//------------------------------------------------------------------------------
+void ctkDICOMIndexerScanTask::removeDirectory(const QString& dirname)
+{
+  if (this->Pipeline->IndexedDirectories.contains(dirname) ||
+      !this->KnownFiles.value(dirname).isEmpty())
+    {
+    this->Pipeline->RemovedDirectories << dirname;
+    }
+}
 
-        query.exec(query_string.str().c_str());
+//------------------------------------------------------------------------------
+// ctkDICOMIndexerParseTask methods
+
+//------------------------------------------------------------------------------
+ctkDICOMIndexerParseTask::ctkDICOMIndexerParseTask(ctkDICOMIndexerPipeline* pipeline)
+  : Pipeline(pipeline)
+{
+}
 
-        patientUID = query.lastInsertId().toInt();
-        MITK_INFO << "New patient inserted: " << patientUID << "\n";
+//------------------------------------------------------------------------------
+void ctkDICOMIndexerParseTask::run()
+{
+  ctkDICOMIndexerScannedFile file;
+  while (this->Pipeline->Files.pop(file))
+    {
+    const QString& filePath = file.Path;
+    ctkDICOMIndexerParsedFile parsed;
+    parsed.Record.Filename = filePath;
+    parsed.Record.FileSize = file.Stat.Size;
+    parsed.Record.FileMTime = file.Stat.MTime;
+    parsed.Record.Inode = file.Stat.Inode;
+
+    const qint64 bytesReadBefore = threadBytesRead();
+    ctkDICOMTimer timer;
+    DcmFileFormat fileformat;
+    OFCondition status = loadFile(fileformat, filePath, this->Pipeline->ParsingMode);
+    qint64 parseTime = timer.elapsed();
+    const qint64 bytesReadAfter = threadBytesRead();
+    timer.start();
+    if (!status.good())
+      {
+      parsed.Error = QString("Could not load ") + filePath +
+        "\nDCMTK says: " + status.text();
       }
-    }
-    else 
+    else if (!parsed.Record.readDataset(fileformat.getDataset(), &parsed.Error))
       {
-      patientUID = lastPatientUID;
-      }     
-    
-    /// keep this for the next image
-    lastPatientUID = patientUID;
-    lastPatientID = patientID;
-    lastPatientsBirthDate = patientsBirthDate;
-    lastPatientsName = patientsName;
-
-    //---------------------
-    //Add Study to Database
-    //---------------------
-
-    if(lastStudyInstanceUID.compare(studyInstanceUID))
-    {
-      QSqlQuery check_exists_query(database);
-      std::stringstream check_exists_query_string;
-      check_exists_query_string << "SELECT * FROM Studies WHERE StudyInstanceUID = '" << studyInstanceUID << "'";
-      check_exists_query.exec(check_exists_query_string.str().c_str());
-
-      if(!check_exists_query.next())
+      parsed.Error = QString("Could not read ") + parsed.Error + " from " + filePath;
+      }
+    else
       {
-
-        std::stringstream query_string;
-
-        query_string << "INSERT INTO Studies VALUES('"
-          << studyInstanceUID << "','" 
-          << patientUID << "','" 
-          << studyID << "','"
-          << QDate::fromString(studyDate.c_str(), "yyyyMMdd").toString("yyyy-MM-dd").toStdString() << "','"
-          << studyTime << "','" 
-          << accessionNumber << "','" 
-          << modalitiesInStudy << "','" 
-          << institutionName << "','" 
-          << referringPhysician << "','" 
-          << performingPhysiciansName << "','" 
-          << studyDescription << "')";
-
-        query.exec(query_string.str().c_str());
+      parsed.Valid = true;
+      }
+    parseTime += timer.elapsed();
+    this->Pipeline->addParsedFile(bytesReadBefore < 0 || bytesReadAfter < 0 ?
+                                  -1 : bytesReadAfter - bytesReadBefore, parseTime);
+    if (!this->Pipeline->Parsed.push(parsed))
+      {
+      break;
       }
     }
+  this->Pipeline->Parsed.producerFinished();
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMIndexerPrivate methods
+
+//------------------------------------------------------------------------------
+ctkDICOMIndexerPrivate::ctkDICOMIndexerPrivate()
+{
+  this->NumberOfThreads = QThread::idealThreadCount();
+  this->QueueSize = 256;
+  this->ParsingMode = ctkDICOMIndexer::HeaderOnly;
+  this->DatabaseTime = 0;
+  this->StorageTime = 0;
+}
 
-    lastStudyInstanceUID = studyInstanceUID;
+//------------------------------------------------------------------------------
+ctkDICOMIndexerPrivate::~ctkDICOMIndexerPrivate()
+{
+}
 
-    //----------------------
-    //Add Series to Database
-    //----------------------
+//------------------------------------------------------------------------------
+bool ctkDICOMIndexerPrivate::insertRecord(const ctkDICOMIndexerRecord& record, bool store)
+{
+  logger.debug ( "Adding new items to database:" );
+  logger.debug ( "studyID: " + record.StudyID );
+  logger.debug ( "seriesInstanceUID: " + record.SeriesInstanceUID );
+  logger.debug ( "Patient's Name: " + record.PatientsName );
 
-    if(lastSeriesInstanceUID.compare(seriesInstanceUID))
+  ctkDICOMTimer timer;
+  if (!store)
     {
+    const bool res = this->Writer.insert(record);
+    this->DatabaseTime += timer.elapsed();
+    return res;
+    }
 
-      QSqlQuery check_exists_query(database);
-      std::stringstream check_exists_query_string;
-      check_exists_query_string << "SELECT * FROM Series WHERE SeriesInstanceUID = '" << seriesInstanceUID << "'";
-      check_exists_query.exec(check_exists_query_string.str().c_str());
+  //----------------------------------
+  //Store file in destination directory
+  //----------------------------------
+  ctkDICOMIndexerRecord stored = record;
+  stored.Filename = this->Storage.store(record);
+  this->StorageTime += timer.elapsed();
+  // the stats are the ones of the source file
+  stored.FileSize = -1;
+  stored.FileMTime = -1;
+  stored.Inode = -1;
+  timer.start();
+  const bool res = this->Writer.insert(stored);
+  this->DatabaseTime += timer.elapsed();
+  return res;
+}
 
-      if(!check_exists_query.next())
-      {
+//------------------------------------------------------------------------------
+// ctkDICOMIndexer methods
 
-        std::stringstream query_string;
-
-        query_string << "INSERT INTO Series VALUES('"
-          << seriesInstanceUID << "','"
-          << studyInstanceUID << "','"
-          << static_cast<int>(seriesNumber) << "','"
-          << QDate::fromString(seriesDate.c_str(), "yyyyMMdd").toString("yyyy-MM-dd").toStdString() << "','"
-          << seriesTime << "','"
-          << seriesDescription << "','"
-          << bodyPartExamined << "','"
-          << frameOfReferenceUID << "','"
-          << static_cast<int>(acquisitionNumber) << "','"
-          << contrastAgent << "','"
-          << scanningSequence << "','"
-          << static_cast<int>(echoNumber) << "','"
-          << static_cast<int>(temporalPosition) << "')";
-
-        query.exec(query_string.str().c_str());
-      }
-    }
+//------------------------------------------------------------------------------
+ctkDICOMIndexer::ctkDICOMIndexer(QObject* _parent): Superclass(_parent)
+{
+  CTK_INIT_PRIVATE(ctkDICOMIndexer);
+}
 
-    lastSeriesInstanceUID = seriesInstanceUID;
+//------------------------------------------------------------------------------
+ctkDICOMIndexer::~ctkDICOMIndexer()
+{
+}
 
+//------------------------------------------------------------------------------
+void ctkDICOMIndexer::setNumberOfThreads(int threads)
+{
+  CTK_D(ctkDICOMIndexer);
+  d->NumberOfThreads = qMax(threads, 1);
+}
 
-    //----------------------------------
-    //Move file to destination directory
-    //----------------------------------
+//------------------------------------------------------------------------------
+int ctkDICOMIndexer::numberOfThreads()const
+{
+  CTK_D(const ctkDICOMIndexer);
+  return d->NumberOfThreads;
+}
 
-    if (!destinationDirectoryName.isEmpty())
-      {
-      QFile currentFile( qfilename );
-      QDir destinationDir(destinationDirectoryName);
-
-      QString uniqueDirName = QString(studyInstanceUID.c_str()) + "/" + seriesInstanceUID.c_str();
-      qDebug() << "MKPath: " << uniqueDirName;
-      destinationDir.mkpath(uniqueDirName);
-      QString destFileName = destinationDir.absolutePath().append("/").append(instanceNumber.c_str());
-      qDebug() << "Copy: " << qfilename << " -> " << destFileName;
-      currentFile.copy(destFileName);
-      //for testing only: copy file instead of moving
-      //currentFile.copyTo(destDirectoryPath.str());
-    }
-    // */
-    //------------------------
-    //Add Filename to Database
-    //------------------------
+//------------------------------------------------------------------------------
+void ctkDICOMIndexer::setQueueSize(int size)
+{
+  CTK_D(ctkDICOMIndexer);
+  d->QueueSize = qMax(size, 1);
+}
 
-//    std::stringstream relativeFilePath;
-//    relativeFilePath << seriesInstanceUID.c_str() << "/" << currentFilePath.getFileName();
+//------------------------------------------------------------------------------
+int ctkDICOMIndexer::queueSize()const
+{
+  CTK_D(const ctkDICOMIndexer);
+  return d->QueueSize;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMIndexer::setParsingMode(ParsingMode mode)
+{
+  CTK_D(ctkDICOMIndexer);
+  d->ParsingMode = mode;
+}
 
-    QSqlQuery check_exists_query(database);
-    std::stringstream check_exists_query_string;
-//    check_exists_query_string << "SELECT * FROM Images WHERE Filename = '" << relativeFilePath.str() << "'";
-    check_exists_query_string << "SELECT * FROM Images WHERE Filename = '" << filename << "'";
-    check_exists_query.exec(check_exists_query_string.str().c_str());
+//------------------------------------------------------------------------------
+ctkDICOMIndexer::ParsingMode ctkDICOMIndexer::parsingMode()const
+{
+  CTK_D(const ctkDICOMIndexer);
+  return d->ParsingMode;
+}
 
-    if(!check_exists_query.next())
-    {
-      std::stringstream query_string;
+//------------------------------------------------------------------------------
+void ctkDICOMIndexer::setStorageMode(ctkDICOMStorage::Mode mode)
+{
+  CTK_D(ctkDICOMIndexer);
+  d->Storage.setMode(mode);
+}
 
-      //To save absolute path: destDirectoryPath.str()
-      query_string << "INSERT INTO Images VALUES('"
-        << /*relativeFilePath.str()*/ filename << "','" << seriesInstanceUID << "','" << QDateTime::currentDateTime().toString(Qt::ISODate).toStdString() << "')";
+//------------------------------------------------------------------------------
+ctkDICOMStorage::Mode ctkDICOMIndexer::storageMode()const
+{
+  CTK_D(const ctkDICOMIndexer);
+  return d->Storage.mode();
+}
 
-      query.exec(query_string.str().c_str());
-    }
-  }
+//------------------------------------------------------------------------------
+void ctkDICOMIndexer::setMaxConcurrentTransfers(int transfers)
+{
+  CTK_D(ctkDICOMIndexer);
+  d->Storage.setMaxConcurrentTransfers(transfers);
+}
 
-  // db.commit();
-  // db.close();
+//------------------------------------------------------------------------------
+int ctkDICOMIndexer::maxConcurrentTransfers()const
+{
+  CTK_D(const ctkDICOMIndexer);
+  return d->Storage.maxConcurrentTransfers();
+}
 
+//------------------------------------------------------------------------------
+ctkDICOMIndexer::Statistics ctkDICOMIndexer::lastStatistics()const
+{
+  CTK_D(const ctkDICOMIndexer);
+  return d->LastStatistics;
 }
 
 //------------------------------------------------------------------------------
-void ctkDICOMIndexer::refreshDatabase(QSqlDatabase database, const QString& directoryName)
+void ctkDICOMIndexer::cancel()
 {
-  /// get all filenames from the database
-  QSqlQuery allFilesQuery(database);
-  QStringList databaseFileNames;
-  QStringList filesToRemove;
-  allFilesQuery.exec("SELECT Filename from Images;");
+  CTK_D(ctkDICOMIndexer);
+  d->Canceled.fetchAndStoreOrdered(1);
+}
 
-  while (allFilesQuery.next())
+//------------------------------------------------------------------------------
+void ctkDICOMIndexer::addDirectory(QSqlDatabase database, const QString& directoryName,const QString& destinationDirectoryName)
+{
+  CTK_D(ctkDICOMIndexer);
+  ctkDICOMTimer totalTimer;
+  d->Canceled.fetchAndStoreOrdered(0);
+  d->Writer.setDatabase(database);
+  const bool store = !destinationDirectoryName.isEmpty();
+  d->Storage.setDirectory(destinationDirectoryName);
+  const int cacheHits = d->Writer.cacheHits();
+  const int cacheMisses = d->Writer.cacheMisses();
+  const int statementCount = d->Writer.statementCount();
+  const double statementMsecs = d->Writer.statementMsecs();
+  d->DatabaseTime = 0;
+  d->StorageTime = 0;
+
+  const int parserCount = d->NumberOfThreads;
+  ctkDICOMIndexerPipeline pipeline(d->QueueSize, parserCount, d->ParsingMode);
+
+  // The database connection can only be used from this thread, fetch the
+  // already indexed files once instead of querying them for each file.
+  QSqlQuery indexedFiles(database);
+  indexedFiles.setForwardOnly(true);
+  indexedFiles.exec("SELECT Filename, FileSize, FileMTime, Inode, InsertTimestamp FROM Images");
+  while (indexedFiles.next())
     {
-    QString fileName = allFilesQuery.value(0).toString();
-    databaseFileNames.append(fileName);
-    if (! QFile::exists(fileName) ) 
+    ctkDICOMIndexerFileStat stat;
+    if (indexedFiles.value(1).isNull())
       {
-      filesToRemove.append(fileName);
+      // indexed before the stats were recorded
+      stat.MTime = QDateTime::fromString(indexedFiles.value(4).toString(),
+                                         Qt::ISODate).toTime_t();
       }
+    else
+      {
+      stat.Size = indexedFiles.value(1).toLongLong();
+      stat.MTime = indexedFiles.value(2).isNull() ? -1 : indexedFiles.value(2).toLongLong();
+      stat.Inode = indexedFiles.value(3).isNull() ? -1 : indexedFiles.value(3).toLongLong();
+      }
+    pipeline.IndexedFiles.insert(indexedFiles.value(0).toString(), stat);
+    }
+  QSqlQuery indexedDirectories(database);
+  indexedDirectories.setForwardOnly(true);
+  indexedDirectories.exec("SELECT Dirname, MTime FROM DirectoryJournal");
+  while (indexedDirectories.next())
+    {
+    pipeline.IndexedDirectories.insert(indexedDirectories.value(0).toString(),
+      indexedDirectories.value(1).isNull() ? -1 : indexedDirectories.value(1).toLongLong());
     }
 
-  QSet<QString> filesytemFiles;
-  QDirIterator dirIt(directoryName);
-  while (dirIt.hasNext()) 
+  QThreadPool pool;
+  // one thread for the scan, the others parse
+  pool.setMaxThreadCount(parserCount + 1);
+  pool.start(new ctkDICOMIndexerScanTask(&pipeline, directoryName, &d->Canceled));
+  for (int i = 0; i < parserCount; ++i)
     {
-    filesytemFiles.insert(dirIt.next());
+    pool.start(new ctkDICOMIndexerParseTask(&pipeline));
     }
+
+  int processed = 0;
+  int indexed = 0;
+  int lastPercent = -1;
+  bool writeFailed = false;
+  ctkDICOMIndexerParsedFile parsed;
+  while (pipeline.Parsed.pop(parsed))
+    {
+    if (d->Canceled)
+      {
+      break;
+      }
+    ++processed;
+    if (!parsed.Valid)
+      {
+      logger.error ( parsed.Error );
+      }
+    else
+      {
+      emit this->indexingFilePath(parsed.Record.Filename);
+      writeFailed = !d->insertRecord(parsed.Record, store) || writeFailed;
+      ++indexed;
+      }
+    // The total is only known when the scan is finished
+    int scanned = pipeline.ScannedCount;
+    int percent = scanned > 0 ? qMin(100, processed * 100 / scanned) : 0;
+    if (!pipeline.ScanFinished)
+      {
+      percent = qMin(percent, 99);
+      }
+    if (percent > lastPercent)
+      {
+      lastPercent = percent;
+      emit this->progress(percent);
+      }
+    }
+
+  if (d->Canceled)
+    {
+    logger.warn ( "Indexing of " + directoryName + " canceled after " +
+                  QString::number(processed) + " files" );
+    }
+
+  // Unblock the producers before waiting for them
+  pipeline.Files.abort();
+  pipeline.Parsed.abort();
+  pool.waitForDone();
+
+  // The files that could not be stored are not in the destination
+  ctkDICOMTimer timer;
+  const QStringList failedFiles = d->Storage.waitForDone();
+  d->StorageTime += timer.elapsed();
+  timer.start();
+  foreach(const QString& failedFile, failedFiles)
+    {
+    writeFailed = true;
+    d->Writer.removeImage(failedFile);
+    }
+
+  // The scan is finished, apply the differences it found
+  foreach(const QString& removedFile, pipeline.RemovedFiles)
+    {
+    d->Writer.removeImage(removedFile);
+    }
+  foreach(const QString& removedDirectory, pipeline.RemovedDirectories)
+    {
+    d->Writer.removeDirectory(removedDirectory);
+    }
+  // A directory is skipped next time only if all its files were indexed
+  if (!d->Canceled && !writeFailed)
+    {
+    for (QHash<QString, qint64>::const_iterator it = pipeline.ScannedDirectories.begin();
+         it != pipeline.ScannedDirectories.end(); ++it)
+      {
+      d->Writer.setDirectoryModificationTime(it.key(), it.value());
+      }
+    }
+  d->Writer.commit();
+  d->DatabaseTime += timer.elapsed();
+  if (!d->Canceled && lastPercent < 100)
+    {
+    emit this->progress(100);
+    }
+
+  logger.debug ( QString("Indexed %1 files, skipped %2 unchanged files in %3 unchanged "
+                         "directories, removed %4 files and %5 directories")
+                 .arg(processed).arg(static_cast<int>(pipeline.SkippedCount))
+                 .arg(static_cast<int>(pipeline.SkippedDirectoryCount))
+                 .arg(pipeline.RemovedFiles.size())
+                 .arg(pipeline.RemovedDirectories.size()) );
+
+  d->LastStatistics = pipeline.Statistics;
+  d->LastStatistics.PeakResidentSetSize = peakResidentSetSize();
+  d->LastStatistics.CacheHits = d->Writer.cacheHits() - cacheHits;
+  d->LastStatistics.CacheMisses = d->Writer.cacheMisses() - cacheMisses;
+  d->LastStatistics.FilesSkipped = pipeline.SkippedCount;
+  d->LastStatistics.FilesRemoved = pipeline.RemovedFiles.size();
+  d->LastStatistics.DirectoriesSkipped = pipeline.SkippedDirectoryCount;
+  d->LastStatistics.DirectoriesRemoved = pipeline.RemovedDirectories.size();
+  d->LastStatistics.FilesIndexed = indexed;
+  d->LastStatistics.DatabaseMsecs = d->DatabaseTime / 1000.;
+  d->LastStatistics.StorageMsecs = d->StorageTime / 1000.;
+  d->LastStatistics.SqlStatements = d->Writer.statementCount() - statementCount;
+  d->LastStatistics.SqlMsecs = d->Writer.statementMsecs() - statementMsecs;
+  d->LastStatistics.TotalMsecs = totalTimer.elapsed() / 1000.;
+  const ctkDICOMIndexer::Statistics& stats = d->LastStatistics;
+  logger.info ( QString("Parsed %1 files, %2 bytes read (%3 per file on average, "
+                        "%4 at most), peak RSS %5 bytes, %6 cache hits, "
+                        "%7 cache misses")
+                .arg(stats.FilesParsed)
+                .arg(stats.BytesRead)
+                .arg(stats.FilesParsed > 0 && stats.BytesRead >= 0 ?
+                     stats.BytesRead / stats.FilesParsed : -1)
+                .arg(stats.MaxBytesReadPerFile)
+                .arg(stats.PeakResidentSetSize)
+                .arg(stats.CacheHits)
+                .arg(stats.CacheMisses) );
+  logger.info ( QString("Indexed %1 files in %2 ms: scan %3 ms, parse %4 ms, "
+                        "database %5 ms (%6 statements in %7 ms), storage %8 ms")
+                .arg(stats.FilesIndexed)
+                .arg(stats.TotalMsecs, 0, 'f', 1)
+                .arg(stats.ScanMsecs, 0, 'f', 1)
+                .arg(stats.ParseMsecs, 0, 'f', 1)
+                .arg(stats.DatabaseMsecs, 0, 'f', 1)
+                .arg(stats.SqlStatements)
+                .arg(stats.SqlMsecs, 0, 'f', 1)
+                .arg(stats.StorageMsecs, 0, 'f', 1) );
+  emit this->indexingComplete();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMIndexer::refreshDatabase(QSqlDatabase database, const QString& directoryName)
+{
+  this->addDirectory(database, directoryName);
 }
@@ -22,23 +22,143 @@
 #define __ctkDICOMIndexer_h
 
 // Qt includes 
+#include <QObject>
 #include <QSqlDatabase>
 
 // CTK includes
 #include <ctkPimpl.h>
 
 #include "CTKDICOMCoreExport.h"
+#include "ctkDICOMStorage.h"
 
 class ctkDICOMIndexerPrivate;
-class CTK_DICOM_CORE_EXPORT ctkDICOMIndexer
+class CTK_DICOM_CORE_EXPORT ctkDICOMIndexer : public QObject
 {
+  Q_OBJECT
+  Q_PROPERTY(int numberOfThreads READ numberOfThreads WRITE setNumberOfThreads);
+  Q_PROPERTY(int queueSize READ queueSize WRITE setQueueSize);
+  Q_PROPERTY(ParsingMode parsingMode READ parsingMode WRITE setParsingMode);
+  Q_ENUMS(ParsingMode);
 public:
-  explicit ctkDICOMIndexer();
+  typedef QObject Superclass;
+
+  enum ParsingMode
+  {
+    /// Load the whole file, pixel data included
+    FullDataset,
+    /// Stop reading before the pixel data and leave the large elements
+    /// on disk, they are only read if accessed
+    HeaderOnly
+  };
+
+  /// Measures of the last addDirectory call
+  struct Statistics
+  {
+    Statistics();
+    /// Number of files read by the parsing threads
+    int    FilesParsed;
+    /// Bytes read from disk by the parsing threads, -1 if unknown
+    qint64 BytesRead;
+    /// Largest amount of bytes read for a single file, -1 if unknown
+    qint64 MaxBytesReadPerFile;
+    /// Peak resident set size of the process, -1 if unknown
+    qint64 PeakResidentSetSize;
+    /// Patient, study and series lookups answered by the writer cache
+    int    CacheHits;
+    /// Lookups that had to query the database
+    int    CacheMisses;
+    /// Files not parsed because they didn't change since they were indexed
+    int    FilesSkipped;
+    /// Indexed files that don't exist anymore
+    int    FilesRemoved;
+    /// Directories not listed because they didn't change
+    int    DirectoriesSkipped;
+    /// Indexed directories that don't exist anymore
+    int    DirectoriesRemoved;
+    /// Files written in the database
+    int    FilesIndexed;
+    /// Wall time of addDirectory in ms
+    double TotalMsecs;
+    /// Time spent listing the directories, without the time the scan
+    /// waited for the parsers
+    double ScanMsecs;
+    /// Time spent parsing the files, summed over the parsing threads
+    double ParseMsecs;
+    /// Time spent writing the database, in the calling thread
+    double DatabaseMsecs;
+    /// Time the calling thread spent starting the transfers to the
+    /// destination directory and waiting for them
+    double StorageMsecs;
+    /// Statements and commits executed by the database writer, and
+    /// their time, part of DatabaseMsecs
+    int    SqlStatements;
+    double SqlMsecs;
+  };
+
+  explicit ctkDICOMIndexer(QObject* parent = 0);
   virtual ~ctkDICOMIndexer();
-  /// add directory to database and optionally copy files to destinationDirectory
+  /// add directory to database and optionally store files in destinationDirectory,
+  /// see ctkDICOMStorage for the layout of the destination.
+  /// The directory is scanned and the files are parsed by worker threads,
+  /// the database is written from the calling thread only. The function
+  /// returns when all the files are indexed or when cancel() is called.
+  /// Only the new and changed files are parsed: the size, modification time
+  /// and inode of the files and the modification time of the directories
+  /// are recorded, the directories that didn't change are not listed again
+  /// but their known files are still checked.
+  /// The files and directories that were removed are removed from the
+  /// database.
   void addDirectory(QSqlDatabase database, const QString& directoryName, const QString& destinationDirectoryName = "");
+  /// Update the database with the changes in directoryName, same as
+  /// addDirectory without destination
   void refreshDatabase(QSqlDatabase database, const QString& directoryName);
 
+  ///
+  /// Number of threads parsing the DICOM files in addDirectory.
+  /// Default is QThread::idealThreadCount().
+  void setNumberOfThreads(int threads);
+  int numberOfThreads()const;
+
+  ///
+  /// Maximum number of items waiting between two stages of addDirectory.
+  /// It bounds the memory used when parsing is faster than writing.
+  void setQueueSize(int size);
+  int queueSize()const;
+
+  ///
+  /// How much of each file is read in addDirectory. Default is HeaderOnly.
+  void setParsingMode(ParsingMode mode);
+  ParsingMode parsingMode()const;
+
+  ///
+  /// How the files are stored in the destination directory of addDirectory.
+  /// Default is ctkDICOMStorage::Copy.
+  void setStorageMode(ctkDICOMStorage::Mode mode);
+  ctkDICOMStorage::Mode storageMode()const;
+
+  ///
+  /// Number of files stored in the destination directory at the same time
+  /// while the next ones are parsed. Default is 4.
+  void setMaxConcurrentTransfers(int transfers);
+  int maxConcurrentTransfers()const;
+
+  /// Statistics of the last addDirectory
+  Statistics lastStatistics()const;
+
+public slots:
+  ///
+  /// Stop the running addDirectory as soon as possible. Files already
+  /// written in the database are kept. Can be called from any thread.
+  void cancel();
+
+signals:
+  /// Percentage of the files found so far that are indexed
+  void progress(int percent);
+  /// Emitted before a file is written in the database
+  void indexingFilePath(const QString& filePath);
+  /// Emitted when addDirectory returns, canceled or not
+  void indexingComplete();
+
 private:
   CTK_DECLARE_PRIVATE(ctkDICOMIndexer);
 };
@@ -32,6 +32,7 @@
 
 class ctkDICOMIndexerBasePrivate;
 class DcmDataset;
+struct ctkDICOMIndexerRecord;
 
 class CTK_DICOM_CORE_EXPORT ctkDICOMIndexerBase : public QObject
 {
@@ -50,6 +51,14 @@ public:
    * Insert into the database if not already exsting.
    */
   void insert ( DcmDataset *dataset );
+  /**
+   * Insert a record read by another thread, see ctkDICOMIndexerRecord.
+   */
+  void insert ( const ctkDICOMIndexerRecord& record );
+  /**
+   * Inserts are committed by batches, commit the pending ones.
+   */
+  void commit();
 
 private:
   CTK_DECLARE_PRIVATE(ctkDICOMIndexerBase);
@@ -0,0 +1,129 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// ctkDICOM includes
+#include "ctkDICOMIndexerRecord.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/ofstd/ofcond.h>
+#include <dcmtk/ofstd/ofstring.h>
+
+namespace
+{
+//------------------------------------------------------------------------------
+bool readString(DcmDataset* dataset, const DcmTagKey& tag, QString& value)
+{
+  OFString str;
+  if (!dataset->findAndGetOFString(tag, str).good())
+    {
+    return false;
+    }
+  value = QString(str.c_str());
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void readInt(DcmDataset* dataset, const DcmTagKey& tag, int& value)
+{
+  Sint32 number = 0;
+  dataset->findAndGetSint32(tag, number);
+  value = static_cast<int>(number);
+}
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMIndexerRecord::ctkDICOMIndexerRecord()
+{
+  this->FileSize = -1;
+  this->FileMTime = -1;
+  this->Inode = -1;
+  this->SeriesNumber = 0;
+  this->AcquisitionNumber = 0;
+  this->EchoNumber = 0;
+  this->TemporalPosition = 0;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMIndexerRecord::readDataset(DcmDataset* dataset, QString* error)
+{
+  Q_ASSERT(dataset);
+  QString missing;
+
+  //If the following fields can not be evaluated, the file can't be indexed
+  if (!readString(dataset, DCM_PatientsName, this->PatientsName))
+    {
+    missing = "DCM_PatientsName";
+    }
+  if (!readString(dataset, DCM_StudyInstanceUID, this->StudyInstanceUID) && missing.isEmpty())
+    {
+    missing = "DCM_StudyInstanceUID";
+    }
+  if (!readString(dataset, DCM_SeriesInstanceUID, this->SeriesInstanceUID) && missing.isEmpty())
+    {
+    missing = "DCM_SeriesInstanceUID";
+    }
+  if (!readString(dataset, DCM_InstanceNumber, this->InstanceNumber) && missing.isEmpty())
+    {
+    missing = "DCM_InstanceNumber";
+    }
+
+  readString(dataset, DCM_PatientID, this->PatientID);
+  readString(dataset, DCM_PatientsBirthDate, this->PatientsBirthDate);
+  readString(dataset, DCM_PatientsBirthTime, this->PatientsBirthTime);
+  readString(dataset, DCM_PatientsSex, this->PatientsSex);
+  readString(dataset, DCM_PatientsAge, this->PatientsAge);
+  readString(dataset, DCM_PatientComments, this->PatientComments);
+  readString(dataset, DCM_StudyID, this->StudyID);
+  readString(dataset, DCM_StudyDate, this->StudyDate);
+  readString(dataset, DCM_StudyTime, this->StudyTime);
+  readString(dataset, DCM_AccessionNumber, this->AccessionNumber);
+  readString(dataset, DCM_ModalitiesInStudy, this->ModalitiesInStudy);
+  readString(dataset, DCM_InstitutionName, this->InstitutionName);
+  readString(dataset, DCM_PerformingPhysiciansName, this->PerformingPhysiciansName);
+  readString(dataset, DCM_ReferringPhysiciansName, this->ReferringPhysician);
+  readString(dataset, DCM_StudyDescription, this->StudyDescription);
+
+  readString(dataset, DCM_SOPInstanceUID, this->SOPInstanceUID);
+
+  readString(dataset, DCM_SeriesDate, this->SeriesDate);
+  readString(dataset, DCM_SeriesTime, this->SeriesTime);
+  readString(dataset, DCM_SeriesDescription, this->SeriesDescription);
+  readString(dataset, DCM_Modality, this->Modality);
+  readString(dataset, DCM_BodyPartExamined, this->BodyPartExamined);
+  readString(dataset, DCM_FrameOfReferenceUID, this->FrameOfReferenceUID);
+  readString(dataset, DCM_ContrastBolusAgent, this->ContrastAgent);
+  readString(dataset, DCM_ScanningSequence, this->ScanningSequence);
+
+  readInt(dataset, DCM_SeriesNumber, this->SeriesNumber);
+  readInt(dataset, DCM_AcquisitionNumber, this->AcquisitionNumber);
+  readInt(dataset, DCM_EchoNumbers, this->EchoNumber);
+  readInt(dataset, DCM_TemporalPositionIdentifier, this->TemporalPosition);
+
+  if (error)
+    {
+    *error = missing;
+    }
+  return missing.isEmpty();
+}
@@ -0,0 +1,93 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMIndexerRecord_h
+#define __ctkDICOMIndexerRecord_h
+
+// Qt includes
+#include <QString>
+
+#include "CTKDICOMCoreExport.h"
+
+class DcmDataset;
+
+///
+/// Patient, study, series and image attributes of one DICOM file, as stored
+/// in the database. A record is a plain value: it is filled by the parsing
+/// threads of ctkDICOMIndexer and handed over to the thread owning the
+/// database connection.
+struct CTK_DICOM_CORE_EXPORT ctkDICOMIndexerRecord
+{
+  ctkDICOMIndexerRecord();
+
+  ///
+  /// Read all the indexed attributes from @param dataset.
+  /// Return false if one of the attributes required by ctkDICOMIndexer
+  /// (PatientsName, StudyInstanceUID, SeriesInstanceUID, InstanceNumber)
+  /// is missing, the other attributes are read anyway. The name of the
+  /// missing attribute is written in @param error if not null.
+  bool readDataset(DcmDataset* dataset, QString* error = 0);
+
+  QString Filename;
+  /// Size, modification time (seconds since the epoch) and inode of
+  /// Filename when it was parsed, -1 if unknown. They let ctkDICOMIndexer
+  /// skip the file if it didn't change.
+  qint64  FileSize;
+  qint64  FileMTime;
+  qint64  Inode;
+
+  QString PatientsName;
+  QString PatientID;
+  QString PatientsBirthDate;
+  QString PatientsBirthTime;
+  QString PatientsSex;
+  QString PatientsAge;
+  QString PatientComments;
+
+  QString StudyInstanceUID;
+  QString StudyID;
+  QString StudyDate;
+  QString StudyTime;
+  QString AccessionNumber;
+  QString ModalitiesInStudy;
+  QString InstitutionName;
+  QString PerformingPhysiciansName;
+  QString ReferringPhysician;
+  QString StudyDescription;
+
+  QString SeriesInstanceUID;
+  QString SeriesDate;
+  QString SeriesTime;
+  QString SeriesDescription;
+  QString Modality;
+  QString BodyPartExamined;
+  QString FrameOfReferenceUID;
+  QString ContrastAgent;
+  QString ScanningSequence;
+  int     SeriesNumber;
+  int     AcquisitionNumber;
+  int     EchoNumber;
+  int     TemporalPosition;
+
+  QString SOPInstanceUID;
+  QString InstanceNumber;
+};
+
+#endif
@@ -0,0 +1,260 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMIndexer_p_h
+#define __ctkDICOMIndexer_p_h
+
+// Qt includes
+#include <QAtomicInt>
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QQueue>
+#include <QRunnable>
+#include <QString>
+#include <QStringList>
+#include <QWaitCondition>
+
+// ctkDICOM includes
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexer.h"
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMStorage.h"
+
+//------------------------------------------------------------------------------
+/// Bounded FIFO joining two stages of the import pipeline.
+/// push() blocks while the queue is full, pop() blocks while it is empty.
+/// The queue is closed when all its producers are finished: pop() then
+/// returns false once the remaining items are consumed. abort() wakes up
+/// every waiting thread and makes push() and pop() fail.
+template <typename T>
+class ctkDICOMIndexerQueue
+{
+public:
+  ctkDICOMIndexerQueue(int capacity, int producers)
+    : Capacity(qMax(capacity, 1)), Producers(producers), Aborted(false)
+    {
+    }
+
+  bool push(const T& item)
+    {
+    QMutexLocker locker(&this->Mutex);
+    while (this->Items.size() >= this->Capacity && !this->Aborted)
+      {
+      this->NotFull.wait(&this->Mutex);
+      }
+    if (this->Aborted)
+      {
+      return false;
+      }
+    this->Items.enqueue(item);
+    this->NotEmpty.wakeOne();
+    return true;
+    }
+
+  bool pop(T& item)
+    {
+    QMutexLocker locker(&this->Mutex);
+    while (this->Items.isEmpty() && this->Producers > 0 && !this->Aborted)
+      {
+      this->NotEmpty.wait(&this->Mutex);
+      }
+    if (this->Aborted || this->Items.isEmpty())
+      {
+      return false;
+      }
+    item = this->Items.dequeue();
+    this->NotFull.wakeOne();
+    return true;
+    }
+
+  void producerFinished()
+    {
+    QMutexLocker locker(&this->Mutex);
+    if (--this->Producers <= 0)
+      {
+      this->NotEmpty.wakeAll();
+      }
+    }
+
+  void abort()
+    {
+    QMutexLocker locker(&this->Mutex);
+    this->Aborted = true;
+    this->Items.clear();
+    this->NotEmpty.wakeAll();
+    this->NotFull.wakeAll();
+    }
+
+private:
+  QMutex         Mutex;
+  QWaitCondition NotEmpty;
+  QWaitCondition NotFull;
+  QQueue<T>      Items;
+  int            Capacity;
+  int            Producers;
+  bool           Aborted;
+};
+
+//------------------------------------------------------------------------------
+/// Size, modification time and inode of a file, as recorded in the Images
+/// table. The inode changes when a file is replaced by another one with the
+/// same size and time, -1 where it is not available.
+struct ctkDICOMIndexerFileStat
+{
+  ctkDICOMIndexerFileStat() : Size(-1), MTime(-1), Inode(-1) {}
+  /// Read the stats of @param path, return false if it doesn't exist
+  bool read(const QString& path);
+  bool operator==(const ctkDICOMIndexerFileStat& other)const
+    {
+    return this->Size == other.Size && this->MTime == other.MTime &&
+           this->Inode == other.Inode;
+    }
+  qint64 Size;
+  qint64 MTime;
+  qint64 Inode;
+};
+
+//------------------------------------------------------------------------------
+/// Item of the scanning stage: a file that is new or changed
+struct ctkDICOMIndexerScannedFile
+{
+  QString                 Path;
+  ctkDICOMIndexerFileStat Stat;
+};
+
+//------------------------------------------------------------------------------
+/// Result of the parsing stage. Valid is false if the file could not be read
+/// or lacks a required attribute, Error then explains why.
+struct ctkDICOMIndexerParsedFile
+{
+  ctkDICOMIndexerParsedFile() : Valid(false) {}
+  ctkDICOMIndexerRecord Record;
+  bool                  Valid;
+  QString               Error;
+};
+
+//------------------------------------------------------------------------------
+/// State shared by the stages of one addDirectory() call.
+struct ctkDICOMIndexerPipeline
+{
+  ctkDICOMIndexerPipeline(int queueSize, int parserCount,
+                          ctkDICOMIndexer::ParsingMode mode);
+
+  /// Called by the parse tasks after each file with the bytes read, -1 if
+  /// unknown, and the parsing time, thread-safe
+  void addParsedFile(qint64 bytes, qint64 microseconds);
+
+  const ctkDICOMIndexer::ParsingMode ParsingMode;
+
+  ctkDICOMIndexerQueue<ctkDICOMIndexerScannedFile> Files;
+  ctkDICOMIndexerQueue<ctkDICOMIndexerParsedFile>  Parsed;
+
+  /// Stats of the images and modification time of the directories already
+  /// in the database, read once before the scan starts. Read-only while the
+  /// pipeline runs. The stats of the images indexed before they were
+  /// recorded have a Size of -1 and their InsertTimestamp as MTime.
+  QHash<QString, ctkDICOMIndexerFileStat> IndexedFiles;
+  QHash<QString, qint64>                  IndexedDirectories;
+
+  /// Files and directories that were indexed but don't exist anymore, and
+  /// modification time of the directories that were listed. Written by the
+  /// scan task, read once it is finished.
+  QStringList            RemovedFiles;
+  QStringList            RemovedDirectories;
+  QHash<QString, qint64> ScannedDirectories;
+
+  QAtomicInt ScannedCount;
+  QAtomicInt SkippedCount;
+  QAtomicInt SkippedDirectoryCount;
+  QAtomicInt ScanFinished;
+
+  QMutex                      StatisticsMutex;
+  ctkDICOMIndexer::Statistics Statistics;
+};
+
+//------------------------------------------------------------------------------
+/// First stage: walk the directory tree and queue the files to parse.
+/// A directory whose modification time didn't change since it was indexed
+/// has the same entries: it is not listed, its known subdirectories are
+/// walked and its files are assumed unchanged. The files of the other
+/// directories are queued only if their stats changed.
+class ctkDICOMIndexerScanTask : public QRunnable
+{
+public:
+  ctkDICOMIndexerScanTask(ctkDICOMIndexerPipeline* pipeline,
+                          const QString& directory, const QAtomicInt* canceled);
+  virtual void run();
+private:
+  /// Record that @param dirname and everything below are removed
+  void removeDirectory(const QString& dirname);
+  /// Queue @param file for parsing unless the journal has the same stat,
+  /// false if the pipeline was stopped
+  bool queue(ctkDICOMIndexerScannedFile& file, qint64 recentTime, qint64& blockedTime);
+
+  /// Indexed files and directories grouped by parent directory
+  QHash<QString, QStringList> KnownFiles;
+  QHash<QString, QStringList> KnownDirectories;
+
+  ctkDICOMIndexerPipeline* Pipeline;
+  QString                  Directory;
+  const QAtomicInt*        Canceled;
+};
+
+//------------------------------------------------------------------------------
+/// Second stage: parse the DICOM headers of the queued files. Several tasks
+/// run concurrently, one per worker thread.
+class ctkDICOMIndexerParseTask : public QRunnable
+{
+public:
+  ctkDICOMIndexerParseTask(ctkDICOMIndexerPipeline* pipeline);
+  virtual void run();
+private:
+  ctkDICOMIndexerPipeline* Pipeline;
+};
+
+//------------------------------------------------------------------------------
+class ctkDICOMIndexerPrivate: public ctkPrivate<ctkDICOMIndexer>
+{
+public:
+  ctkDICOMIndexerPrivate();
+  ~ctkDICOMIndexerPrivate();
+
+  /// Third stage: start storing the file if a destination is set and write
+  /// the record in the database. Must be called from the thread owning the
+  /// database connection.
+  bool insertRecord(const ctkDICOMIndexerRecord& record, bool store);
+
+  int        NumberOfThreads;
+  int        QueueSize;
+  QAtomicInt Canceled;
+
+  ctkDICOMIndexer::ParsingMode ParsingMode;
+  ctkDICOMIndexer::Statistics  LastStatistics;
+  /// Time spent by insertRecord in the database writer and in the
+  /// storage during the running addDirectory, in microseconds
+  qint64 DatabaseTime;
+  qint64 StorageTime;
+
+  ctkDICOMDatabaseWriter Writer;
+  ctkDICOMStorage        Storage;
+};
+
+#endif
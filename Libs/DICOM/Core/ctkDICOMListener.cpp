@@ -0,0 +1,633 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+// ctkDICOM includes
+#include "ctkDICOMIndexer_p.h"
+#include "ctkDICOMListener.h"
+#include "ctkDICOMListener_p.h"
+#include "ctkDICOMTimer_p.h"
+#include "ctkLogger.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcfilefo.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/dcmdata/dcuid.h>
+#include <dcmtk/dcmnet/diutil.h>
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMListener" );
+
+namespace
+{
+//------------------------------------------------------------------------------
+/// The datasets are stored in the transfer syntax they are received in,
+/// the uncompressed syntaxes are preferred
+const char* TransferSyntaxes[] = {
+  UID_LittleEndianExplicitTransferSyntax,
+  UID_BigEndianExplicitTransferSyntax,
+  UID_LittleEndianImplicitTransferSyntax,
+  UID_JPEGProcess14SV1TransferSyntax,
+  UID_JPEGProcess1TransferSyntax,
+  UID_JPEGLSLosslessTransferSyntax,
+  UID_JPEG2000LosslessOnlyTransferSyntax,
+  UID_JPEG2000TransferSyntax,
+  UID_RLELosslessTransferSyntax };
+const int TransferSyntaxCount = 9;
+
+//------------------------------------------------------------------------------
+/// See DIMSE_StoreProviderCallback
+void storeCallback(void* task, T_DIMSE_StoreProgress* progress,
+                   T_DIMSE_C_StoreRQ* request, char* /*imageFileName*/,
+                   DcmDataset** /*imageDataSet*/, T_DIMSE_C_StoreRSP* response,
+                   DcmDataset** /*statusDetail*/)
+{
+  if (progress->state == DIMSE_StoreEnd)
+    {
+    static_cast<ctkDICOMListenerAssociationTask*>(task)->storeDataset(request, response);
+    }
+}
+
+//------------------------------------------------------------------------------
+void destroyAssociation(T_ASC_Association** association)
+{
+  ASC_dropAssociation(*association);
+  ASC_destroyAssociation(association);
+}
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMListener::Statistics::Statistics()
+{
+  this->Associations = 0;
+  this->ActiveAssociations = 0;
+  this->PeakAssociations = 0;
+  this->RejectedAssociations = 0;
+  this->InstancesReceived = 0;
+  this->InstancesFailed = 0;
+  this->BytesReceived = 0;
+  this->InstancesPerSecond = 0.;
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMListenerAcceptTask methods
+
+//------------------------------------------------------------------------------
+ctkDICOMListenerAcceptTask::ctkDICOMListenerAcceptTask(ctkDICOMListenerPrivate* listener)
+{
+  this->Listener = listener;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListenerAcceptTask::run()
+{
+  ctkDICOMListenerPrivate* d = this->Listener;
+  while (!d->Stopped)
+    {
+    // wake up every second to check if the listener is stopped
+    if (!ASC_associationWaiting(d->Network, 1))
+      {
+      continue;
+      }
+    T_ASC_Association* association = NULL;
+    OFCondition cond = ASC_receiveAssociation(d->Network, &association, ASC_DEFAULTMAXPDU);
+    if (cond.bad())
+      {
+      logger.warn ( QString("Could not receive an association: ") + cond.text() );
+      if (association)
+        {
+        destroyAssociation(&association);
+        }
+      continue;
+      }
+
+    char callingAETitle[64];
+    char calledAETitle[64];
+    char respondingAETitle[64];
+    ASC_getAPTitles(association->params, callingAETitle, calledAETitle, respondingAETitle);
+    T_ASC_RejectParameters reject;
+    bool rejected = false;
+    if (!d->AETitle.isEmpty() && d->AETitle != QString(calledAETitle).trimmed())
+      {
+      logger.warn ( QString("Rejected association of %1: called AE %2 is not %3")
+                    .arg(callingAETitle).arg(calledAETitle).arg(d->AETitle) );
+      reject.result = ASC_RESULT_REJECTEDPERMANENT;
+      reject.source = ASC_SOURCE_SERVICEUSER;
+      reject.reason = ASC_REASON_SU_CALLEDAETITLENOTRECOGNIZED;
+      rejected = true;
+      }
+    else if (!d->reserveAssociation())
+      {
+      logger.warn ( QString("Rejected association of %1: %2 associations are served")
+                    .arg(callingAETitle).arg(d->MaximumAssociations) );
+      reject.result = ASC_RESULT_REJECTEDTRANSIENT;
+      reject.source = ASC_SOURCE_SERVICEPROVIDER_PRESENTATION_RELATED;
+      reject.reason = ASC_REASON_SP_PRES_LOCALLIMITEXCEEDED;
+      rejected = true;
+      }
+    if (rejected)
+      {
+      d->rejectAssociation();
+      ASC_rejectAssociation(association, &reject);
+      destroyAssociation(&association);
+      continue;
+      }
+
+    if (!this->negotiate(association))
+      {
+      d->associationFinished();
+      destroyAssociation(&association);
+      continue;
+      }
+    d->Pool.start(new ctkDICOMListenerAssociationTask(d, association,
+                                                      QString(callingAETitle).trimmed()));
+    }
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMListenerAcceptTask::negotiate(T_ASC_Association* association)
+{
+  const char* verification[] = { UID_VerificationSOPClass };
+  OFCondition cond = ASC_acceptContextsWithPreferredTransferSyntaxes(association->params,
+    verification, 1, TransferSyntaxes, TransferSyntaxCount);
+  if (cond.good())
+    {
+    cond = ASC_acceptContextsWithPreferredTransferSyntaxes(association->params,
+      dcmAllStorageSOPClassUIDs, numberOfAllDcmStorageSOPClassUIDs,
+      TransferSyntaxes, TransferSyntaxCount);
+    }
+  if (cond.good())
+    {
+    cond = ASC_acknowledgeAssociation(association);
+    }
+  if (cond.bad())
+    {
+    logger.error ( QString("Could not accept an association: ") + cond.text() );
+    }
+  return cond.good();
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMListenerAssociationTask methods
+
+//------------------------------------------------------------------------------
+ctkDICOMListenerAssociationTask::ctkDICOMListenerAssociationTask(
+  ctkDICOMListenerPrivate* listener, T_ASC_Association* association,
+  const QString& callingAETitle)
+{
+  this->Listener = listener;
+  this->Association = association;
+  this->CallingAETitle = callingAETitle;
+  this->FileFormat = 0;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListenerAssociationTask::run()
+{
+  ctkDICOMListenerPrivate* d = this->Listener;
+  OFCondition cond = EC_Normal;
+  int idleSeconds = 0;
+  while (cond.good() && !d->Stopped)
+    {
+    // wait for the next command one second at a time to check if the
+    // listener is stopped
+    T_DIMSE_Message message;
+    T_ASC_PresentationContextID presID = 0;
+    cond = DIMSE_receiveCommand(this->Association, DIMSE_NONBLOCKING, 1,
+                                &presID, &message, NULL);
+    if (cond == DIMSE_NODATAAVAILABLE)
+      {
+      cond = ++idleSeconds < d->Timeout || d->Timeout == 0 ? EC_Normal : DIMSE_NODATAAVAILABLE;
+      continue;
+      }
+    idleSeconds = 0;
+    if (cond.bad())
+      {
+      break;
+      }
+    switch (message.CommandField)
+      {
+      case DIMSE_C_ECHO_RQ:
+        cond = DIMSE_sendEchoResponse(this->Association, presID,
+                                      &message.msg.CEchoRQ, STATUS_Success, NULL);
+        break;
+      case DIMSE_C_STORE_RQ:
+        cond = this->storeInstance(&message, presID);
+        break;
+      default:
+        cond = DIMSE_BADCOMMANDTYPE;
+        break;
+      }
+    }
+
+  if (cond == DUL_PEERREQUESTEDRELEASE)
+    {
+    ASC_acknowledgeRelease(this->Association);
+    ASC_dropSCPAssociation(this->Association);
+    ASC_destroyAssociation(&this->Association);
+    }
+  else
+    {
+    // the associations still open when the listener stops are aborted
+    if (cond != DUL_PEERABORTEDASSOCIATION)
+      {
+      if (cond.bad())
+        {
+        logger.warn ( "Aborting the association of " + this->CallingAETitle + ": " +
+                      cond.text() );
+        }
+      ASC_abortAssociation(this->Association);
+      }
+    destroyAssociation(&this->Association);
+    }
+  d->associationFinished();
+}
+
+//------------------------------------------------------------------------------
+OFCondition ctkDICOMListenerAssociationTask::storeInstance(
+  T_DIMSE_Message* message, T_ASC_PresentationContextID presentationContextID)
+{
+  // DCMTK reads the dataset directly in the file format that is saved
+  DcmFileFormat fileformat;
+  DcmDataset* dataset = fileformat.getDataset();
+  this->FileFormat = &fileformat;
+  const int timeout = this->Listener->Timeout;
+  OFCondition cond = DIMSE_storeProvider(this->Association, presentationContextID,
+    &message->msg.CStoreRQ, NULL, OFFalse, &dataset, storeCallback, this,
+    timeout > 0 ? DIMSE_NONBLOCKING : DIMSE_BLOCKING, timeout);
+  this->FileFormat = 0;
+  if (cond.bad())
+    {
+    logger.error ( "Could not receive an instance from " + this->CallingAETitle +
+                   ": " + cond.text() );
+    }
+  return cond;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListenerAssociationTask::storeDataset(T_DIMSE_C_StoreRQ* request,
+                                                   T_DIMSE_C_StoreRSP* response)
+{
+  ctkDICOMListenerPrivate* d = this->Listener;
+  ctkDICOMIndexerRecord record;
+  QString error;
+  if (!record.readDataset(this->FileFormat->getDataset(), &error))
+    {
+    logger.error ( "Could not read " + error + " in the instance received from " +
+                   this->CallingAETitle );
+    response->DimseStatus = STATUS_STORE_Error_CannotUnderstand;
+    d->instanceFailed();
+    return;
+    }
+  if (record.SOPInstanceUID.isEmpty())
+    {
+    record.SOPInstanceUID = request->AffectedSOPInstanceUID;
+    }
+
+  // The dataset is written next to its destination and renamed, the
+  // readers of the storage directory never see a partial file. Several
+  // associations can receive the same instance at the same time.
+  const QString fileName = d->Storage.destinationPath(record);
+  const QString partialFileName = fileName +
+    QString(".%1.part").arg(reinterpret_cast<quintptr>(this), 0, 16);
+  QFileInfo(fileName).dir().mkpath(".");
+  OFCondition cond = this->FileFormat->saveFile(
+    QFile::encodeName(partialFileName).constData(), EXS_Unknown);
+  if (cond.bad())
+    {
+    logger.error ( "Could not write " + partialFileName + ": " + cond.text() );
+    QFile::remove(partialFileName);
+    response->DimseStatus = STATUS_STORE_Refused_OutOfResources;
+    d->instanceFailed();
+    return;
+    }
+  if (!QFile::rename(partialFileName, fileName))
+    {
+    // an existing destination is the same instance
+    QFile::remove(partialFileName);
+    }
+
+  ctkDICOMIndexerFileStat stat;
+  if (!stat.read(fileName))
+    {
+    logger.error ( "Could not store " + fileName );
+    response->DimseStatus = STATUS_STORE_Refused_OutOfResources;
+    d->instanceFailed();
+    return;
+    }
+  record.Filename = fileName;
+  record.FileSize = stat.Size;
+  record.FileMTime = stat.MTime;
+  record.Inode = stat.Inode;
+  response->DimseStatus = STATUS_Success;
+  d->addInstance(record, stat.Size);
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMListenerPrivate methods
+
+//------------------------------------------------------------------------------
+ctkDICOMListenerPrivate::ctkDICOMListenerPrivate()
+{
+  this->AETitle = "CTKSTORESCP";
+  this->Port = 11112;
+  this->MaximumAssociations = 8;
+  this->Timeout = 30;
+  this->Network = 0;
+  this->FirstInstanceTime = 0;
+  this->LastInstanceTime = 0;
+  this->CommitTimer.setSingleShot(true);
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMListenerPrivate::reserveAssociation()
+{
+  QMutexLocker locker(&this->Mutex);
+  if (this->Statistics.ActiveAssociations >= this->MaximumAssociations)
+    {
+    return false;
+    }
+  ++this->Statistics.Associations;
+  ++this->Statistics.ActiveAssociations;
+  this->Statistics.PeakAssociations =
+    qMax(this->Statistics.PeakAssociations, this->Statistics.ActiveAssociations);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListenerPrivate::rejectAssociation()
+{
+  QMutexLocker locker(&this->Mutex);
+  ++this->Statistics.RejectedAssociations;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListenerPrivate::associationFinished()
+{
+  QMutexLocker locker(&this->Mutex);
+  --this->Statistics.ActiveAssociations;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListenerPrivate::addInstance(const ctkDICOMIndexerRecord& record, qint64 bytes)
+{
+  CTK_P(ctkDICOMListener);
+  QMutexLocker locker(&this->Mutex);
+  this->LastInstanceTime = ctkDICOMTimer::now();
+  if (this->Statistics.InstancesReceived == 0)
+    {
+    this->FirstInstanceTime = this->LastInstanceTime;
+    }
+  ++this->Statistics.InstancesReceived;
+  this->Statistics.BytesReceived += bytes;
+  this->Received << record;
+  // the records received until the listener thread processes them are
+  // inserted together
+  if (this->Received.size() == 1)
+    {
+    QMetaObject::invokeMethod(p, "insertReceivedInstances", Qt::QueuedConnection);
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListenerPrivate::instanceFailed()
+{
+  QMutexLocker locker(&this->Mutex);
+  ++this->Statistics.InstancesFailed;
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMListener methods
+
+//------------------------------------------------------------------------------
+ctkDICOMListener::ctkDICOMListener(QObject* parent)
+  : Superclass(parent)
+{
+  CTK_INIT_PRIVATE(ctkDICOMListener);
+  CTK_D(ctkDICOMListener);
+  connect(&d->CommitTimer, SIGNAL(timeout()), this, SLOT(commitReceivedInstances()));
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMListener::~ctkDICOMListener()
+{
+  this->stop();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListener::setAETitle(const QString& title)
+{
+  CTK_D(ctkDICOMListener);
+  d->AETitle = title;
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMListener::AETitle()const
+{
+  CTK_D(const ctkDICOMListener);
+  return d->AETitle;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListener::setPort(int port)
+{
+  CTK_D(ctkDICOMListener);
+  d->Port = port;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMListener::port()const
+{
+  CTK_D(const ctkDICOMListener);
+  return d->Port;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListener::setMaximumAssociations(int associations)
+{
+  CTK_D(ctkDICOMListener);
+  d->MaximumAssociations = qMax(associations, 1);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMListener::maximumAssociations()const
+{
+  CTK_D(const ctkDICOMListener);
+  return d->MaximumAssociations;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListener::setTimeout(int seconds)
+{
+  CTK_D(ctkDICOMListener);
+  d->Timeout = qMax(seconds, 0);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMListener::timeout()const
+{
+  CTK_D(const ctkDICOMListener);
+  return d->Timeout;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListener::setStorageDirectory(const QString& directory)
+{
+  CTK_D(ctkDICOMListener);
+  d->Storage.setDirectory(directory);
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMListener::storageDirectory()const
+{
+  CTK_D(const ctkDICOMListener);
+  return d->Storage.directory();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListener::setDatabase(QSqlDatabase database)
+{
+  CTK_D(ctkDICOMListener);
+  d->Database = database;
+  d->Writer.setDatabase(database);
+}
+
+//------------------------------------------------------------------------------
+QSqlDatabase ctkDICOMListener::database()const
+{
+  CTK_D(const ctkDICOMListener);
+  return d->Database;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMListener::start()
+{
+  CTK_D(ctkDICOMListener);
+  if (d->Network)
+    {
+    logger.error ( "The listener is already running" );
+    return false;
+    }
+  if (d->Storage.directory().isEmpty())
+    {
+    logger.error ( "The listener has no storage directory" );
+    return false;
+    }
+  OFCondition cond = ASC_initializeNetwork(NET_ACCEPTOR, d->Port, d->Timeout, &d->Network);
+  if (cond.bad())
+    {
+    logger.error ( QString("Could not listen on port %1: %2").arg(d->Port).arg(cond.text()) );
+    d->Network = 0;
+    return false;
+    }
+  {
+  QMutexLocker locker(&d->Mutex);
+  d->Statistics = Statistics();
+  }
+  d->Stopped.fetchAndStoreOrdered(0);
+  // one thread accepts, the others serve the associations
+  d->Pool.setMaxThreadCount(d->MaximumAssociations + 1);
+  d->Pool.start(new ctkDICOMListenerAcceptTask(d));
+  logger.info ( QString("Listening as %1 on port %2").arg(d->AETitle).arg(d->Port) );
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMListener::isListening()const
+{
+  CTK_D(const ctkDICOMListener);
+  return d->Network != 0;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListener::stop()
+{
+  CTK_D(ctkDICOMListener);
+  if (!d->Network)
+    {
+    return;
+    }
+  d->Stopped.fetchAndStoreOrdered(1);
+  d->Pool.waitForDone();
+  ASC_dropNetwork(&d->Network);
+  d->Network = 0;
+  this->insertReceivedInstances();
+  this->commitReceivedInstances();
+  const Statistics statistics = this->statistics();
+  logger.info ( QString("Stopped listening: %1 associations, %2 rejected, "
+                        "%3 instances received, %4 failed, %5 instances/s")
+                .arg(statistics.Associations).arg(statistics.RejectedAssociations)
+                .arg(statistics.InstancesReceived).arg(statistics.InstancesFailed)
+                .arg(statistics.InstancesPerSecond) );
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMListener::Statistics ctkDICOMListener::statistics()const
+{
+  CTK_D(const ctkDICOMListener);
+  QMutexLocker locker(&d->Mutex);
+  Statistics statistics = d->Statistics;
+  const qint64 microseconds = d->LastInstanceTime - d->FirstInstanceTime;
+  if (statistics.InstancesReceived > 1 && microseconds > 0)
+    {
+    statistics.InstancesPerSecond =
+      (statistics.InstancesReceived - 1) * 1000000. / microseconds;
+    }
+  return statistics;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListener::insertReceivedInstances()
+{
+  CTK_D(ctkDICOMListener);
+  QList<ctkDICOMIndexerRecord> received;
+  {
+  QMutexLocker locker(&d->Mutex);
+  qSwap(received, d->Received);
+  }
+  foreach(const ctkDICOMIndexerRecord& record, received)
+    {
+    if (d->Database.isOpen())
+      {
+      d->Writer.insert(record);
+      }
+    emit this->instanceReceived(record.Filename);
+    }
+  // the writer commits full batches, the last records are committed once
+  // no instance arrived for a batch interval
+  if (!received.isEmpty())
+    {
+    d->CommitTimer.start(d->Writer.batchInterval());
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMListener::commitReceivedInstances()
+{
+  CTK_D(ctkDICOMListener);
+  d->CommitTimer.stop();
+  d->Writer.commit();
+}
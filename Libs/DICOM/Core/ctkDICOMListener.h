@@ -0,0 +1,144 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMListener_h
+#define __ctkDICOMListener_h
+
+// Qt includes
+#include <QObject>
+#include <QSqlDatabase>
+#include <QString>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMCoreExport.h"
+
+class ctkDICOMListenerPrivate;
+
+///
+/// Storage SCP: accepts the C-STORE and C-ECHO requests of remote AEs on
+/// port(), for instance of storescu.
+/// A thread accepts the associations and each association is served by a
+/// thread of a pool, maximumAssociations() associations are served at the
+/// same time, the next ones are rejected until one is released.
+/// A received dataset is parsed once, by DCMTK while it is received: its
+/// record is read from the dataset in memory and the dataset is written in
+/// storageDirectory() with the layout of ctkDICOMStorage. The records are
+/// written in database() from the thread of the listener, in the batches
+/// of ctkDICOMDatabaseWriter, the listener needs an event loop.
+class CTK_DICOM_CORE_EXPORT ctkDICOMListener : public QObject
+{
+  Q_OBJECT
+  Q_PROPERTY(QString AETitle READ AETitle WRITE setAETitle);
+  Q_PROPERTY(int port READ port WRITE setPort);
+  Q_PROPERTY(int maximumAssociations READ maximumAssociations WRITE setMaximumAssociations);
+  Q_PROPERTY(int timeout READ timeout WRITE setTimeout);
+  Q_PROPERTY(QString storageDirectory READ storageDirectory WRITE setStorageDirectory);
+public:
+  typedef QObject Superclass;
+
+  /// Counters since the last start()
+  struct Statistics
+  {
+    Statistics();
+    /// Associations accepted, being served, at most served at the same
+    /// time, and rejected
+    int    Associations;
+    int    ActiveAssociations;
+    int    PeakAssociations;
+    int    RejectedAssociations;
+    /// Instances stored, and refused because they could not be read or
+    /// written
+    int    InstancesReceived;
+    int    InstancesFailed;
+    /// Size of the stored files
+    qint64 BytesReceived;
+    /// Instances stored per second, between the first and the last one
+    double InstancesPerSecond;
+  };
+
+  explicit ctkDICOMListener(QObject* parent = 0);
+  /// stop() the listener
+  virtual ~ctkDICOMListener();
+
+  ///
+  /// Called AE title of the accepted associations, any title is accepted if
+  /// empty. Default is CTKSTORESCP.
+  void setAETitle(const QString& title);
+  QString AETitle()const;
+
+  ///
+  /// Default is 11112
+  void setPort(int port);
+  int port()const;
+
+  ///
+  /// Number of associations served at the same time. Default is 8.
+  void setMaximumAssociations(int associations);
+  int maximumAssociations()const;
+
+  ///
+  /// Seconds an association can stay idle before it is aborted, and
+  /// timeout of the negotiation and of each message. Default is 30.
+  void setTimeout(int seconds);
+  int timeout()const;
+
+  ///
+  /// Directory the received instances are stored in, as
+  /// <directory>/<StudyInstanceUID>/<SeriesInstanceUID>/<SOPInstanceUID>.dcm
+  void setStorageDirectory(const QString& directory);
+  QString storageDirectory()const;
+
+  ///
+  /// If set, the received instances are indexed in this database
+  void setDatabase(QSqlDatabase database);
+  QSqlDatabase database()const;
+
+  ///
+  /// Listen on port(). Return false if the listener is already running,
+  /// if there is no storage directory or if the port can't be opened.
+  /// The properties can't be changed while listening.
+  bool start();
+  bool isListening()const;
+
+  Statistics statistics()const;
+
+public slots:
+  ///
+  /// Abort the associations, wait for their threads and index the last
+  /// received instances
+  void stop();
+
+signals:
+  /// Emitted in the thread of the listener when a received instance is
+  /// indexed
+  void instanceReceived(const QString& fileName);
+
+protected slots:
+  /// Write the instances received by the associations in the database
+  void insertReceivedInstances();
+  void commitReceivedInstances();
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMListener);
+};
+
+#endif
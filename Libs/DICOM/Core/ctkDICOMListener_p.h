@@ -0,0 +1,125 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMListener_p_h
+#define __ctkDICOMListener_p_h
+
+// Qt includes
+#include <QAtomicInt>
+#include <QList>
+#include <QMutex>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QTimer>
+
+// ctkDICOM includes
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMListener.h"
+#include "ctkDICOMStorage.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmnet/assoc.h>
+#include <dcmtk/dcmnet/dimse.h>
+
+class DcmFileFormat;
+class ctkDICOMListenerPrivate;
+
+//------------------------------------------------------------------------------
+/// Accept the associations until the listener is stopped
+class ctkDICOMListenerAcceptTask : public QRunnable
+{
+public:
+  ctkDICOMListenerAcceptTask(ctkDICOMListenerPrivate* listener);
+  virtual void run();
+
+private:
+  /// Accept the contexts of the storage SOP classes and of verification
+  bool negotiate(T_ASC_Association* association);
+
+  ctkDICOMListenerPrivate* Listener;
+};
+
+//------------------------------------------------------------------------------
+/// Serve one accepted association until it is released or aborted
+class ctkDICOMListenerAssociationTask : public QRunnable
+{
+public:
+  ctkDICOMListenerAssociationTask(ctkDICOMListenerPrivate* listener,
+                                  T_ASC_Association* association,
+                                  const QString& callingAETitle);
+  virtual void run();
+
+  /// Called by DIMSE_storeProvider once the dataset is received, set the
+  /// status of @param response
+  void storeDataset(T_DIMSE_C_StoreRQ* request, T_DIMSE_C_StoreRSP* response);
+
+private:
+  OFCondition storeInstance(T_DIMSE_Message* message,
+                            T_ASC_PresentationContextID presentationContextID);
+
+  ctkDICOMListenerPrivate* Listener;
+  T_ASC_Association*       Association;
+  QString                  CallingAETitle;
+  /// Dataset being received by storeInstance
+  DcmFileFormat*           FileFormat;
+};
+
+//------------------------------------------------------------------------------
+class ctkDICOMListenerPrivate: public ctkPrivate<ctkDICOMListener>
+{
+public:
+  ctkDICOMListenerPrivate();
+
+  /// The following methods are called by the tasks
+  /// Return false if maximumAssociations are already served
+  bool reserveAssociation();
+  void rejectAssociation();
+  void associationFinished();
+  void addInstance(const ctkDICOMIndexerRecord& record, qint64 bytes);
+  void instanceFailed();
+
+  QString AETitle;
+  int     Port;
+  int     MaximumAssociations;
+  int     Timeout;
+
+  /// Only used for its layout
+  ctkDICOMStorage        Storage;
+  QSqlDatabase           Database;
+  ctkDICOMDatabaseWriter Writer;
+  QTimer                 CommitTimer;
+
+  T_ASC_Network* Network;
+  QAtomicInt     Stopped;
+  QThreadPool    Pool;
+
+  /// Written by the tasks
+  mutable QMutex                 Mutex;
+  QList<ctkDICOMIndexerRecord>   Received;
+  ctkDICOMListener::Statistics   Statistics;
+  qint64                         FirstInstanceTime;
+  qint64                         LastInstanceTime;
+};
+
+#endif
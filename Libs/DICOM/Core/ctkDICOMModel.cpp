@@ -19,12 +19,19 @@
 =========================================================================*/
 
 // Qt includes
+#include <QCache>
+#include <QHash>
+#include <QMutex>
+#include <QSet>
 #include <QStringList>
 #include <QSqlDriver>
 #include <QSqlError>
 #include <QSqlQuery>
 #include <QSqlQueryModel>
 #include <QSqlRecord>
+#include <QThread>
+#include <QVector>
+#include <QWaitCondition>
 
 #include <QTime>
 #include <QDebug>
@@ -36,6 +43,129 @@
 static ctkLogger logger ( "org.commontk.dicom.DICOMModel" );
 struct Node;
 
+//------------------------------------------------------------------------------
+/// Rows [Index * BlockSize, (Index + 1) * BlockSize[ of the query of a node,
+/// stored by column
+struct ctkDICOMModelBlock
+{
+  Node*       Parent;
+  int         Generation;
+  int         Index;
+  /// Number of rows of the query if requested with the block, -1 otherwise
+  int         Count;
+  int         RowCount;
+  QStringList Fields;
+  QVector<QVector<QVariant> > Columns;
+};
+
+//------------------------------------------------------------------------------
+/// Position of a row in the order of the query of its parent: the value of
+/// the sort field and the UID, which breaks the ties
+struct ctkDICOMModelKey
+{
+  QVariant Value;
+  QVariant UID;
+};
+
+//------------------------------------------------------------------------------
+struct ctkDICOMModelRequest
+{
+  Node*        Parent;
+  int          Generation;
+  int          Index;
+  /// Empty if the rows are not counted
+  QString      CountQuery;
+  QString      Query;
+  QVariantList Values;
+  /// The query selects the rows of the block in the reverse order
+  bool         Reverse;
+};
+
+namespace
+{
+//------------------------------------------------------------------------------
+ctkDICOMModelBlock* loadBlock(const QSqlDatabase& database, const ctkDICOMModelRequest& request)
+{
+  ctkDICOMModelBlock* block = new ctkDICOMModelBlock;
+  block->Parent = request.Parent;
+  block->Generation = request.Generation;
+  block->Index = request.Index;
+  block->Count = -1;
+  block->RowCount = 0;
+  if (!request.CountQuery.isEmpty())
+    {
+    QSqlQuery count(request.CountQuery, database);
+    block->Count = count.next() ? count.value(0).toInt() : 0;
+    }
+  QSqlQuery query(database);
+  query.setForwardOnly(true);
+  query.prepare(request.Query);
+  foreach(const QVariant& value, request.Values)
+    {
+    query.addBindValue(value);
+    }
+  if (!query.exec())
+    {
+    logger.error ( "Could not fetch the rows of " + request.Query + ": " +
+                   query.lastError().text() );
+    return block;
+    }
+  const QSqlRecord record = query.record();
+  block->Columns.resize(record.count());
+  for (int i = 0; i < record.count(); ++i)
+    {
+    block->Fields << record.fieldName(i);
+    }
+  while (query.next())
+    {
+    for (int i = 0; i < block->Columns.size(); ++i)
+      {
+      block->Columns[i].append(query.value(i));
+      }
+    ++block->RowCount;
+    }
+  if (request.Reverse)
+    {
+    for (int i = 0; i < block->Columns.size(); ++i)
+      {
+      QVector<QVariant>& column = block->Columns[i];
+      for (int first = 0, last = column.size() - 1; first < last; ++first, --last)
+        {
+        qSwap(column[first], column[last]);
+        }
+      }
+    }
+  return block;
+}
+}
+
+//------------------------------------------------------------------------------
+/// Thread running the queries of the model on its own connection to the
+/// database. The most recent requests are served first: they are the rows
+/// the view shows now.
+class ctkDICOMModelFetcher : public QThread
+{
+public:
+  ctkDICOMModelFetcher(ctkDICOMModel* model, const QSqlDatabase& database);
+  virtual ~ctkDICOMModelFetcher();
+
+  void request(const ctkDICOMModelRequest& request);
+  /// Forget the requests not started yet
+  void clearRequests();
+  QList<ctkDICOMModelBlock*> takeResults();
+
+protected:
+  virtual void run();
+
+  ctkDICOMModel* const        Model;
+  const QSqlDatabase          Source;
+  QMutex                      Mutex;
+  QWaitCondition              RequestsAvailable;
+  bool                        Stopping;
+  QList<ctkDICOMModelRequest> Requests;
+  QList<ctkDICOMModelBlock*>  Results;
+};
+
 //------------------------------------------------------------------------------
 class ctkDICOMModelPrivate:public ctkPrivate<ctkDICOMModel>
 {
@@ -55,19 +185,68 @@ public:
   void fetch(const QModelIndex& indexValue, int limit);
   Node* createNode(int row, const QModelIndex& parentValue)const;
   Node* nodeFromIndex(const QModelIndex& indexValue)const;
+  QModelIndex indexFromNode(Node* node)const;
   //QModelIndexList indexListFromNode(const Node* node)const;
   //QModelIndexList modelIndexList(Node* node = 0)const;
   //int childrenCount(Node* node = 0)const;
   // move it in the Node struct
-  QVariant value(Node* parentValue, int row, int field)const;
-  QVariant value(const QModelIndex& indexValue, int row, int field)const;
+  QVariant value(Node* parentValue, int row, const QString& field)const;
   QString  generateQuery(const QString& fields, const QString& table, const QString& conditions = QString())const;
   void updateQueries(Node* node)const;
+  /// ORDER BY clause of the rows of node, in the reverse order if reverse
+  /// is true
+  QString orderBy(const Node* node, bool reverse)const;
+  /// Condition selecting the rows of node after key in the order of
+  /// orderBy(node, reverse), its values are appended to values
+  QString after(const Node* node, bool reverse, const ctkDICOMModelKey& key,
+                QVariantList& values)const;
+  /// Row of the child uid of node, -1 if it is not found
+  int rowOf(const Node* node, const QString& uid)const;
+  /// Update the queries of node and its children to the sort order and
+  /// move the children in kept to their new rows, which are stored in
+  /// rows. The other children are deleted.
+  void sortNode(Node* node, const QSet<Node*>& kept, QHash<Node*, int>& rows);
+  /// Generate the query of node, the UID of node is read from its parent
+  void prepareQuery(Node* node)const;
+
+  /// Cached block, requested if missing and loaded right away if wait is true
+  /// or if there is no fetcher
+  const ctkDICOMModelBlock* block(Node* parentValue, int blockIndex, bool wait)const;
+  void request(Node* parentValue, int blockIndex, bool count)const;
+  /// Query of the block, starting from a neighbour block if its bounds are
+  /// known, from the closest end of the table otherwise
+  ctkDICOMModelRequest blockRequest(Node* parentValue, int blockIndex, bool count)const;
+  /// Cache the block, insert its rows if it comes with the row count and
+  /// emit dataChanged for its rows if notify is true
+  void insertBlock(ctkDICOMModelBlock* block, bool notify);
+  /// Delete the nodes and forget the cached and requested blocks
+  void clear();
+  /// Use the block size set by ctkDICOMModel::setBlockSize(), only when
+  /// no block is cached: the blocks are keyed by their index
+  void applyBlockSize();
+  static quint64 blockKey(const Node* node, int blockIndex);
 
   Node*        RootNode;
   QSqlDatabase DataBase;
   QStringList  Headers;
-  QString      Sort;
+  /// Header the rows are sorted by, empty if they are sorted by UID
+  QString       SortHeader;
+  Qt::SortOrder SortOrder;
+
+  int          BlockSize;
+  /// Block size used once the cached blocks are cleared
+  int          PendingBlockSize;
+  /// UIDs of the rows shown and of the rows shown with all their
+  /// descendants, per level, see ctkDICOMModel::setUIDFilter()
+  QList<QSet<QString> > FilterShown;
+  QList<QSet<QString> > FilterComplete;
+  /// Incremented each time the nodes are deleted, the blocks requested
+  /// before are dropped
+  int          Generation;
+  int          NodeCount;
+  ctkDICOMModelFetcher*                   Fetcher;
+  mutable QCache<quint64, ctkDICOMModelBlock> Blocks;
+  mutable QSet<quint64>                   PendingBlocks;
 };
 
 //------------------------------------------------------------------------------
@@ -84,24 +263,134 @@ struct Node
     }
   ctkDICOMModelPrivate::IndexType Type;
   Node*     Parent;
-  QVector<Node*> Children;
+  /// Children created so far, by row
+  QHash<int, Node*> Children;
+  int       Id;
   int       Row;
-  QSqlQuery Query;
+  QString   Query;
+  /// Field of Query the rows are sorted by, empty if sorted by UID only
+  QString   SortField;
   QString   UID;
+  /// Keys of the first and last rows of the blocks fetched, to start the
+  /// fetch of their neighbours from them
+  QHash<int, ctkDICOMModelKey> FirstKeys;
+  QHash<int, ctkDICOMModelKey> LastKeys;
   int       RowCount;
   bool      AtEnd;
   bool      Fetching;
+  /// All the descendants are shown whatever the UID filter
+  bool      Unfiltered;
 };
 
+//------------------------------------------------------------------------------
+// ctkDICOMModelFetcher methods
+
+//------------------------------------------------------------------------------
+ctkDICOMModelFetcher::ctkDICOMModelFetcher(ctkDICOMModel* model, const QSqlDatabase& database)
+  : Model(model), Source(database)
+{
+  this->Stopping = false;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMModelFetcher::~ctkDICOMModelFetcher()
+{
+    {
+    QMutexLocker locker(&this->Mutex);
+    this->Stopping = true;
+    this->RequestsAvailable.wakeAll();
+    }
+  this->wait();
+  qDeleteAll(this->Results);
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModelFetcher::request(const ctkDICOMModelRequest& request)
+{
+  QMutexLocker locker(&this->Mutex);
+  this->Requests << request;
+  this->RequestsAvailable.wakeAll();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModelFetcher::clearRequests()
+{
+  QMutexLocker locker(&this->Mutex);
+  this->Requests.clear();
+}
+
+//------------------------------------------------------------------------------
+QList<ctkDICOMModelBlock*> ctkDICOMModelFetcher::takeResults()
+{
+  QMutexLocker locker(&this->Mutex);
+  QList<ctkDICOMModelBlock*> results;
+  qSwap(results, this->Results);
+  return results;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModelFetcher::run()
+{
+  // A connection can only be used by the thread that opened it
+  const QString connectionName =
+    QString("ctkDICOMModel-%1").arg(reinterpret_cast<quintptr>(this));
+  {
+  QSqlDatabase database = QSqlDatabase::cloneDatabase(this->Source, connectionName);
+  if (!database.open())
+    {
+    logger.error ( "Could not open the database in the fetch thread: " +
+                   database.lastError().text() );
+    }
+  while (true)
+    {
+    ctkDICOMModelRequest request;
+      {
+      QMutexLocker locker(&this->Mutex);
+      while (this->Requests.isEmpty() && !this->Stopping)
+        {
+        this->RequestsAvailable.wait(&this->Mutex);
+        }
+      if (this->Stopping)
+        {
+        break;
+        }
+      request = this->Requests.takeLast();
+      }
+    ctkDICOMModelBlock* block = loadBlock(database, request);
+    QMutexLocker locker(&this->Mutex);
+    if (this->Results.isEmpty())
+      {
+      QMetaObject::invokeMethod(this->Model, "processBlocks", Qt::QueuedConnection);
+      }
+    this->Results << block;
+    }
+  database.close();
+  }
+  QSqlDatabase::removeDatabase(connectionName);
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMModelPrivate methods
+
 //------------------------------------------------------------------------------
 ctkDICOMModelPrivate::ctkDICOMModelPrivate()
 {
   this->RootNode     = 0;
+  this->SortOrder    = Qt::AscendingOrder;
+  this->BlockSize    = 256;
+  this->PendingBlockSize = 256;
+  this->Generation   = 0;
+  this->NodeCount    = 0;
+  this->Fetcher      = 0;
+  this->Blocks.setMaxCost(64 * 1024);
 }
 
 //------------------------------------------------------------------------------
 ctkDICOMModelPrivate::~ctkDICOMModelPrivate()
 {
+  // the fetcher refers to the nodes
+  delete this->Fetcher;
+  this->Fetcher = 0;
   delete this->RootNode;
   this->RootNode = 0;
 }
@@ -119,6 +408,13 @@ Node* ctkDICOMModelPrivate::nodeFromIndex(const QModelIndex& indexValue)const
   return indexValue.isValid() ? reinterpret_cast<Node*>(indexValue.internalPointer()) : this->RootNode;
 }
 
+//------------------------------------------------------------------------------
+QModelIndex ctkDICOMModelPrivate::indexFromNode(Node* node)const
+{
+  CTK_P(const ctkDICOMModel);
+  return node == this->RootNode ? QModelIndex() : p->createIndex(node->Row, 0, node);
+}
+
 /*
 //------------------------------------------------------------------------------
 QModelIndexList ctkDICOMModelPrivate::indexListFromNode(const Node* node)const
@@ -201,51 +497,348 @@ Node* ctkDICOMModelPrivate::createNode(int row, const QModelIndex& parentValue)c
   else
     {
     nodeParent = this->nodeFromIndex(parentValue); 
-    nodeParent->Children.push_back(node);
+    nodeParent->Children.insert(row, node);
     node->Parent = nodeParent;
     node->Type = ctkDICOMModelPrivate::IndexType(nodeParent->Type + 1);
     }
+  node->Id = const_cast<ctkDICOMModelPrivate*>(this)->NodeCount++;
   node->Row = row;
-  if (node->Type != ctkDICOMModelPrivate::RootType)
-    {
-    int field = nodeParent->Query.record().indexOf("UID");
-    node->UID = this->value(parentValue, row, field).toString();
-    }
-  
   node->RowCount = 0;
   node->AtEnd = false;
   node->Fetching = false;
+  node->Unfiltered = false;
 
-  this->updateQueries(node);
+  // The UID and the query are only needed to fetch the children: a view
+  // creates an index for each visible row but expands a few of them
+  if (node->Type == ctkDICOMModelPrivate::RootType)
+    {
+    this->updateQueries(node);
+    }
   
   return node;
 }
 
 //------------------------------------------------------------------------------
-QVariant ctkDICOMModelPrivate::value(const QModelIndex& parentValue, int row, int column) const
+void ctkDICOMModelPrivate::prepareQuery(Node* node)const
+{
+  if (!node->Query.isEmpty() || node->Type == ctkDICOMModelPrivate::RootType)
+    {
+    return;
+    }
+  node->UID = this->value(node->Parent, node->Row, "UID").toString();
+  this->updateQueries(node);
+}
+
+//------------------------------------------------------------------------------
+quint64 ctkDICOMModelPrivate::blockKey(const Node* node, int blockIndex)
+{
+  return (static_cast<quint64>(node->Id) << 32) | static_cast<quint32>(blockIndex);
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModelPrivate::request(Node* parentValue, int blockIndex, bool count)const
 {
-  Node* node = this->nodeFromIndex(parentValue);
-  if (row >= node->RowCount)
-    {      
-    const_cast<ctkDICOMModelPrivate *>(this)->fetch(parentValue, row + 256);
+  const quint64 key = blockKey(parentValue, blockIndex);
+  // a block requested without the count doesn't answer a count request
+  if (!count && this->PendingBlocks.contains(key))
+    {
+    return;
+    }
+  this->PendingBlocks.insert(key);
+  const ctkDICOMModelRequest request = this->blockRequest(parentValue, blockIndex, count);
+  if (this->Fetcher)
+    {
+    this->Fetcher->request(request);
+    }
+  else
+    {
+    const_cast<ctkDICOMModelPrivate*>(this)->insertBlock(loadBlock(this->DataBase, request), count);
     }
-  return this->value(node, row, column);
 }
 
 //------------------------------------------------------------------------------
-QVariant ctkDICOMModelPrivate::value(Node* parentValue, int row, int column) const
+ctkDICOMModelRequest ctkDICOMModelPrivate::blockRequest(Node* parentValue, int blockIndex, bool count)const
 {
-  Q_ASSERT(row < parentValue->RowCount);
+  ctkDICOMModelRequest request;
+  request.Parent = parentValue;
+  request.Generation = this->Generation;
+  request.Index = blockIndex;
+  request.Reverse = false;
+  if (count)
+    {
+    request.CountQuery = QString("SELECT COUNT(*) FROM (%1)").arg(parentValue->Query);
+    }
 
-  if (!parentValue->Query.seek(row)) 
+  // Seeking from a known key only reads the rows of the block, OFFSET
+  // reads all the rows before them
+  const int first = blockIndex * this->BlockSize;
+  const int rowCount = parentValue->AtEnd ? parentValue->RowCount : -1;
+  int limit = this->BlockSize;
+  int offset = 0;
+  QString where;
+  if (parentValue->LastKeys.contains(blockIndex - 1))
+    {
+    where = this->after(parentValue, false, parentValue->LastKeys[blockIndex - 1], request.Values);
+    }
+  else if (parentValue->FirstKeys.contains(blockIndex + 1))
+    {
+    request.Reverse = true;
+    where = this->after(parentValue, true, parentValue->FirstKeys[blockIndex + 1], request.Values);
+    }
+  else if (blockIndex > 0 && rowCount > 0 && first > rowCount / 2)
     {
-    qDebug() << parentValue->Query.lastError();
-    Q_ASSERT(parentValue->Query.seek(row));
+    // closer to the end: the last block is read without offset
+    request.Reverse = true;
+    limit = qMin(this->BlockSize, rowCount - first);
+    offset = rowCount - first - limit;
+    }
+  else
+    {
+    offset = first;
+    }
+  request.Query = QString("SELECT * FROM (%1)").arg(parentValue->Query);
+  if (!where.isEmpty())
+    {
+    request.Query += " WHERE " + where;
+    }
+  request.Query += QString(" ORDER BY %1 LIMIT %2")
+    .arg(this->orderBy(parentValue, request.Reverse)).arg(limit);
+  if (offset > 0)
+    {
+    request.Query += QString(" OFFSET %1").arg(offset);
+    }
+  return request;
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMModelPrivate::orderBy(const Node* node, bool reverse)const
+{
+  const bool ascending = (this->SortOrder == Qt::AscendingOrder) != reverse;
+  const QString direction = ascending ? " ASC" : " DESC";
+  if (node->SortField.isEmpty())
+    {
+    return "UID" + direction;
+    }
+  return "\"" + node->SortField + "\"" + direction + ", UID" + direction;
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMModelPrivate::after(const Node* node, bool reverse,
+                                    const ctkDICOMModelKey& key, QVariantList& values)const
+{
+  const bool ascending = (this->SortOrder == Qt::AscendingOrder) != reverse;
+  const QString uidAfter = ascending ? "UID > ?" : "UID < ?";
+  if (node->SortField.isEmpty())
+    {
+    values << key.UID;
+    return uidAfter;
+    }
+  // NULL is before any value in SQLite
+  const QString field = "\"" + node->SortField + "\"";
+  if (key.Value.isNull())
+    {
+    values << key.UID;
+    return ascending ?
+      QString("((%1 IS NULL AND %2) OR %1 IS NOT NULL)").arg(field).arg(uidAfter) :
+      QString("(%1 IS NULL AND %2)").arg(field).arg(uidAfter);
+    }
+  values << key.Value << key.Value << key.UID;
+  return ascending ?
+    QString("(%1 > ? OR (%1 = ? AND %2))").arg(field).arg(uidAfter) :
+    QString("(%1 < ? OR (%1 = ? AND %2) OR %1 IS NULL)").arg(field).arg(uidAfter);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMModelPrivate::rowOf(const Node* node, const QString& uid)const
+{
+  QSqlQuery keyQuery(this->DataBase);
+  keyQuery.prepare(QString("SELECT %1, UID FROM (%2) WHERE UID = ?")
+                   .arg(node->SortField.isEmpty() ? QString("NULL") : "\"" + node->SortField + "\"")
+                   .arg(node->Query));
+  keyQuery.addBindValue(uid);
+  if (!keyQuery.exec() || !keyQuery.next())
+    {
+    return -1;
+    }
+  ctkDICOMModelKey key;
+  key.Value = keyQuery.value(0);
+  key.UID = keyQuery.value(1);
+  // the rows before the key are after it in the reverse order
+  QVariantList values;
+  QSqlQuery countQuery(this->DataBase);
+  countQuery.prepare(QString("SELECT COUNT(*) FROM (%1) WHERE %2")
+                     .arg(node->Query).arg(this->after(node, true, key, values)));
+  foreach(const QVariant& value, values)
+    {
+    countQuery.addBindValue(value);
+    }
+  if (!countQuery.exec() || !countQuery.next())
+    {
+    return -1;
+    }
+  return countQuery.value(0).toInt();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModelPrivate::sortNode(Node* node, const QSet<Node*>& kept, QHash<Node*, int>& rows)
+{
+  if (!node->Query.isEmpty())
+    {
+    this->updateQueries(node);
+    }
+  node->FirstKeys.clear();
+  node->LastKeys.clear();
+  QHash<int, Node*> children;
+  foreach(Node* child, node->Children)
+    {
+    const int row = kept.contains(child) ? this->rowOf(node, child->UID) : -1;
+    if (row < 0)
+      {
+      delete child;
+      continue;
+      }
+    child->Row = row;
+    rows.insert(child, row);
+    children.insert(row, child);
+    this->sortNode(child, kept, rows);
+    }
+  node->Children = children;
+  if (node->Fetching)
+    {
+    // the count was requested before the sort, it is dropped
+    this->request(node, 0, true);
+    }
+}
+
+//------------------------------------------------------------------------------
+const ctkDICOMModelBlock* ctkDICOMModelPrivate::block(Node* parentValue, int blockIndex, bool wait)const
+{
+  const quint64 key = blockKey(parentValue, blockIndex);
+  ctkDICOMModelBlock* cached = this->Blocks.object(key);
+  if (cached || parentValue->Query.isEmpty())
+    {
+    return cached;
+    }
+  if (wait && this->Fetcher)
+    {
+    // needed now, don't wait for the requests queued before
+    const_cast<ctkDICOMModelPrivate*>(this)->insertBlock(
+      loadBlock(this->DataBase, this->blockRequest(parentValue, blockIndex, false)), false);
+    return this->Blocks.object(key);
+    }
+  this->request(parentValue, blockIndex, false);
+  return this->Blocks.object(key);
+}
+
+//------------------------------------------------------------------------------
+QVariant ctkDICOMModelPrivate::value(Node* parentValue, int row, const QString& field) const
+{
+  const int blockIndex = row / this->BlockSize;
+  const int blockRow = row % this->BlockSize;
+  const ctkDICOMModelBlock* rows = this->block(parentValue, blockIndex, field == "UID");
+  if (!rows)
+    {
+    // the view is updated when the block arrives
     return QVariant();
     }
-  QVariant res = parentValue->Query.value(column);
-  Q_ASSERT(res.isValid());
-  return res;
+  // read ahead in the scroll direction
+  if (this->Fetcher && blockRow == this->BlockSize / 2 &&
+      (blockIndex + 1) * this->BlockSize < parentValue->RowCount &&
+      !this->Blocks.contains(blockKey(parentValue, blockIndex + 1)))
+    {
+    this->request(parentValue, blockIndex + 1, false);
+    }
+  const int column = rows->Fields.indexOf(field);
+  if (column < 0)
+    {
+    return QString();
+    }
+  if (blockRow >= rows->RowCount)
+    {
+    return QVariant();
+    }
+  return rows->Columns[column][blockRow];
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModelPrivate::insertBlock(ctkDICOMModelBlock* rows, bool notify)
+{
+  CTK_P(ctkDICOMModel);
+  // the node of an older block may be deleted
+  if (rows->Generation != this->Generation)
+    {
+    delete rows;
+    return;
+    }
+  const quint64 key = blockKey(rows->Parent, rows->Index);
+  this->PendingBlocks.remove(key);
+  Node* node = rows->Parent;
+  const QModelIndex parentIndex = this->indexFromNode(node);
+  const int first = rows->Index * this->BlockSize;
+  const int last = first + rows->RowCount - 1;
+  const int count = rows->Count;
+  const int oldRowCount = node->RowCount;
+  if (rows->RowCount > 0)
+    {
+    const int uidColumn = rows->Fields.indexOf("UID");
+    const int sortColumn = node->SortField.isEmpty() ? -1 : rows->Fields.indexOf(node->SortField);
+    ctkDICOMModelKey firstKey;
+    ctkDICOMModelKey lastKey;
+    if (uidColumn >= 0)
+      {
+      firstKey.UID = rows->Columns[uidColumn].first();
+      lastKey.UID = rows->Columns[uidColumn].last();
+      if (sortColumn >= 0)
+        {
+        firstKey.Value = rows->Columns[sortColumn].first();
+        lastKey.Value = rows->Columns[sortColumn].last();
+        }
+      node->FirstKeys.insert(rows->Index, firstKey);
+      node->LastKeys.insert(rows->Index, lastKey);
+      }
+    }
+  this->Blocks.insert(key, rows, qMax(rows->RowCount, 1));
+
+  if (count >= 0)
+    {
+    node->Fetching = false;
+    node->AtEnd = true;
+    if (count > oldRowCount)
+      {
+      p->beginInsertRows(parentIndex, oldRowCount, count - 1);
+      node->RowCount = count;
+      p->endInsertRows();
+      }
+    }
+  if (notify && last >= 0 && first < oldRowCount)
+    {
+    emit p->dataChanged(p->index(first, 0, parentIndex),
+                        p->index(qMin(last, oldRowCount - 1), this->Headers.size() - 1, parentIndex));
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModelPrivate::clear()
+{
+  ++this->Generation;
+  if (this->Fetcher)
+    {
+    this->Fetcher->clearRequests();
+    }
+  this->Blocks.clear();
+  this->PendingBlocks.clear();
+  delete this->RootNode;
+  this->RootNode = 0;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModelPrivate::applyBlockSize()
+{
+  Q_ASSERT(this->Blocks.isEmpty());
+  this->BlockSize = this->PendingBlockSize;
+  // QCache deletes right away an object costing more than the maximum,
+  // a block would be fetched again and again
+  this->Blocks.setMaxCost(qMax(this->Blocks.maxCost(), this->BlockSize));
 }
 
 //------------------------------------------------------------------------------
@@ -256,10 +849,6 @@ QString ctkDICOMModelPrivate::generateQuery(const QString& fields, const QString
     {
     res += QString(" WHERE ") + conditions;
     }
-  if (!this->Sort.isEmpty())
-    {
-    res += QString(" ORDER BY ") + this->Sort;
-    }
   logger.debug ( "ctkDICOMModelPrivate::generateQuery: query is: " + res );
   return res;
 }
@@ -268,92 +857,97 @@ QString ctkDICOMModelPrivate::generateQuery(const QString& fields, const QString
 void ctkDICOMModelPrivate::updateQueries(Node* node)const
 {
   // are you kidding me, it should be virtualized here :-)
-  QString query;
+  // column and alias of each field
+  QStringList columns;
+  QString table;
+  QString condition;
+  // the children of node are at the level of node->Type
+  const int level = node->Type;
+  node->Unfiltered = this->FilterShown.isEmpty() ||
+    (node->Parent && node->Parent->Unfiltered) ||
+    (level > 0 && level <= this->FilterComplete.size() &&
+     this->FilterComplete[level - 1].contains(node->UID));
   switch(node->Type)
     {
     default:
       Q_ASSERT(node->Type == ctkDICOMModelPrivate::RootType);
       break;
     case ctkDICOMModelPrivate::RootType:
-      //query = QString("SELECT  FROM ");
-      query = this->generateQuery("UID as UID, PatientsName as Name, PatientsAge as Age, PatientsBirthDate as Date, PatientID as \"Subject ID\"","Patients");
-      logger.debug ( "ctkDICOMModelPrivate::updateQueries for Root: query is: " + query );
+      columns << "UID" << "UID" << "PatientsName" << "Name" << "PatientsAge" << "Age"
+              << "PatientsBirthDate" << "Date" << "PatientID" << "Subject ID";
+      table = "Patients";
       break;
     case ctkDICOMModelPrivate::PatientType:
-      //query = QString("SELECT  FROM Studies WHERE PatientsUID='%1'").arg(node->UID);
-      query = this->generateQuery("StudyInstanceUID as UID, StudyDescription as Name, ModalitiesInStudy as Scan, StudyDate as Date, AccessionNumber as Number, ReferringPhysician as Institution, ReferringPhysician as Referrer, PerformingPhysiciansName as Performer", "Studies",QString("PatientsUID='%1'").arg(node->UID));
-      logger.debug ( "ctkDICOMModelPrivate::updateQueries for Patient: query is: " + query );
+      columns << "StudyInstanceUID" << "UID" << "StudyDescription" << "Name"
+              << "ModalitiesInStudy" << "Scan" << "StudyDate" << "Date"
+              << "AccessionNumber" << "Number" << "ReferringPhysician" << "Institution"
+              << "ReferringPhysician" << "Referrer" << "PerformingPhysiciansName" << "Performer";
+      table = "Studies";
+      condition = QString("PatientsUID='%1'").arg(node->UID);
       break;
     case ctkDICOMModelPrivate::StudyType:
-      //query = QString("SELECT SeriesInstanceUID as UID, SeriesDescription as Name, BodyPartExamined as Scan, SeriesDate as Date, AcquisitionNumber as Number FROM Series WHERE StudyInstanceUID='%1'").arg(node->UID);
-      query = this->generateQuery("SeriesInstanceUID as UID, SeriesDescription as Name, BodyPartExamined as Scan, SeriesDate as Date, AcquisitionNumber as Number","Series",QString("StudyInstanceUID='%1'").arg(node->UID));
-      logger.debug ( "ctkDICOMModelPrivate::updateQueries for Study: query is: " + query );
+      columns << "SeriesInstanceUID" << "UID" << "SeriesDescription" << "Name"
+              << "BodyPartExamined" << "Scan" << "SeriesDate" << "Date"
+              << "AcquisitionNumber" << "Number";
+      table = "Series";
+      condition = QString("StudyInstanceUID='%1'").arg(node->UID);
       break;
     case ctkDICOMModelPrivate::SeriesType:
-      //query = QString("SELECT Filename as UID, Filename as Name, SeriesInstanceUID as Date FROM Images WHERE SeriesInstanceUID='%1'").arg(node->UID);
-      query = this->generateQuery("Filename as UID, Filename as Name, SeriesInstanceUID as Date", "Images", QString("SeriesInstanceUID='%1'").arg(node->UID));
-      logger.debug ( "ctkDICOMModelPrivate::updateQueries for Series: query is: " + query );
+      columns << "Filename" << "UID" << "Filename" << "Name" << "SeriesInstanceUID" << "Date";
+      table = "Images";
+      condition = QString("SeriesInstanceUID='%1'").arg(node->UID);
       break;
     case ctkDICOMModelPrivate::ImageType:
       break;
     }
-  node->Query = QSqlQuery(query, this->DataBase);
-  foreach(Node* child, node->Children)
+  if (!node->Unfiltered && level < this->FilterShown.size() && !columns.isEmpty())
     {
-    this->updateQueries(child);
+    QStringList uids;
+    foreach(QString uid, this->FilterShown[level])
+      {
+      uids << "'" + uid.replace("'", "''") + "'";
+      }
+    condition += QString(condition.isEmpty() ? "" : " AND ") +
+      QString("%1 IN (%2)").arg(columns[0]).arg(uids.join(","));
+    }
+  QStringList fields;
+  node->SortField = QString();
+  for (int i = 0; i + 1 < columns.size(); i += 2)
+    {
+    fields << QString("%1 as \"%2\"").arg(columns[i]).arg(columns[i + 1]);
+    if (columns[i + 1] == this->SortHeader && columns[i + 1] != "UID")
+      {
+      node->SortField = this->SortHeader;
+      }
     }
+  node->Query = table.isEmpty() ? QString() :
+    this->generateQuery(fields.join(", "), table, condition);
 }
 
 //------------------------------------------------------------------------------
 void ctkDICOMModelPrivate::fetch(const QModelIndex& indexValue, int limit)
 {
-  CTK_P(ctkDICOMModel);
+  Q_UNUSED(limit);
   Node* node = this->nodeFromIndex(indexValue);
-  if (node->AtEnd || limit <= node->RowCount || node->Fetching/*|| bottom.column() == -1*/)
+  if (node->AtEnd || node->Fetching)
     {
     return;
     }
-  node->Fetching = true;
-
-  int newRowCount;
-  const int oldRowCount = node->RowCount;
-
-  // try to seek directly
-  if (node->Query.seek(limit - 1)) 
-    {
-    newRowCount = limit;
-    } 
-  else 
-    {
-    newRowCount = qMax(oldRowCount, 1);
-    if (node->Query.seek(newRowCount - 1)) 
-      {
-      while (node->Query.next())
-        {
-        ++newRowCount;
-        }
-      } 
-    else 
-      {
-      // empty or invalid query
-      newRowCount = 0;
-      }
-    node->AtEnd = true; // this is the end.
-    }
-  if (newRowCount > 0 && newRowCount > node->RowCount) 
-    {
-    p->beginInsertRows(indexValue, node->RowCount, newRowCount - 1);
-    node->RowCount = newRowCount;
-    node->Fetching = false;
-    p->endInsertRows();
-    } 
-  else 
+  this->prepareQuery(node);
+  if (node->Query.isEmpty())
     {
-    node->RowCount = newRowCount;
-    node->Fetching = false;
+    node->AtEnd = true;
+    return;
     }
+  // All the rows are inserted once counted, their content is fetched by
+  // block when the view shows them
+  node->Fetching = true;
+  this->request(node, 0, true);
 }
 
+//------------------------------------------------------------------------------
+// ctkDICOMModel methods
+
 //------------------------------------------------------------------------------
 ctkDICOMModel::ctkDICOMModel(QObject* parentValue)
 {
@@ -387,30 +981,18 @@ int ctkDICOMModel::columnCount ( const QModelIndex & _parent ) const
 QVariant ctkDICOMModel::data ( const QModelIndex & indexValue, int role ) const
 {
   CTK_D(const ctkDICOMModel);
-  if (role & ~(Qt::DisplayRole | Qt::EditRole))
+  if (role != UIDRole && (role & ~(Qt::DisplayRole | Qt::EditRole)))
     {
     return QVariant();
     }
   QModelIndex indexParent = this->parent(indexValue);
   Node* parentNode = d->nodeFromIndex(indexParent);
   if (indexValue.row() >= parentNode->RowCount)
-    {      
-    const_cast<ctkDICOMModelPrivate *>(d)->fetch(indexValue, indexValue.row());
-    }
-/*
-  if (!node->Query.seek(indexValue.row())) 
     {
-    qDebug() << node->Query.lastError();
     return QVariant();
     }
-    */
-  int field = parentNode->Query.record().indexOf(d->Headers[indexValue.column()]);
-  if (field < 0)
-    {
-    return QString();
-    }
-  return d->value(indexParent, indexValue.row(), field);
-  //return node->Query.value(field);
+  const QString field = role == UIDRole ? QString("UID") : d->Headers[indexValue.column()];
+  return d->value(parentNode, indexValue.row(), field);
 }
 
 //------------------------------------------------------------------------------
@@ -418,7 +1000,7 @@ void ctkDICOMModel::fetchMore ( const QModelIndex & parentValue )
 {
   CTK_D(ctkDICOMModel);
   Node* node = d->nodeFromIndex(parentValue);
-  d->fetch(parentValue, qMax(node->RowCount, 0) + 256);
+  d->fetch(parentValue, qMax(node->RowCount, 0) + d->BlockSize);
 }
 
 //------------------------------------------------------------------------------
@@ -441,12 +1023,13 @@ bool ctkDICOMModel::hasChildren ( const QModelIndex & parentValue ) const
     {
     return false;
     }
-  if (node->RowCount == 0 && !node->AtEnd)
+  if (node->Type == ctkDICOMModelPrivate::ImageType)
     {
-    //const_cast<qCTKDCMTKModelPrivate*>(d)->fetch(parentValue, 1);
-    return node->Query.seek(0);
+    return false;
     }
-  return node->RowCount > 0;
+  // Counting the children of each visible row would be too slow, whether
+  // there is any is known once fetchMore() is called
+  return node->RowCount > 0 || !node->AtEnd;
 }
 
 //------------------------------------------------------------------------------
@@ -476,17 +1059,11 @@ QModelIndex ctkDICOMModel::index ( int row, int column, const QModelIndex & pare
     return QModelIndex();
     }
   Node* parentNode = d->nodeFromIndex(parentValue);
-  int field = parentNode->Query.record().indexOf("UID");
-  QString uid = d->value(parentValue, row, field).toString();
-  Node* node = 0;
-  foreach(Node* tmpNode, parentNode->Children)
+  if (row < 0 || row >= parentNode->RowCount)
     {
-    if (tmpNode->UID == uid)
-      {
-      node = tmpNode;
-      break;
-      }
+    return QModelIndex();
     }
+  Node* node = parentNode->Children.value(row);
   if (node == 0)
     {
     node = d->createNode(row, parentValue);
@@ -550,10 +1127,11 @@ void ctkDICOMModel::setDatabase(const QSqlDatabase &db)
   CTK_D(ctkDICOMModel);
 
   this->beginResetModel();
+  d->clear();
+  d->applyBlockSize();
+  delete d->Fetcher;
+  d->Fetcher = 0;
   d->DataBase = db;
-  
-  delete d->RootNode;
-  d->RootNode = 0;
 
   if (d->DataBase.tables().empty())
     {
@@ -561,52 +1139,91 @@ void ctkDICOMModel::setDatabase(const QSqlDatabase &db)
     this->endResetModel();
     return;
     }
+
+  // An in-memory database can't be opened by another connection
+  if (d->DataBase.databaseName() != ":memory:")
+    {
+    d->Fetcher = new ctkDICOMModelFetcher(this, d->DataBase);
+    d->Fetcher->start(QThread::LowPriority);
+    }
     
   d->RootNode = d->createNode(-1, QModelIndex());
   
   this->endResetModel();
 
-  // TODO, use hasQuerySize everywhere, not only in setDataBase()
-  bool hasQuerySize = d->RootNode->Query.driver()->hasFeature(QSqlDriver::QuerySize);
-  if (hasQuerySize && d->RootNode->Query.size() > 0) 
+  d->fetch(QModelIndex(), d->BlockSize);
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModel::setUIDFilter(const QList<QSet<QString> >& shown,
+                                 const QList<QSet<QString> >& complete)
+{
+  CTK_D(ctkDICOMModel);
+  this->beginResetModel();
+  const bool populated = d->RootNode != 0;
+  d->clear();
+  d->applyBlockSize();
+  d->FilterShown = shown;
+  d->FilterComplete = complete;
+  if (populated)
     {
-    int newRowCount= d->RootNode->Query.size();
-    beginInsertRows(QModelIndex(), 0, qMax(0, newRowCount - 1));
-    d->RootNode->RowCount = newRowCount;
-    d->RootNode->AtEnd = true;
-    endInsertRows();
+    d->RootNode = d->createNode(-1, QModelIndex());
+    }
+  this->endResetModel();
+  if (populated)
+    {
+    d->fetch(QModelIndex(), d->BlockSize);
     }
-  d->fetch(QModelIndex(), 256);
 }
 
 //------------------------------------------------------------------------------
 void ctkDICOMModel::sort(int column, Qt::SortOrder order)
 {
   CTK_D(ctkDICOMModel);
-  /* The following would work if there is no fetch involved.
-     ORDER BY doesn't just apply on the fetched item. By sorting
-     new items can show up in the model, and we need to be more
-     careful
-  emit layoutAboutToBeChanged();
-  QModelIndexList oldIndexList = d->modelIndexList();
-  d->Sort = QString("\"%1\" %2")
-    .arg(d->Headers[column])
-    .arg(order == Qt::AscendingOrder ? "ASC" : "DESC");
-  d->updateQueries(d->RootNode);
-  QModelIndexList newIndexList = d->modelIndexList();
-  Q_ASSERT(oldIndexList.count() == newIndexList.count());
-  this->changePersistentIndexList(oldIndexList, newIndexList);
-  emit layoutChanged();
-  */
-  this->beginResetModel();
-  delete d->RootNode;
-  d->RootNode = 0;
-  d->Sort = QString("\"%1\" %2")
-    .arg(d->Headers[column])
-    .arg(order == Qt::AscendingOrder ? "ASC" : "DESC");
-  d->RootNode = d->createNode(-1, QModelIndex());
-  
-  this->endResetModel();
+  if (d->RootNode == 0)
+    {
+    return;
+    }
+  emit this->layoutAboutToBeChanged();
+  // The rows referred to by persistent indexes (expanded, selected or
+  // current rows) keep their node and their children, and are moved to
+  // their new row. The rows have the same count in any order.
+  const QModelIndexList oldIndexes = this->persistentIndexList();
+  QSet<Node*> kept;
+  foreach(const QModelIndex& index, oldIndexes)
+    {
+    for (Node* node = d->nodeFromIndex(index); node && node != d->RootNode; node = node->Parent)
+      {
+      if (node->UID.isEmpty())
+        {
+        node->UID = d->value(node->Parent, node->Row, "UID").toString();
+        }
+      kept.insert(node);
+      }
+    }
+
+  d->SortHeader = d->Headers[column];
+  d->SortOrder = order;
+  ++d->Generation;
+  if (d->Fetcher)
+    {
+    d->Fetcher->clearRequests();
+    }
+  d->Blocks.clear();
+  d->PendingBlocks.clear();
+  d->applyBlockSize();
+  QHash<Node*, int> rows;
+  d->sortNode(d->RootNode, kept, rows);
+
+  QModelIndexList newIndexes;
+  foreach(const QModelIndex& index, oldIndexes)
+    {
+    Node* node = d->nodeFromIndex(index);
+    newIndexes << (rows.contains(node) ?
+      this->createIndex(rows[node], index.column(), node) : QModelIndex());
+    }
+  this->changePersistentIndexList(oldIndexes, newIndexes);
+  emit this->layoutChanged();
 }
 
 //------------------------------------------------------------------------------
@@ -629,3 +1246,50 @@ bool ctkDICOMModel::setHeaderData ( int section, Qt::Orientation orientation, co
   emit this->headerDataChanged(orientation, section, section);
   return true;
 }
+
+//------------------------------------------------------------------------------
+void ctkDICOMModel::setBlockSize(int rows)
+{
+  CTK_D(ctkDICOMModel);
+  d->PendingBlockSize = qMax(rows, 1);
+  if (d->RootNode == 0)
+    {
+    d->applyBlockSize();
+    }
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMModel::blockSize()const
+{
+  CTK_D(const ctkDICOMModel);
+  return d->PendingBlockSize;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModel::setMaximumCachedRows(int rows)
+{
+  CTK_D(ctkDICOMModel);
+  // at least a block, see applyBlockSize()
+  d->Blocks.setMaxCost(qMax(rows, qMax(d->BlockSize, d->PendingBlockSize)));
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMModel::maximumCachedRows()const
+{
+  CTK_D(const ctkDICOMModel);
+  return d->Blocks.maxCost();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMModel::processBlocks()
+{
+  CTK_D(ctkDICOMModel);
+  if (!d->Fetcher)
+    {
+    return;
+    }
+  foreach(ctkDICOMModelBlock* block, d->Fetcher->takeResults())
+    {
+    d->insertBlock(block, true);
+    }
+}
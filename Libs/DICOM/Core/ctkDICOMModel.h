@@ -23,6 +23,8 @@
 
 // Qt includes 
 #include <QAbstractItemModel>
+#include <QList>
+#include <QSet>
 #include <QSqlDatabase>
 
 // CTK includes
@@ -35,11 +37,40 @@ class CTK_DICOM_CORE_EXPORT ctkDICOMModel : public QAbstractItemModel
 {
   Q_OBJECT
 public:
+  enum Roles
+  {
+    /// UID of the patient, study, series or image of the index, whatever
+    /// its column
+    UIDRole = Qt::UserRole + 1
+  };
+
   explicit ctkDICOMModel(QObject* parent = 0);
   virtual ~ctkDICOMModel();
 
   void setDatabase(const QSqlDatabase& dataBase);
 
+  ///
+  /// Show only the patients, studies and series whose UID is in shown[0],
+  /// shown[1] and shown[2], except below the rows listed in complete which
+  /// keep all their descendants. The UIDs restrict the queries of the rows,
+  /// no row is read to filter them. Like setDatabase(), it resets the model.
+  /// An empty shown list shows all the rows.
+  void setUIDFilter(const QList<QSet<QString> >& shown,
+                    const QList<QSet<QString> >& complete);
+
+  ///
+  /// The rows are fetched by blocks of blockSize() rows, in a background
+  /// thread unless the database is in memory. The change is applied by the
+  /// next setDatabase() or sort(). Default is 256.
+  void setBlockSize(int rows);
+  int blockSize()const;
+
+  ///
+  /// Rows kept in memory, the least recently used blocks are dropped
+  /// beyond. At least a block is kept. Default is 65536.
+  void setMaximumCachedRows(int rows);
+  int maximumCachedRows()const;
+
   virtual bool canFetchMore ( const QModelIndex & parent ) const;
   virtual int columnCount ( const QModelIndex & parent = QModelIndex() ) const;
   virtual QVariant data ( const QModelIndex & index, int role = Qt::DisplayRole ) const;
@@ -53,9 +84,17 @@ public:
   virtual QModelIndex parent ( const QModelIndex & index ) const;
   virtual int rowCount ( const QModelIndex & parent = QModelIndex() ) const;
   virtual bool setHeaderData ( int section, Qt::Orientation orientation, const QVariant & value, int role = Qt::EditRole );
-  // Sorting resets the model because fetched/unfetched items could disappear/appear respectively.
+  // Sorting changes the layout of the model: the rows with a persistent index
+  // (expanded, selected...) are moved to their new row, the others are fetched
+  // again. The blocks are read by seeking from the sort key of a neighbour
+  // block, or from the closest end of the rows, instead of skipping all the
+  // rows before them.
   virtual void sort(int column, Qt::SortOrder order = Qt::AscendingOrder);
 
+protected slots:
+  /// Insert the blocks fetched by the background thread
+  void processBlocks();
+
 private:
   CTK_DECLARE_PRIVATE(ctkDICOMModel);
 };
@@ -32,6 +32,7 @@
 
 // ctkDICOM includes
 #include "ctkDICOMQuery.h"
+#include "ctkDICOMQuery_p.h"
 #include "ctkLogger.h"
 
 // DCMTK includes
@@ -50,25 +51,247 @@
 #include <dcmtk/ofstd/ofstd.h>        /* for class OFStandard */
 #include <dcmtk/dcmdata/dcddirif.h>   /* for class DicomDirInterface */
 
-#include <dcmtk/dcmnet/scu.h>
+#include <dcmtk/dcmdata/dcuid.h>
 
 static ctkLogger logger ( "org.commontk.dicom.DICOMQuery" );
 
+namespace
+{
+//------------------------------------------------------------------------------
+/// Keys returned by the studies and series finds
+void initializeQuery(DcmDataset& query)
+{
+  query.insertEmptyElement ( DCM_QueryRetrieveLevel );
+  query.insertEmptyElement ( DCM_PatientID );
+  query.insertEmptyElement ( DCM_PatientsName );
+  query.insertEmptyElement ( DCM_PatientsBirthDate );
+  query.insertEmptyElement ( DCM_StudyID );
+  query.insertEmptyElement ( DCM_StudyInstanceUID );
+  query.insertEmptyElement ( DCM_StudyDescription );
+  query.insertEmptyElement ( DCM_StudyDate );
+  query.insertEmptyElement ( DCM_SeriesNumber );
+  query.insertEmptyElement ( DCM_SeriesDescription );
+  query.insertEmptyElement ( DCM_SeriesInstanceUID );
+  query.insertEmptyElement ( DCM_StudyTime );
+  query.insertEmptyElement ( DCM_SeriesDate );
+  query.insertEmptyElement ( DCM_SeriesTime );
+  query.insertEmptyElement ( DCM_Modality );
+  query.insertEmptyElement ( DCM_ModalitiesInStudy );
+  query.insertEmptyElement ( DCM_AccessionNumber );
+  query.insertEmptyElement ( DCM_NumberOfSeriesRelatedInstances ); // Number of images in the series
+  query.insertEmptyElement ( DCM_NumberOfStudyRelatedInstances ); // Number of images in the series
+  query.insertEmptyElement ( DCM_NumberOfStudyRelatedSeries ); // Number of images in the series
+}
+
+//------------------------------------------------------------------------------
+/// See DIMSE_FindUserCallback
+void findCallback(void* records, T_DIMSE_C_FindRQ* request, int responseCount,
+                  T_DIMSE_C_FindRSP* response, DcmDataset* responseIdentifiers)
+{
+  Q_UNUSED(request);
+  Q_UNUSED(responseCount);
+  Q_UNUSED(response);
+  if ( responseIdentifiers != NULL )
+    {
+    ctkDICOMIndexerRecord record;
+    // the image level attributes are not returned
+    record.readDataset ( responseIdentifiers );
+    static_cast<QList<ctkDICOMIndexerRecord>*>(records)->append ( record );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Send a C-FIND and read the responses in records. Return false if the
+/// association can't be used anymore.
+bool find(ctkDICOMAssociation* association, DcmDataset* query,
+          QList<ctkDICOMIndexerRecord>& records)
+{
+  const T_ASC_PresentationContextID presID = association->presentationContextID (
+    UID_FINDStudyRootQueryRetrieveInformationModel );
+  if ( presID == 0 )
+    {
+    logger.error ( "Find failed: the study root find model is not accepted" );
+    return false;
+    }
+  T_DIMSE_C_FindRQ request;
+  memset ( &request, 0, sizeof(request) );
+  request.MessageID = association->Association->nextMsgID++;
+  OFStandard::strlcpy ( request.AffectedSOPClassUID,
+    UID_FINDStudyRootQueryRetrieveInformationModel, sizeof(request.AffectedSOPClassUID) );
+  request.Priority = DIMSE_PRIORITY_MEDIUM;
+  request.DataSetType = DIMSE_DATASET_PRESENT;
+  T_DIMSE_C_FindRSP response;
+  DcmDataset* statusDetail = NULL;
+  OFCondition status = DIMSE_findUser ( association->Association, presID, &request, query,
+    findCallback, &records,
+    association->Timeout > 0 ? DIMSE_NONBLOCKING : DIMSE_BLOCKING, association->Timeout,
+    &response, &statusDetail );
+  delete statusDetail;
+  if ( !status.good() )
+    {
+    logger.error ( QString("Find failed: ") + status.text() );
+    return false;
+    }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMQueryJob methods
+
+//------------------------------------------------------------------------------
+ctkDICOMQueryJob::ctkDICOMQueryJob(ctkDICOMQuery* query, int workers)
+  : Query(query)
+{
+  this->Port = 0;
+  this->Timeout = 0;
+  this->AssociationPool = 0;
+  this->StudiesDone = false;
+  this->Success = true;
+  this->RunningWorkers = workers;
+  this->StudyCount = 0;
+  this->StudiesQueried = 0;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMQueryJob::addStudies(const QList<ctkDICOMIndexerRecord>& studies, bool success)
+{
+  QMutexLocker locker(&this->Mutex);
+  foreach(const ctkDICOMIndexerRecord& study, studies)
+    {
+    if (!study.StudyInstanceUID.isEmpty())
+      {
+      this->PendingStudies << study.StudyInstanceUID;
+      }
+    }
+  this->StudyCount = this->PendingStudies.size();
+  this->StudiesDone = true;
+  this->Success = this->Success && success;
+  this->Results << studies;
+  this->StudiesAvailable.wakeAll();
+  this->ResultsAvailable.wakeAll();
+  this->notify();
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMQueryJob::nextStudy(QString& studyInstanceUID)
+{
+  QMutexLocker locker(&this->Mutex);
+  while (!this->StudiesDone && !this->Canceled)
+    {
+    this->StudiesAvailable.wait(&this->Mutex);
+    }
+  if (this->Canceled || this->PendingStudies.isEmpty())
+    {
+    return false;
+    }
+  studyInstanceUID = this->PendingStudies.takeFirst();
+  return true;
+}
+
 //------------------------------------------------------------------------------
-class ctkDICOMQueryPrivate: public ctkPrivate<ctkDICOMQuery>
+void ctkDICOMQueryJob::addSeries(const QList<ctkDICOMIndexerRecord>& series, bool success)
 {
-public:
-  ctkDICOMQueryPrivate();
-  ~ctkDICOMQueryPrivate();
-  QString CallingAETitle;
-  QString CalledAETitle;
-  QString Host;
-  int Port;
-  DcmSCU SCU;
-  DcmDataset* query;
-  QStringList StudyInstanceUIDList;
+  QMutexLocker locker(&this->Mutex);
+  ++this->StudiesQueried;
+  this->Success = this->Success && success;
+  const bool wasEmpty = this->Results.isEmpty();
+  this->Results << series;
+  this->ResultsAvailable.wakeAll();
+  if (wasEmpty)
+    {
+    this->notify();
+    }
+}
 
-};
+//------------------------------------------------------------------------------
+void ctkDICOMQueryJob::workerFinished()
+{
+  QMutexLocker locker(&this->Mutex);
+  if (--this->RunningWorkers == 0)
+    {
+    // The study worker failed before finding the studies, or all the
+    // workers failed before finding the series of every study
+    if (!this->StudiesDone || !this->PendingStudies.isEmpty())
+      {
+      this->Success = false;
+      }
+    this->ResultsAvailable.wakeAll();
+    this->notify();
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMQueryJob::cancel()
+{
+  QMutexLocker locker(&this->Mutex);
+  this->Canceled.fetchAndStoreOrdered(1);
+  this->StudiesAvailable.wakeAll();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMQueryJob::notify()
+{
+  QMetaObject::invokeMethod(this->Query, "processResults", Qt::QueuedConnection);
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMQueryTask methods
+
+//------------------------------------------------------------------------------
+ctkDICOMQueryTask::ctkDICOMQueryTask(ctkDICOMQueryJob* job, bool findStudies)
+  : Job(job), FindStudies(findStudies)
+{
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMQueryTask::run()
+{
+  ctkDICOMQueryJob* job = this->Job;
+  ctkDICOMAssociation* association = job->AssociationPool->acquire (
+    ctkDICOMAssociationPool::FindService, job->CallingAETitle, job->CalledAETitle,
+    job->Host, job->Port, job->Timeout );
+  if ( !association )
+    {
+    if ( this->FindStudies )
+      {
+      job->addStudies ( QList<ctkDICOMIndexerRecord>(), false );
+      }
+    job->workerFinished();
+    return;
+    }
+
+  bool reusable = true;
+  DcmDataset query;
+  initializeQuery ( query );
+  if ( this->FindStudies )
+    {
+    logger.debug ( "Starting Study C-FIND" );
+    query.putAndInsertString ( DCM_QueryRetrieveLevel, "STUDY" );
+    QList<ctkDICOMIndexerRecord> studies;
+    reusable = find ( association, &query, studies );
+    job->addStudies ( studies, reusable );
+    }
+
+  // Now search each Study
+  query.putAndInsertString ( DCM_QueryRetrieveLevel, "SERIES" );
+  QString studyInstanceUID;
+  while ( reusable && job->nextStudy ( studyInstanceUID ) )
+    {
+    logger.debug ( "Starting Series C-FIND for Study: " + studyInstanceUID );
+    query.putAndInsertString ( DCM_StudyInstanceUID, studyInstanceUID.toStdString().c_str() );
+    QList<ctkDICOMIndexerRecord> series;
+    reusable = find ( association, &query, series );
+    if ( !reusable )
+      {
+      logger.error ( "Find failed for Study: " + studyInstanceUID );
+      }
+    job->addSeries ( series, reusable );
+    }
+  // the remaining studies are found by the other workers
+  job->AssociationPool->release ( association, reusable );
+  job->workerFinished();
+}
 
 //------------------------------------------------------------------------------
 // ctkDICOMQueryPrivate methods
@@ -76,13 +299,16 @@ public:
 //------------------------------------------------------------------------------
 ctkDICOMQueryPrivate::ctkDICOMQueryPrivate()
 {
-  query = new DcmDataset();
+  this->Port = 0;
+  this->MaximumAssociations = 4;
+  this->Timeout = 30;
+  this->AssociationPool = ctkDICOMAssociationPool::instance();
+  this->Job = 0;
 }
 
 //------------------------------------------------------------------------------
 ctkDICOMQueryPrivate::~ctkDICOMQueryPrivate()
 {
-  delete query;
 }
 
 
@@ -92,11 +318,19 @@ ctkDICOMQueryPrivate::~ctkDICOMQueryPrivate()
 //------------------------------------------------------------------------------
 ctkDICOMQuery::ctkDICOMQuery()
 {
+  CTK_INIT_PRIVATE(ctkDICOMQuery);
 }
 
 //------------------------------------------------------------------------------
 ctkDICOMQuery::~ctkDICOMQuery()
 {
+  CTK_D(ctkDICOMQuery);
+  if ( d->Job )
+    {
+    d->Job->cancel();
+    d->Pool.waitForDone();
+    delete d->Job;
+    }
 }
 
 void ctkDICOMQuery::addStudyInstanceUID ( QString s )
@@ -150,134 +384,164 @@ int ctkDICOMQuery::port()
 
 
 //------------------------------------------------------------------------------
-void ctkDICOMQuery::query(QSqlDatabase database )
+void ctkDICOMQuery::setMaximumAssociations(int associations)
 {
-  ctkDICOMIndexerBase::setDatabase ( database );
   CTK_D(ctkDICOMQuery);
-  if ( this->database().isOpen() )
+  d->MaximumAssociations = qMax(associations, 1);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMQuery::maximumAssociations()const
+{
+  CTK_D(const ctkDICOMQuery);
+  return d->MaximumAssociations;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMQuery::setTimeout(int seconds)
+{
+  CTK_D(ctkDICOMQuery);
+  d->Timeout = qMax(seconds, 0);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMQuery::timeout()const
+{
+  CTK_D(const ctkDICOMQuery);
+  return d->Timeout;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMQuery::setAssociationPool(ctkDICOMAssociationPool* pool)
+{
+  CTK_D(ctkDICOMQuery);
+  d->AssociationPool = pool ? pool : ctkDICOMAssociationPool::instance();
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociationPool* ctkDICOMQuery::associationPool()const
+{
+  CTK_D(const ctkDICOMQuery);
+  return d->AssociationPool;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMQuery::start(QSqlDatabase database)
+{
+  CTK_D(ctkDICOMQuery);
+  if ( d->Job )
     {
-    logger.debug ( "DB open in Query" );
+    logger.error ( "A query is already running" );
+    return false;
     }
-  else
+  ctkDICOMIndexerBase::setDatabase ( database );
+  if ( !this->database().isOpen() )
     {
     logger.debug ( "DB not open in Query" );
     }
   d->StudyInstanceUIDList.clear();
-  d->SCU.setAETitle ( this->callingAETitle().toStdString() );
-  d->SCU.setPeerAETitle ( this->calledAETitle().toStdString() );
-  d->SCU.setPeerHostName ( this->host().toStdString() );
-  d->SCU.setPeerPort ( this->port() );
-
-  logger.error ( "Setting Transfer Syntaxes" );
-  OFList<OFString> transferSyntaxes;
-  transferSyntaxes.push_back ( UID_LittleEndianExplicitTransferSyntax );
-  transferSyntaxes.push_back ( UID_BigEndianExplicitTransferSyntax );
-  transferSyntaxes.push_back ( UID_LittleEndianImplicitTransferSyntax );
-
-  // d->SCU.addPresentationContext ( UID_FINDStudyRootQueryRetrieveInformationModel, transferSyntaxes );
-  d->SCU.addPresentationContext ( UID_VerificationSOPClass, transferSyntaxes );
-  if ( !d->SCU.initNetwork().good() ) 
+
+  d->Job = new ctkDICOMQueryJob ( this, d->MaximumAssociations );
+  d->Job->CallingAETitle = d->CallingAETitle;
+  d->Job->CalledAETitle = d->CalledAETitle;
+  d->Job->Host = d->Host;
+  d->Job->Port = d->Port;
+  d->Job->Timeout = d->Timeout;
+  d->Job->AssociationPool = d->AssociationPool;
+
+  d->Pool.setMaxThreadCount ( d->MaximumAssociations );
+  for ( int i = 0; i < d->MaximumAssociations; ++i )
     {
-    std::cerr << "Error initializing the network" << std::endl;
-    return;
+    // the associations are negotiated while the studies are found
+    d->Pool.start ( new ctkDICOMQueryTask ( d->Job, i == 0 ) );
     }
-  logger.debug ( "Negotiating Association" );
-  d->SCU.negotiateAssociation();
-  logger.debug ( "Sending Echo" );
-  OFString abstractSyntax;
-  OFString transferSyntax;
-  if ( d->SCU.sendECHORequest ( 0 ).good() )
-    {
-    std::cout << "ECHO Sucessful" << std::endl;
-    } 
-  else
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMQuery::wait()
+{
+  CTK_D(ctkDICOMQuery);
+  while ( d->Job )
     {
-    std::cerr << "ECHO Failed" << std::endl;
+      {
+      QMutexLocker locker ( &d->Job->Mutex );
+      while ( d->Job->Results.isEmpty() && d->Job->RunningWorkers > 0 )
+        {
+        d->Job->ResultsAvailable.wait ( &d->Job->Mutex );
+        }
+      }
+    this->processResults();
     }
-  // Clear the query
-  unsigned long elements = d->query->card();
-  // Clean it out
-  for ( unsigned long i = 0; i < elements; i++ ) 
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMQuery::isRunning()const
+{
+  CTK_D(const ctkDICOMQuery);
+  return d->Job != 0;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMQuery::cancel()
+{
+  CTK_D(ctkDICOMQuery);
+  if ( d->Job )
     {
-    d->query->remove ( (unsigned long) 0 );
+    d->Job->cancel();
     }
-  d->query->insertEmptyElement ( DCM_QueryRetrieveLevel );
-  d->query->insertEmptyElement ( DCM_PatientID );
-  d->query->insertEmptyElement ( DCM_PatientsName );
-  d->query->insertEmptyElement ( DCM_PatientsBirthDate );
-  d->query->insertEmptyElement ( DCM_StudyID );
-  d->query->insertEmptyElement ( DCM_StudyInstanceUID );
-  d->query->insertEmptyElement ( DCM_StudyDescription );
-  d->query->insertEmptyElement ( DCM_StudyDate );
-  d->query->insertEmptyElement ( DCM_StudyID );
-  d->query->insertEmptyElement ( DCM_PatientID );
-  d->query->insertEmptyElement ( DCM_PatientsName );
-  d->query->insertEmptyElement ( DCM_SeriesNumber );
-  d->query->insertEmptyElement ( DCM_SeriesDescription );
-  d->query->insertEmptyElement ( DCM_StudyInstanceUID );
-  d->query->insertEmptyElement ( DCM_SeriesInstanceUID );
-  d->query->insertEmptyElement ( DCM_StudyTime );
-  d->query->insertEmptyElement ( DCM_SeriesDate );
-  d->query->insertEmptyElement ( DCM_SeriesTime );
-  d->query->insertEmptyElement ( DCM_Modality );
-  d->query->insertEmptyElement ( DCM_ModalitiesInStudy );
-  d->query->insertEmptyElement ( DCM_AccessionNumber );
-  d->query->insertEmptyElement ( DCM_NumberOfSeriesRelatedInstances ); // Number of images in the series
-  d->query->insertEmptyElement ( DCM_NumberOfStudyRelatedInstances ); // Number of images in the series
-  d->query->insertEmptyElement ( DCM_NumberOfStudyRelatedSeries ); // Number of images in the series
-  d->query->putAndInsertString ( DCM_QueryRetrieveLevel, "STUDY" );
-
-  FINDResponses *responses = new FINDResponses();
-
-  OFCondition status = d->SCU.sendFINDRequest ( 0, d->query, responses );
-  if ( status.good() )
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMQuery::processResults()
+{
+  CTK_D(ctkDICOMQuery);
+  // Results queued before the end of a previous query
+  if ( !d->Job )
     {
-    logger.debug ( "Find succeded" );
+    return;
     }
-  else
+  QList<ctkDICOMIndexerRecord> results;
+  bool finished = false;
+  int percent = 0;
     {
-    logger.error ( "Find failed" );
+    QMutexLocker locker ( &d->Job->Mutex );
+    results.swap ( d->Job->Results );
+    finished = d->Job->RunningWorkers == 0;
+    percent = d->Job->StudyCount > 0 ?
+      d->Job->StudiesQueried * 100 / d->Job->StudyCount : 0;
     }
 
-  for ( OFListIterator(FINDResponse*) it = responses->begin(); it != responses->end(); it++ )
+  foreach ( const ctkDICOMIndexerRecord& record, results )
     {
-    DcmDataset *dataset = (*it)->m_dataset;
-    if ( dataset != NULL )
+    this->insert ( record );
+    if ( record.SeriesInstanceUID.isEmpty() && !record.StudyInstanceUID.isEmpty() )
       {
-      this->insert ( dataset );
-      OFString StudyInstanceUID;
-      dataset->findAndGetOFString ( DCM_StudyInstanceUID, StudyInstanceUID );
-      this->addStudyInstanceUID ( QString ( StudyInstanceUID.c_str() ) );
+      this->addStudyInstanceUID ( record.StudyInstanceUID );
       }
     }
-  delete responses;
-
-  // Now search each Study
-  d->query->putAndInsertString ( DCM_QueryRetrieveLevel, "SERIES" );
-  foreach ( QString StudyInstanceUID, d->StudyInstanceUIDList )
+  if ( !results.isEmpty() )
     {
-    logger.debug ( "Starting Series C-FIND for Series: " + StudyInstanceUID );
-    d->query->putAndInsertString ( DCM_StudyInstanceUID, StudyInstanceUID.toStdString().c_str() );
-    responses = new FINDResponses();
-    status = d->SCU.sendFINDRequest ( 0, d->query, responses );
-    if ( status.good() )
-      {
-      logger.debug ( "Find succeded for Series: " + StudyInstanceUID );
-      for ( OFListIterator(FINDResponse*) it = responses->begin(); it != responses->end(); it++ )
-        {
-        DcmDataset *dataset = (*it)->m_dataset;
-        if ( dataset != NULL )
-          {
-          this->insert ( dataset );
-          }
-        }
-      }
-    else
-      {
-      logger.error ( "Find failed for Series: " + StudyInstanceUID );
-      }
-    delete responses;
+    emit this->progress ( percent );
     }
-  d->SCU.closeAssociation ( DUL_PEERREQUESTEDRELEASE );
+  if ( !finished )
+    {
+    return;
+    }
+
+  this->commit();
+  d->Pool.waitForDone();
+  const bool success = d->Job->Success && !d->Job->Canceled;
+  delete d->Job;
+  d->Job = 0;
+  emit this->queryFinished ( success );
 }
 
+//------------------------------------------------------------------------------
+void ctkDICOMQuery::query(QSqlDatabase database )
+{
+  if ( this->start ( database ) )
+    {
+    this->wait();
+    }
+}
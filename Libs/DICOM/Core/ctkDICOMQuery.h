@@ -31,6 +31,7 @@
 #include "CTKDICOMCoreExport.h"
 #include "ctkDICOMIndexerBase.h"
 
+class ctkDICOMAssociationPool;
 class ctkDICOMQueryPrivate;
 class CTK_DICOM_CORE_EXPORT ctkDICOMQuery : public ctkDICOMIndexerBase
 {
@@ -38,6 +39,8 @@ class CTK_DICOM_CORE_EXPORT ctkDICOMQuery : public ctkDICOMIndexerBase
   Q_PROPERTY(QString callingAETitle READ callingAETitle WRITE setCallingAETitle);
   Q_PROPERTY(QString calledAETitle READ calledAETitle WRITE setCallingAETitle);
   Q_PROPERTY(int port READ port WRITE setPort);
+  Q_PROPERTY(int maximumAssociations READ maximumAssociations WRITE setMaximumAssociations);
+  Q_PROPERTY(int timeout READ timeout WRITE setTimeout);
 public:
   explicit ctkDICOMQuery();
   virtual ~ctkDICOMQuery();
@@ -51,13 +54,62 @@ public:
   const QString& host();
   void setPort ( int port );
   int port();
-  
-  /// Query a remote DICOM Image Store SCP
+
+  ///
+  /// Number of associations opened in parallel to find the series of the
+  /// studies. Default is 4.
+  void setMaximumAssociations(int associations);
+  int maximumAssociations()const;
+
+  ///
+  /// Timeout in seconds of the association negotiation and of each
+  /// response. Default is 30.
+  void setTimeout(int seconds);
+  int timeout()const;
+
+  ///
+  /// Pool the associations are acquired from, the shared
+  /// ctkDICOMAssociationPool::instance() by default. Setting 0 restores
+  /// the default.
+  void setAssociationPool(ctkDICOMAssociationPool* pool);
+  ctkDICOMAssociationPool* associationPool()const;
+
+  ///
+  /// Start querying a remote DICOM Image Store SCP and return immediately.
+  /// The studies are found first, then the series of the studies are
+  /// found over maximumAssociations() associations in parallel. The
+  /// results are written in the database as they arrive, from the thread
+  /// of this object: its event loop must run, or wait() be called.
+  /// Return false if a query is already running.
+  bool start(QSqlDatabase database);
+
+  ///
+  /// Write the results in the database until the running query is done
+  void wait();
+
+  bool isRunning()const;
+
+  /// Query a remote DICOM Image Store SCP, same as start() and wait()
   void query(QSqlDatabase database);
 
   // Add a StudyInstanceUID to be queried
   void addStudyInstanceUID ( QString StudyInstanceUID );
 
+public slots:
+  ///
+  /// Stop the running query. The finds in progress end with their
+  /// response or their timeout, the results found so far are kept.
+  void cancel();
+
+signals:
+  /// Percentage of the studies whose series are found
+  void progress(int percent);
+  /// Emitted once all the results are in the database
+  void queryFinished(bool success);
+
+protected slots:
+  void processResults();
+
 private:
   CTK_DECLARE_PRIVATE(ctkDICOMQuery);
 };
@@ -0,0 +1,120 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMQuery_p_h
+#define __ctkDICOMQuery_p_h
+
+// Qt includes
+#include <QAtomicInt>
+#include <QList>
+#include <QMutex>
+#include <QRunnable>
+#include <QStringList>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+// ctkDICOM includes
+#include "ctkDICOMAssociationPool_p.h"
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMQuery.h"
+
+//------------------------------------------------------------------------------
+/// State shared by the associations of one query. The workers find the
+/// studies, then the series of each study, and queue the results. The
+/// results are written in the database by the thread of the ctkDICOMQuery.
+struct ctkDICOMQueryJob
+{
+  ctkDICOMQueryJob(ctkDICOMQuery* query, int workers);
+
+  /// Called by the study worker once the study-level find is done
+  void addStudies(const QList<ctkDICOMIndexerRecord>& studies, bool success);
+  /// Block until a study is available, return false when there is none
+  /// left or when the query is canceled
+  bool nextStudy(QString& studyInstanceUID);
+  /// Queue the responses of the series-level find of one study, the job
+  /// fails if the find did not
+  void addSeries(const QList<ctkDICOMIndexerRecord>& series, bool success);
+  /// The job fails if the last worker leaves studies whose series were
+  /// not found
+  void workerFinished();
+  void cancel();
+
+  /// Notify the ctkDICOMQuery that results are waiting, in its thread
+  void notify();
+
+  ctkDICOMQuery* const Query;
+
+  /// Connection parameters, copied so that the workers don't access the
+  /// ctkDICOMQuery
+  QString CallingAETitle;
+  QString CalledAETitle;
+  QString Host;
+  int     Port;
+  int     Timeout;
+  ctkDICOMAssociationPool* AssociationPool;
+
+  QAtomicInt Canceled;
+
+  QMutex         Mutex;
+  QWaitCondition StudiesAvailable;
+  QWaitCondition ResultsAvailable;
+  QStringList    PendingStudies;
+  bool           StudiesDone;
+  bool           Success;
+  int            RunningWorkers;
+  int            StudyCount;
+  int            StudiesQueried;
+  QList<ctkDICOMIndexerRecord> Results;
+};
+
+//------------------------------------------------------------------------------
+/// One association to the called AE. The first worker finds the studies,
+/// then all the workers find the series of the studies in parallel.
+class ctkDICOMQueryTask : public QRunnable
+{
+public:
+  ctkDICOMQueryTask(ctkDICOMQueryJob* job, bool findStudies);
+  virtual void run();
+private:
+  ctkDICOMQueryJob* Job;
+  bool              FindStudies;
+};
+
+//------------------------------------------------------------------------------
+class ctkDICOMQueryPrivate: public ctkPrivate<ctkDICOMQuery>
+{
+public:
+  ctkDICOMQueryPrivate();
+  ~ctkDICOMQueryPrivate();
+
+  QString CallingAETitle;
+  QString CalledAETitle;
+  QString Host;
+  int Port;
+  int MaximumAssociations;
+  int Timeout;
+  ctkDICOMAssociationPool* AssociationPool;
+  QStringList StudyInstanceUIDList;
+
+  QThreadPool       Pool;
+  ctkDICOMQueryJob* Job;
+};
+
+#endif
@@ -29,9 +29,12 @@
 #include <QDirIterator>
 #include <QFileInfo>
 #include <QDebug>
+#include <QTime>
 
 // ctkDICOM includes
 #include "ctkDICOMRetrieve.h"
+#include "ctkDICOMRetrieve_p.h"
+#include "ctkDICOMStorage.h"
 #include "ctkLogger.h"
 
 // DCMTK includes
@@ -50,24 +53,387 @@
 #include <dcmtk/ofstd/ofstd.h>        /* for class OFStandard */
 #include <dcmtk/dcmdata/dcddirif.h>   /* for class DicomDirInterface */
 
+#include <dcmtk/dcmdata/dcuid.h>
 #include <dcmtk/dcmnet/scu.h>
 
 static ctkLogger logger ( "org.commontk.dicom.DICOMRetrieve" );
 
+/// Values longer than this are not read when indexing a received file
+static const Uint32 HeaderMaxReadLength = 4096;
+
+namespace
+{
+//------------------------------------------------------------------------------
+const char* TransferSyntaxes[] = {
+  UID_LittleEndianExplicitTransferSyntax,
+  UID_BigEndianExplicitTransferSyntax,
+  UID_LittleEndianImplicitTransferSyntax };
+const int TransferSyntaxCount = 3;
+
+//------------------------------------------------------------------------------
+/// See DIMSE_SubOpProviderCallback
+void subOperationCallback(void* task, T_ASC_Network* network, T_ASC_Association** subAssociation)
+{
+  static_cast<ctkDICOMRetrieveTask*>(task)->handleSubOperation(network, subAssociation);
+}
+
+//------------------------------------------------------------------------------
+/// Accept the storage sub-association of a C-MOVE
+OFCondition acceptSubAssociation(T_ASC_Network* network, T_ASC_Association** association)
+{
+  const char* verification[] = { UID_VerificationSOPClass };
+  OFCondition cond = ASC_receiveAssociation(network, association, ASC_DEFAULTMAXPDU);
+  if (cond.good())
+    {
+    cond = ASC_acceptContextsWithPreferredTransferSyntaxes((*association)->params,
+      verification, 1, TransferSyntaxes, TransferSyntaxCount);
+    }
+  if (cond.good())
+    {
+    cond = ASC_acceptContextsWithPreferredTransferSyntaxes((*association)->params,
+      dcmAllStorageSOPClassUIDs, numberOfAllDcmStorageSOPClassUIDs,
+      TransferSyntaxes, TransferSyntaxCount);
+    }
+  if (cond.good())
+    {
+    cond = ASC_acknowledgeAssociation(*association);
+    }
+  if (cond.bad())
+    {
+    ASC_dropAssociation(*association);
+    ASC_destroyAssociation(association);
+    }
+  return cond;
+}
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMRetrieveJob methods
+
+//------------------------------------------------------------------------------
+ctkDICOMRetrieveJob::ctkDICOMRetrieveJob(int workers)
+{
+  this->Method = ctkDICOMRetrieve::GetMethod;
+  this->CalledPort = 0;
+  this->Timeout = 0;
+  this->AssociationPool = 0;
+  this->MoveNetwork = 0;
+  this->RunningWorkers = workers;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMRetrieveJob::nextSeries(QString& seriesInstanceUID, QString& studyInstanceUID)
+{
+  QMutexLocker locker(&this->Mutex);
+  if (this->Canceled || this->PendingSeries.isEmpty())
+    {
+    return false;
+    }
+  seriesInstanceUID = this->PendingSeries.takeFirst();
+  studyInstanceUID = this->Studies.value(seriesInstanceUID);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieveJob::addInstance(const ctkDICOMIndexerRecord& record)
+{
+  QMutexLocker locker(&this->Mutex);
+  this->Instances << record;
+  this->ResultsAvailable.wakeAll();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieveJob::addSeries(const ctkDICOMRetrieveSeriesResult& result)
+{
+  QMutexLocker locker(&this->Mutex);
+  this->Series << result;
+  this->ResultsAvailable.wakeAll();
+}
+
 //------------------------------------------------------------------------------
-class ctkDICOMRetrievePrivate: public ctkPrivate<ctkDICOMRetrieve>
+void ctkDICOMRetrieveJob::workerFinished()
 {
-public:
-  ctkDICOMRetrievePrivate();
-  ~ctkDICOMRetrievePrivate();
-  QString CallingAETitle;
-  QString CalledAETitle;
-  QString Host;
-  int CallingPort;
-  int CalledPort;
-  DcmSCU SCU;
-  DcmDataset* query;
-};
+  QMutexLocker locker(&this->Mutex);
+  --this->RunningWorkers;
+  this->ResultsAvailable.wakeAll();
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMRetrieveTask methods
+
+//------------------------------------------------------------------------------
+ctkDICOMRetrieveTask::ctkDICOMRetrieveTask(ctkDICOMRetrieveJob* job)
+  : Job(job)
+{
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieveTask::run()
+{
+  ctkDICOMRetrieveJob* job = this->Job;
+  ctkDICOMAssociation* association = job->AssociationPool->acquire(
+    job->Method == ctkDICOMRetrieve::GetMethod ?
+      ctkDICOMAssociationPool::GetService : ctkDICOMAssociationPool::MoveService,
+    job->CallingAETitle, job->CalledAETitle, job->Host, job->CalledPort, job->Timeout);
+
+  bool reusable = association != 0;
+  QString seriesInstanceUID;
+  QString studyInstanceUID;
+  while (reusable && job->nextSeries(seriesInstanceUID, studyInstanceUID))
+    {
+    // the association may not be usable anymore after a failure, the
+    // series left are retrieved by the other workers
+    reusable = this->retrieve(association->Association, seriesInstanceUID, studyInstanceUID);
+    }
+
+  job->AssociationPool->release(association, reusable);
+  job->workerFinished();
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMRetrieveTask::retrieve(T_ASC_Association* association,
+                                    const QString& seriesInstanceUID,
+                                    const QString& studyInstanceUID)
+{
+  ctkDICOMRetrieveJob* job = this->Job;
+  const bool get = job->Method == ctkDICOMRetrieve::GetMethod;
+  const T_DIMSE_BlockingMode blockMode = job->Timeout > 0 ? DIMSE_NONBLOCKING : DIMSE_BLOCKING;
+  this->Current = ctkDICOMRetrieveSeriesResult();
+  this->Current.SeriesInstanceUID = seriesInstanceUID;
+  this->Current.StudyInstanceUID = studyInstanceUID;
+  QTime time;
+  time.start();
+
+  DcmDataset identifiers;
+  identifiers.putAndInsertString(DCM_QueryRetrieveLevel, "SERIES");
+  identifiers.putAndInsertString(DCM_SeriesInstanceUID, seriesInstanceUID.toLatin1().constData());
+  if (!studyInstanceUID.isEmpty())
+    {
+    identifiers.putAndInsertString(DCM_StudyInstanceUID, studyInstanceUID.toLatin1().constData());
+    }
+
+  const T_ASC_PresentationContextID presID = ASC_findAcceptedPresentationContextID(association,
+    get ? UID_GETStudyRootQueryRetrieveInformationModel :
+          UID_MOVEStudyRootQueryRetrieveInformationModel);
+  OFCondition cond = presID != 0 ? EC_Normal : DIMSE_NOVALIDPRESENTATIONCONTEXTID;
+  bool success = false;
+  if (cond.good() && get)
+    {
+    T_DIMSE_Message request;
+    memset(&request, 0, sizeof(request));
+    request.CommandField = DIMSE_C_GET_RQ;
+    T_DIMSE_C_GetRQ& getRequest = request.msg.CGetRQ;
+    getRequest.MessageID = association->nextMsgID++;
+    OFStandard::strlcpy(getRequest.AffectedSOPClassUID,
+      UID_GETStudyRootQueryRetrieveInformationModel, sizeof(getRequest.AffectedSOPClassUID));
+    getRequest.Priority = DIMSE_PRIORITY_MEDIUM;
+    getRequest.DataSetType = DIMSE_DATASET_PRESENT;
+    cond = DIMSE_sendMessageUsingMemoryData(association, presID, &request, NULL,
+                                            &identifiers, NULL, NULL);
+    // The C-STORE requests are interleaved with the pending C-GET responses
+    while (cond.good())
+      {
+      T_DIMSE_Message message;
+      T_ASC_PresentationContextID messagePresID = 0;
+      DcmDataset* statusDetail = NULL;
+      cond = DIMSE_receiveCommand(association, blockMode, job->Timeout,
+                                  &messagePresID, &message, &statusDetail);
+      delete statusDetail;
+      if (cond.bad())
+        {
+        break;
+        }
+      if (message.CommandField == DIMSE_C_STORE_RQ)
+        {
+        cond = this->storeInstance(association, &message, messagePresID);
+        }
+      else if (message.CommandField == DIMSE_C_GET_RSP)
+        {
+        const T_DIMSE_C_GetRSP& response = message.msg.CGetRSP;
+        if (response.DataSetType != DIMSE_DATASET_NULL)
+          {
+          // identifier of the failed instances, not used
+          DcmDataset* failed = NULL;
+          cond = DIMSE_receiveDataSetInMemory(association, blockMode, job->Timeout,
+                                              &messagePresID, &failed, NULL, NULL);
+          delete failed;
+          }
+        if (response.DimseStatus != STATUS_Pending)
+          {
+          success = response.DimseStatus == STATUS_Success;
+          break;
+          }
+        }
+      else
+        {
+        cond = DIMSE_BADCOMMANDTYPE;
+        }
+      }
+    }
+  else if (cond.good())
+    {
+    T_DIMSE_C_MoveRQ request;
+    memset(&request, 0, sizeof(request));
+    request.MessageID = association->nextMsgID++;
+    OFStandard::strlcpy(request.AffectedSOPClassUID,
+      UID_MOVEStudyRootQueryRetrieveInformationModel, sizeof(request.AffectedSOPClassUID));
+    request.Priority = DIMSE_PRIORITY_MEDIUM;
+    request.DataSetType = DIMSE_DATASET_PRESENT;
+    OFStandard::strlcpy(request.MoveDestination,
+      job->CallingAETitle.toLatin1().constData(), sizeof(request.MoveDestination));
+    T_DIMSE_C_MoveRSP response;
+    DcmDataset* statusDetail = NULL;
+    DcmDataset* responseIdentifiers = NULL;
+    QMutexLocker locker(&job->MoveMutex);
+    cond = DIMSE_moveUser(association, presID, &request, &identifiers,
+                          NULL, NULL, blockMode, job->Timeout,
+                          job->MoveNetwork, subOperationCallback, this,
+                          &response, &statusDetail, &responseIdentifiers);
+    delete statusDetail;
+    delete responseIdentifiers;
+    success = cond.good() && response.DimseStatus == STATUS_Success;
+    }
+
+  if (cond.bad())
+    {
+    logger.error ( "Retrieve of series " + seriesInstanceUID + " failed: " + cond.text() );
+    }
+  this->Current.Success = success;
+  this->Current.Msecs = time.elapsed();
+  job->addSeries(this->Current);
+  return cond.good();
+}
+
+//------------------------------------------------------------------------------
+OFCondition ctkDICOMRetrieveTask::storeInstance(T_ASC_Association* association,
+                                                T_DIMSE_Message* message,
+                                                T_ASC_PresentationContextID presentationContextID)
+{
+  ctkDICOMRetrieveJob* job = this->Job;
+  T_DIMSE_C_StoreRQ* request = &message->msg.CStoreRQ;
+  QDir directory(job->Directory);
+  // Same layout as ctkDICOMStorage. The UIDs are chosen by the peer, the
+  // path helper makes them safe file names. When the study of the series
+  // is unknown, the instance is received in a temporary file and moved
+  // once its header is read.
+  const QString sopInstanceUID = QString(request->AffectedSOPInstanceUID);
+  QString fileName;
+  if (!this->Current.StudyInstanceUID.isEmpty())
+    {
+    fileName = directory.filePath(ctkDICOMStorage::relativePath(
+      this->Current.StudyInstanceUID, this->Current.SeriesInstanceUID, sopInstanceUID));
+    directory.mkpath(QFileInfo(fileName).path());
+    }
+  else
+    {
+    fileName = directory.filePath(ctkDICOMStorage::pathComponent(sopInstanceUID) + ".part");
+    }
+
+  // Bit preserving mode: the dataset is written to the file as it is
+  // received, it is never loaded in memory
+  OFCondition cond = DIMSE_storeProvider(association, presentationContextID, request,
+    QFile::encodeName(fileName).constData(), 1, NULL, NULL, NULL,
+    job->Timeout > 0 ? DIMSE_NONBLOCKING : DIMSE_BLOCKING, job->Timeout);
+  if (cond.bad())
+    {
+    logger.error ( "Could not store " + fileName + ": " + cond.text() );
+    QFile::remove(fileName);
+    return cond;
+    }
+
+  ctkDICOMIndexerRecord record;
+  record.Filename = fileName;
+  DcmFileFormat fileformat;
+  if (fileformat.loadFile(QFile::encodeName(fileName).constData(), EXS_Unknown,
+                          EGL_noChange, HeaderMaxReadLength, ERM_autoDetect).good() &&
+      record.readDataset(fileformat.getDataset()))
+    {
+    if (this->Current.StudyInstanceUID.isEmpty())
+      {
+      const QString destination = directory.filePath(ctkDICOMStorage::relativePath(
+        record.StudyInstanceUID, this->Current.SeriesInstanceUID, sopInstanceUID));
+      directory.mkpath(QFileInfo(destination).path());
+      // release the file before moving it, and a destination that already
+      // exists is the same instance
+      fileformat.clear();
+      QFile::remove(destination);
+      if (!QFile::rename(fileName, destination))
+        {
+        logger.error ( "Could not move the received instance to " + destination );
+        QFile::remove(fileName);
+        return cond;
+        }
+      fileName = destination;
+      record.Filename = fileName;
+      }
+    ++this->Current.Instances;
+    this->Current.Bytes += QFileInfo(fileName).size();
+    job->addInstance(record);
+    }
+  else
+    {
+    logger.error ( "Could not read the received instance " + fileName );
+    if (this->Current.StudyInstanceUID.isEmpty())
+      {
+      QFile::remove(fileName);
+      }
+    }
+  return cond;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieveTask::handleSubOperation(T_ASC_Network* network,
+                                              T_ASC_Association** subAssociation)
+{
+  if (network == NULL)
+    {
+    return;
+    }
+  if (*subAssociation == NULL)
+    {
+    acceptSubAssociation(network, subAssociation);
+    return;
+    }
+  if (!ASC_dataWaiting(*subAssociation, 0))
+    {
+    return;
+    }
+  T_DIMSE_Message message;
+  T_ASC_PresentationContextID presID = 0;
+  OFCondition cond = DIMSE_receiveCommand(*subAssociation, DIMSE_BLOCKING, 0,
+                                          &presID, &message, NULL);
+  if (cond.good())
+    {
+    switch (message.CommandField)
+      {
+      case DIMSE_C_ECHO_RQ:
+        cond = DIMSE_sendEchoResponse(*subAssociation, presID,
+                                      &message.msg.CEchoRQ, STATUS_Success, NULL);
+        break;
+      case DIMSE_C_STORE_RQ:
+        cond = this->storeInstance(*subAssociation, &message, presID);
+        break;
+      default:
+        cond = DIMSE_BADCOMMANDTYPE;
+        break;
+      }
+    }
+  if (cond == DUL_PEERREQUESTEDRELEASE)
+    {
+    ASC_acknowledgeRelease(*subAssociation);
+    ASC_dropSCPAssociation(*subAssociation);
+    ASC_destroyAssociation(subAssociation);
+    }
+  else if (cond.bad())
+    {
+    if (cond != DUL_PEERABORTEDASSOCIATION)
+      {
+      ASC_abortAssociation(*subAssociation);
+      }
+    ASC_dropAssociation(*subAssociation);
+    ASC_destroyAssociation(subAssociation);
+    }
+}
 
 //------------------------------------------------------------------------------
 // ctkDICOMRetrievePrivate methods
@@ -75,16 +441,61 @@ public:
 //------------------------------------------------------------------------------
 ctkDICOMRetrievePrivate::ctkDICOMRetrievePrivate()
 {
-  query = new DcmDataset();
+  this->CallingPort = 0;
+  this->CalledPort = 0;
+  this->Method = ctkDICOMRetrieve::GetMethod;
+  this->MaximumAssociations = 4;
+  this->Timeout = 30;
+  this->AssociationPool = ctkDICOMAssociationPool::instance();
+  this->RetrievedSeries = 0;
+  this->Job = 0;
 }
 
 //------------------------------------------------------------------------------
 ctkDICOMRetrievePrivate::~ctkDICOMRetrievePrivate()
 {
-  delete query;
 }
 
-
+//------------------------------------------------------------------------------
+bool ctkDICOMRetrievePrivate::processResults(ctkDICOMRetrieveJob& job)
+{
+  CTK_P(ctkDICOMRetrieve);
+  QList<ctkDICOMIndexerRecord> instances;
+  QList<ctkDICOMRetrieveSeriesResult> series;
+  bool finished = false;
+    {
+    QMutexLocker locker(&job.Mutex);
+    while (job.Instances.isEmpty() && job.Series.isEmpty() && job.RunningWorkers > 0)
+      {
+      job.ResultsAvailable.wait(&job.Mutex);
+      }
+    qSwap(instances, job.Instances);
+    qSwap(series, job.Series);
+    finished = job.RunningWorkers == 0 && job.Instances.isEmpty() && job.Series.isEmpty();
+    }
+  foreach(const ctkDICOMIndexerRecord& instance, instances)
+    {
+    if (this->Database.isOpen())
+      {
+      this->Writer.insert(instance);
+      }
+    emit p->instanceRetrieved(instance.Filename);
+    }
+  foreach(const ctkDICOMRetrieveSeriesResult& result, series)
+    {
+    logger.info ( QString("Retrieved series %1: %2 instances, %3 bytes in %4 ms (%5 MB/s)")
+                  .arg(result.SeriesInstanceUID).arg(result.Instances).arg(result.Bytes)
+                  .arg(result.Msecs)
+                  .arg(result.Msecs > 0 ? result.Bytes / 1000. / result.Msecs : 0.) );
+    if (result.Success)
+      {
+      ++this->RetrievedSeries;
+      }
+    emit p->seriesRetrieved(result.SeriesInstanceUID, result.Success,
+                            result.Instances, result.Bytes, result.Msecs);
+    }
+  return !finished;
+}
 
 //------------------------------------------------------------------------------
 // ctkDICOMRetrieve methods
@@ -92,6 +503,7 @@ ctkDICOMRetrievePrivate::~ctkDICOMRetrievePrivate()
 //------------------------------------------------------------------------------
 ctkDICOMRetrieve::ctkDICOMRetrieve()
 {
+  CTK_INIT_PRIVATE(ctkDICOMRetrieve);
 }
 
 //------------------------------------------------------------------------------
@@ -154,6 +566,164 @@ int ctkDICOMRetrieve::calledPort()
 
 
 
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieve::setMethod(Method method)
+{
+  CTK_D(ctkDICOMRetrieve);
+  d->Method = method;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMRetrieve::Method ctkDICOMRetrieve::method()const
+{
+  CTK_D(const ctkDICOMRetrieve);
+  return d->Method;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieve::setMaximumAssociations(int associations)
+{
+  CTK_D(ctkDICOMRetrieve);
+  d->MaximumAssociations = qMax(associations, 1);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMRetrieve::maximumAssociations()const
+{
+  CTK_D(const ctkDICOMRetrieve);
+  return d->MaximumAssociations;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieve::setTimeout(int seconds)
+{
+  CTK_D(ctkDICOMRetrieve);
+  d->Timeout = qMax(seconds, 0);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMRetrieve::timeout()const
+{
+  CTK_D(const ctkDICOMRetrieve);
+  return d->Timeout;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieve::setDatabase(QSqlDatabase database)
+{
+  CTK_D(ctkDICOMRetrieve);
+  d->Database = database;
+  d->Writer.setDatabase(database);
+}
+
+//------------------------------------------------------------------------------
+QSqlDatabase ctkDICOMRetrieve::database()const
+{
+  CTK_D(const ctkDICOMRetrieve);
+  return d->Database;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieve::setAssociationPool(ctkDICOMAssociationPool* pool)
+{
+  CTK_D(ctkDICOMRetrieve);
+  d->AssociationPool = pool ? pool : ctkDICOMAssociationPool::instance();
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMAssociationPool* ctkDICOMRetrieve::associationPool()const
+{
+  CTK_D(const ctkDICOMRetrieve);
+  return d->AssociationPool;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMRetrieve::cancel()
+{
+  CTK_D(ctkDICOMRetrieve);
+  if (d->Job)
+    {
+    d->Job->Canceled.fetchAndStoreOrdered(1);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMRetrieve::retrieveSeries ( const QStringList& seriesInstanceUIDs, QDir directory )
+{
+  CTK_D(ctkDICOMRetrieve);
+  if (d->Job)
+    {
+    logger.error ( "A retrieve is already running" );
+    return false;
+    }
+  const bool move = d->Method == MoveMethod;
+  const int workers = qMin(move ? 1 : d->MaximumAssociations, seriesInstanceUIDs.size());
+  if (workers == 0)
+    {
+    return true;
+    }
+  ctkDICOMRetrieveJob job(workers);
+  job.Method = d->Method;
+  job.CallingAETitle = d->CallingAETitle;
+  job.CalledAETitle = d->CalledAETitle;
+  job.Host = d->Host;
+  job.CalledPort = d->CalledPort;
+  job.Timeout = d->Timeout;
+  job.Directory = directory.absolutePath();
+  job.AssociationPool = d->AssociationPool;
+  job.PendingSeries = seriesInstanceUIDs;
+
+  // The study is required by the PACS that don't support relational retrieve
+  if (d->Database.isOpen())
+    {
+    QSqlQuery study(d->Database);
+    study.prepare("SELECT StudyInstanceUID FROM Series WHERE SeriesInstanceUID = ?");
+    foreach(const QString& seriesInstanceUID, seriesInstanceUIDs)
+      {
+      study.bindValue(0, seriesInstanceUID);
+      if (study.exec() && study.next())
+        {
+        job.Studies.insert(seriesInstanceUID, study.value(0).toString());
+        }
+      study.finish();
+      }
+    }
+
+  if (move)
+    {
+    OFCondition cond = ASC_initializeNetwork(NET_ACCEPTORREQUESTOR, d->CallingPort,
+                                             d->Timeout, &job.MoveNetwork);
+    if (cond.bad())
+      {
+      logger.error ( QString("Could not listen on port %1: %2")
+                     .arg(d->CallingPort).arg(cond.text()) );
+      return false;
+      }
+    }
+
+  d->Job = &job;
+  d->Pool.setMaxThreadCount(workers);
+  for (int i = 0; i < workers; ++i)
+    {
+    d->Pool.start(new ctkDICOMRetrieveTask(&job));
+    }
+
+  d->RetrievedSeries = 0;
+  while (d->processResults(job))
+    {
+    }
+  d->Pool.waitForDone();
+  d->Writer.commit();
+  d->Job = 0;
+
+  if (job.MoveNetwork)
+    {
+    ASC_dropNetwork(&job.MoveNetwork);
+    }
+  return d->RetrievedSeries == seriesInstanceUIDs.size();
+}
+
 //------------------------------------------------------------------------------
 void ctkDICOMRetrieve::retrieveSeries ( QString seriesInstanceUID, QDir directory ) {
+  this->retrieveSeries ( QStringList() << seriesInstanceUID, directory );
 }
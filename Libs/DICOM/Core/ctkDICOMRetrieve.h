@@ -26,17 +26,32 @@
 #include <QObject>
 #include <QSqlDatabase>
 #include <QDir>
+#include <QStringList>
 
 // CTK includes
 #include <ctkPimpl.h>
 
 #include "CTKDICOMCoreExport.h"
 
+class ctkDICOMAssociationPool;
 class ctkDICOMRetrievePrivate;
 class CTK_DICOM_CORE_EXPORT ctkDICOMRetrieve : public QObject
 {
   Q_OBJECT
+  Q_ENUMS(Method);
+  Q_PROPERTY(Method method READ method WRITE setMethod);
+  Q_PROPERTY(int maximumAssociations READ maximumAssociations WRITE setMaximumAssociations);
+  Q_PROPERTY(int timeout READ timeout WRITE setTimeout);
 public:
+  enum Method
+  {
+    /// The instances are sent back on the retrieve association
+    GetMethod,
+    /// The called AE opens an association to callingAETitle on
+    /// callingPort() to send the instances. It must know this AE.
+    MoveMethod
+  };
+
   explicit ctkDICOMRetrieve();
   virtual ~ctkDICOMRetrieve();
 
@@ -52,9 +67,59 @@ public:
   void setCalledPort ( int port );
   int calledPort();
 
+  ///
+  /// Default is GetMethod
+  void setMethod(Method method);
+  Method method()const;
+
+  ///
+  /// Number of series retrieved in parallel, each over its own association.
+  /// The C-MOVE sub-associations all arrive on callingPort(), the series
+  /// are then moved one at a time. Default is 4.
+  void setMaximumAssociations(int associations);
+  int maximumAssociations()const;
+
+  ///
+  /// Timeout in seconds of the association negotiation and of each
+  /// message. Default is 30.
+  void setTimeout(int seconds);
+  int timeout()const;
+
+  ///
+  /// Pool the associations are acquired from, the shared
+  /// ctkDICOMAssociationPool::instance() by default. Setting 0 restores
+  /// the default.
+  void setAssociationPool(ctkDICOMAssociationPool* pool);
+  ctkDICOMAssociationPool* associationPool()const;
+
+  ///
+  /// If set, the retrieved instances are indexed in this database. It is
+  /// also used to find the study of the retrieved series.
+  void setDatabase(QSqlDatabase database);
+  QSqlDatabase database()const;
+
+  ///
+  /// Retrieve the instances of the series in directory, with the layout of
+  /// ctkDICOMStorage: <directory>/<StudyInstanceUID>/<SeriesInstanceUID>/
+  /// <SOPInstanceUID>.dcm. The instances are written to disk as they arrive
+  /// and indexed from the calling thread.
+  /// Return false if a series could not be retrieved completely.
+  bool retrieveSeries ( const QStringList& seriesInstanceUIDs, QDir directory );
   // Could be a slot...
   void retrieveSeries ( QString seriesInstanceUID, QDir directory );
 
+public slots:
+  ///
+  /// Stop the running retrieve after the series being transferred
+  void cancel();
+
+signals:
+  /// Emitted when an instance is written in the directory
+  void instanceRetrieved(const QString& fileName);
+  /// Emitted when a series is retrieved, with its transfer measures
+  void seriesRetrieved(const QString& seriesInstanceUID, bool success,
+                       int instances, qint64 bytes, int msecs);
+
 private:
   CTK_DECLARE_PRIVATE(ctkDICOMRetrieve);
 
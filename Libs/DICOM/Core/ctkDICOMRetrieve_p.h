@@ -0,0 +1,156 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMRetrieve_p_h
+#define __ctkDICOMRetrieve_p_h
+
+// Qt includes
+#include <QAtomicInt>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QRunnable>
+#include <QStringList>
+#include <QThreadPool>
+#include <QTime>
+#include <QWaitCondition>
+
+// ctkDICOM includes
+#include "ctkDICOMAssociationPool_p.h"
+#include "ctkDICOMDatabaseWriter.h"
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMRetrieve.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmnet/assoc.h>
+#include <dcmtk/dcmnet/dimse.h>
+
+//------------------------------------------------------------------------------
+/// Transfer measures of one series
+struct ctkDICOMRetrieveSeriesResult
+{
+  ctkDICOMRetrieveSeriesResult() : Success(false), Instances(0), Bytes(0), Msecs(0) {}
+  QString SeriesInstanceUID;
+  /// Empty when the series is not in the database yet
+  QString StudyInstanceUID;
+  bool    Success;
+  int     Instances;
+  qint64  Bytes;
+  int     Msecs;
+};
+
+//------------------------------------------------------------------------------
+/// State shared by the associations of one retrieveSeries call. The workers
+/// take the series one by one, write the received instances in the
+/// destination directory and queue their records. The records are written
+/// in the database by the thread calling retrieveSeries.
+struct ctkDICOMRetrieveJob
+{
+  ctkDICOMRetrieveJob(int workers);
+
+  /// Return false when there is no series left or the job is canceled
+  bool nextSeries(QString& seriesInstanceUID, QString& studyInstanceUID);
+  void addInstance(const ctkDICOMIndexerRecord& record);
+  void addSeries(const ctkDICOMRetrieveSeriesResult& result);
+  void workerFinished();
+
+  /// Connection parameters, copied so that the workers don't access the
+  /// ctkDICOMRetrieve
+  ctkDICOMRetrieve::Method Method;
+  QString CallingAETitle;
+  QString CalledAETitle;
+  QString Host;
+  int     CalledPort;
+  int     Timeout;
+  QString Directory;
+  ctkDICOMAssociationPool* AssociationPool;
+  /// Acceptor network of the C-MOVE sub-associations, shared by the
+  /// workers. MoveMutex serializes the moves since any worker could
+  /// otherwise accept the sub-association of another one.
+  T_ASC_Network* MoveNetwork;
+  QMutex         MoveMutex;
+
+  QAtomicInt Canceled;
+
+  QMutex         Mutex;
+  QWaitCondition ResultsAvailable;
+  /// Series to retrieve, with their study if known
+  QStringList             PendingSeries;
+  QHash<QString, QString> Studies;
+  int                     RunningWorkers;
+  QList<ctkDICOMIndexerRecord>        Instances;
+  QList<ctkDICOMRetrieveSeriesResult> Series;
+};
+
+//------------------------------------------------------------------------------
+/// One association to the called AE, retrieving series until none is left
+class ctkDICOMRetrieveTask : public QRunnable
+{
+public:
+  ctkDICOMRetrieveTask(ctkDICOMRetrieveJob* job);
+  virtual void run();
+
+  /// Called for each instance received, from the thread of the task
+  OFCondition storeInstance(T_ASC_Association* association, T_DIMSE_Message* message,
+                            T_ASC_PresentationContextID presentationContextID);
+  /// C-MOVE sub-association handling, see DIMSE_SubOpProviderCallback
+  void handleSubOperation(T_ASC_Network* network, T_ASC_Association** subAssociation);
+
+private:
+  bool retrieve(T_ASC_Association* association, const QString& seriesInstanceUID,
+                const QString& studyInstanceUID);
+
+  ctkDICOMRetrieveJob*         Job;
+  ctkDICOMRetrieveSeriesResult Current;
+};
+
+//------------------------------------------------------------------------------
+class ctkDICOMRetrievePrivate: public ctkPrivate<ctkDICOMRetrieve>
+{
+public:
+  ctkDICOMRetrievePrivate();
+  ~ctkDICOMRetrievePrivate();
+
+  /// Wait for results, write the queued records and emit the finished
+  /// series. Return false once all the workers are done.
+  bool processResults(ctkDICOMRetrieveJob& job);
+
+  QString CallingAETitle;
+  QString CalledAETitle;
+  QString Host;
+  int CallingPort;
+  int CalledPort;
+  ctkDICOMRetrieve::Method Method;
+  int MaximumAssociations;
+  int Timeout;
+  ctkDICOMAssociationPool* AssociationPool;
+
+  QSqlDatabase           Database;
+  ctkDICOMDatabaseWriter Writer;
+  QThreadPool            Pool;
+  ctkDICOMRetrieveJob*   Job;
+  /// Series retrieved successfully by the running retrieveSeries
+  int                    RetrievedSeries;
+};
+
+#endif
@@ -0,0 +1,503 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QSet>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QStringList>
+#include <QTime>
+#include <QVariant>
+
+// ctkDICOM includes
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMSearch.h"
+#include "ctkLogger.h"
+
+// STD includes
+#include <algorithm>
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMSearch" );
+
+namespace
+{
+/// Table, key and indexed text of each level. The text must be the one
+/// built by ctkDICOMSearch::indexedText().
+struct ctkDICOMSearchSource
+{
+  const char* Table;
+  const char* UID;
+  const char* Content;
+};
+
+const ctkDICOMSearchSource Sources[] =
+{
+  { "Patients", "UID",
+    "ifnull(PatientsName, '') || ' ' || ifnull(PatientID, '')" },
+  { "Studies", "StudyInstanceUID",
+    "ifnull(StudyDescription, '') || ' ' || ifnull(AccessionNumber, '') || ' ' || "
+    "ifnull(StudyID, '') || ' ' || ifnull(ModalitiesInStudy, '') || ' ' || "
+    "ifnull(Modalities, '')" },
+  { "Series", "SeriesInstanceUID",
+    "ifnull(SeriesDescription, '') || ' ' || ifnull(BodyPartExamined, '')" }
+};
+
+/// The shortest texts are picked among at most RankedRowsFactor times the
+/// requested number of rows: sorting all the rows a short prefix matches
+/// would read most of the index.
+const int RankedRowsFactor = 8;
+
+bool scoreGreaterThan(const ctkDICOMSearchMatch& m1, const ctkDICOMSearchMatch& m2)
+{
+  return m1.Score > m2.Score;
+}
+}
+
+//------------------------------------------------------------------------------
+class ctkDICOMSearchPrivate: public ctkPrivate<ctkDICOMSearch>
+{
+public:
+  static bool hasIndex(QSqlDatabase database);
+  /// Index the rows of the Patients, Studies and Series tables
+  static bool fill(QSqlDatabase database);
+  /// Lower case words of text, split like the default tokenizer of the
+  /// full-text tables does
+  static QStringList words(const QString& text);
+  /// 0 if a word of words doesn't start any word of text. Exact words
+  /// count twice as much as prefixes and short texts rank first.
+  static double score(const QStringList& words, const QString& text);
+
+  /// Candidate matches read from the full-text table, or from the tables
+  /// if there is none
+  bool findIndexed(const QStringList& words, int limit, QList<ctkDICOMSearchMatch>& matches)const;
+  bool findScanned(const QStringList& words, int limit, QList<ctkDICOMSearchMatch>& matches)const;
+  /// Set the UID of the level of the match
+  static void setUID(ctkDICOMSearchMatch& match, const QString& uid);
+  /// Fill the UIDs of the ancestors of the match
+  void setAncestors(ctkDICOMSearchMatch& match)const;
+
+  QSqlDatabase Database;
+};
+
+//------------------------------------------------------------------------------
+// ctkDICOMSearchPrivate methods
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSearchPrivate::hasIndex(QSqlDatabase database)
+{
+  QSqlQuery query(database);
+  query.exec("SELECT name FROM sqlite_master WHERE type = 'table' AND name = 'SearchIndex'");
+  return query.next();
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSearchPrivate::fill(QSqlDatabase database)
+{
+  QSqlQuery query(database);
+  for (int level = ctkDICOMSearch::PatientLevel; level <= ctkDICOMSearch::SeriesLevel; ++level)
+    {
+    const ctkDICOMSearchSource& source = Sources[level];
+    const QString statement = QString(
+      "INSERT INTO SearchIndex (Level, UID, Content) SELECT %1, %2, %3 FROM %4")
+      .arg(level).arg(source.UID).arg(source.Content).arg(source.Table);
+    if (!query.exec(statement))
+      {
+      logger.error ( "Error indexing " + QString(source.Table) + ": " +
+                     query.lastError().text() );
+      return false;
+      }
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+QStringList ctkDICOMSearchPrivate::words(const QString& text)
+{
+  QStringList res;
+  QString word;
+  foreach(const QChar& c, text)
+    {
+    if (c.isLetterOrNumber())
+      {
+      word += c.toLower();
+      }
+    else if (!word.isEmpty())
+      {
+      res << word;
+      word.clear();
+      }
+    }
+  if (!word.isEmpty())
+    {
+    res << word;
+    }
+  return res;
+}
+
+//------------------------------------------------------------------------------
+double ctkDICOMSearchPrivate::score(const QStringList& searchedWords, const QString& text)
+{
+  const QStringList textWords = words(text);
+  double res = 0.;
+  foreach(const QString& searchedWord, searchedWords)
+    {
+    int best = 0;
+    foreach(const QString& textWord, textWords)
+      {
+      if (textWord == searchedWord)
+        {
+        best = 2;
+        break;
+        }
+      if (textWord.startsWith(searchedWord))
+        {
+        best = 1;
+        }
+      }
+    if (best == 0)
+      {
+      return 0.;
+      }
+    res += best;
+    }
+  return res + 1. / (1 + textWords.size());
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSearchPrivate::findIndexed(const QStringList& searchedWords, int limit,
+                                        QList<ctkDICOMSearchMatch>& matches)const
+{
+  // The words only have letters and digits, they can't be operators of the
+  // query syntax: "doe jo" becomes "doe* jo*", both prefixes are required.
+  // The rows with the exact words are read first so that the prefixes of
+  // a large part of the database don't push them beyond the limit, the
+  // shortest texts rank first among a bounded number of the others.
+  const QString queries[] = {searchedWords.join(" "), searchedWords.join("* ") + "*"};
+  QSet<QString> found;
+  QSqlQuery query(this->Database);
+  query.setForwardOnly(true);
+  for (int i = 0; i < 2; ++i)
+    {
+    query.prepare("SELECT Level, UID, Content FROM "
+                  "(SELECT Level, UID, Content FROM SearchIndex WHERE Content MATCH ? LIMIT ?) "
+                  "ORDER BY length(Content) LIMIT ?");
+    query.bindValue(0, queries[i]);
+    query.bindValue(1, limit * RankedRowsFactor);
+    query.bindValue(2, limit);
+    if (!query.exec())
+      {
+      logger.error ( "Error searching the index: " + query.lastError().text() );
+      return false;
+      }
+    while (query.next())
+      {
+      const QString key = query.value(0).toString() + " " + query.value(1).toString();
+      if (found.contains(key))
+        {
+        continue;
+        }
+      found.insert(key);
+      ctkDICOMSearchMatch match;
+      match.Level = query.value(0).toInt();
+      match.Text = query.value(2).toString();
+      setUID(match, query.value(1).toString());
+      matches << match;
+      }
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSearchPrivate::findScanned(const QStringList& searchedWords, int limit,
+                                        QList<ctkDICOMSearchMatch>& matches)const
+{
+  QSqlQuery query(this->Database);
+  query.setForwardOnly(true);
+  for (int level = ctkDICOMSearch::PatientLevel; level <= ctkDICOMSearch::SeriesLevel; ++level)
+    {
+    const ctkDICOMSearchSource& source = Sources[level];
+    QStringList conditions;
+    for (int i = 0; i < searchedWords.size(); ++i)
+      {
+      conditions << "Content LIKE ?";
+      }
+    query.prepare(QString("SELECT UID, Content FROM "
+                          "(SELECT UID, Content FROM (SELECT %1 AS UID, %2 AS Content FROM %3) "
+                          "WHERE %4 LIMIT ?) ORDER BY length(Content) LIMIT ?")
+                  .arg(source.UID).arg(source.Content).arg(source.Table)
+                  .arg(conditions.join(" AND ")));
+    int i = 0;
+    foreach(const QString& word, searchedWords)
+      {
+      // no wildcard to escape, the words only have letters and digits
+      query.bindValue(i++, "%" + word + "%");
+      }
+    query.bindValue(i++, limit * RankedRowsFactor);
+    query.bindValue(i, limit);
+    if (!query.exec())
+      {
+      logger.error ( "Error searching " + QString(source.Table) + ": " +
+                     query.lastError().text() );
+      return false;
+      }
+    while (query.next())
+      {
+      ctkDICOMSearchMatch match;
+      match.Level = level;
+      match.Text = query.value(1).toString();
+      setUID(match, query.value(0).toString());
+      matches << match;
+      }
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSearchPrivate::setUID(ctkDICOMSearchMatch& match, const QString& uid)
+{
+  switch (match.Level)
+    {
+    case ctkDICOMSearch::PatientLevel:
+      match.PatientUID = uid;
+      break;
+    case ctkDICOMSearch::StudyLevel:
+      match.StudyInstanceUID = uid;
+      break;
+    default:
+      match.SeriesInstanceUID = uid;
+      break;
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSearchPrivate::setAncestors(ctkDICOMSearchMatch& match)const
+{
+  QSqlQuery query(this->Database);
+  if (match.Level == ctkDICOMSearch::SeriesLevel)
+    {
+    query.prepare("SELECT StudyInstanceUID FROM Series WHERE SeriesInstanceUID = ?");
+    query.bindValue(0, match.SeriesInstanceUID);
+    if (query.exec() && query.next())
+      {
+      match.StudyInstanceUID = query.value(0).toString();
+      }
+    }
+  if (match.Level >= ctkDICOMSearch::StudyLevel)
+    {
+    query.prepare("SELECT PatientsUID FROM Studies WHERE StudyInstanceUID = ?");
+    query.bindValue(0, match.StudyInstanceUID);
+    if (query.exec() && query.next())
+      {
+      match.PatientUID = query.value(0).toString();
+      }
+    }
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMSearch methods
+
+//------------------------------------------------------------------------------
+ctkDICOMSearch::ctkDICOMSearch(QSqlDatabase database)
+{
+  CTK_INIT_PRIVATE(ctkDICOMSearch);
+  CTK_D(ctkDICOMSearch);
+  d->Database = database;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMSearch::~ctkDICOMSearch()
+{
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSearch::setDatabase(QSqlDatabase database)
+{
+  CTK_D(ctkDICOMSearch);
+  d->Database = database;
+}
+
+//------------------------------------------------------------------------------
+QSqlDatabase ctkDICOMSearch::database()const
+{
+  CTK_D(const ctkDICOMSearch);
+  return d->Database;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSearch::createIndex(QSqlDatabase database)
+{
+  if (ctkDICOMSearchPrivate::hasIndex(database))
+    {
+    return true;
+    }
+  QSqlQuery query(database);
+  // Level and UID are stored with the text, only Content is searched
+  if (!query.exec("CREATE VIRTUAL TABLE SearchIndex USING fts3(Level, UID, Content)"))
+    {
+    logger.warn ( "No full-text search support, searches will scan the tables: " +
+                  query.lastError().text() );
+    return false;
+    }
+  database.transaction();
+  if (!ctkDICOMSearchPrivate::fill(database))
+    {
+    database.rollback();
+    query.exec("DROP TABLE SearchIndex");
+    return false;
+    }
+  return database.commit();
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSearch::isIndexed()const
+{
+  CTK_D(const ctkDICOMSearch);
+  return ctkDICOMSearchPrivate::hasIndex(d->Database);
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSearch::rebuild()
+{
+  CTK_D(ctkDICOMSearch);
+  if (!this->isIndexed())
+    {
+    return ctkDICOMSearch::createIndex(d->Database);
+    }
+  d->Database.transaction();
+  QSqlQuery query(d->Database);
+  if (!query.exec("DELETE FROM SearchIndex") ||
+      !ctkDICOMSearchPrivate::fill(d->Database))
+    {
+    logger.error ( "Error rebuilding the search index: " + query.lastError().text() );
+    d->Database.rollback();
+    return false;
+    }
+  return d->Database.commit();
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSearch::reindex(Level level, const QString& uid)
+{
+  CTK_D(ctkDICOMSearch);
+  // UID is not a key of the full-text table, the row is looked up by the
+  // longest word of the UID, the rarest, instead of scanning the table
+  QString rarest;
+  foreach(const QString& word, ctkDICOMSearchPrivate::words(uid))
+    {
+    if (word.size() > rarest.size())
+      {
+      rarest = word;
+      }
+    }
+  if (rarest.isEmpty() || !this->isIndexed())
+    {
+    return false;
+    }
+  const ctkDICOMSearchSource& source = Sources[level];
+  QSqlQuery query(d->Database);
+  // the patient UIDs are integers when indexed by createIndex()
+  query.prepare(QString("UPDATE SearchIndex SET Content = (SELECT %1 FROM %2 WHERE %3 = ?) "
+                        "WHERE SearchIndex MATCH ? AND Level = ? AND CAST(UID AS TEXT) = ?")
+                .arg(source.Content).arg(source.Table).arg(source.UID));
+  query.bindValue(0, uid);
+  query.bindValue(1, "UID:" + rarest);
+  query.bindValue(2, static_cast<int>(level));
+  query.bindValue(3, uid);
+  if (!query.exec())
+    {
+    logger.error ( "Error indexing " + uid + " again: " + query.lastError().text() );
+    return false;
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+QList<ctkDICOMSearchMatch> ctkDICOMSearch::search(const QString& text, int maximumMatches)const
+{
+  CTK_D(const ctkDICOMSearch);
+  QList<ctkDICOMSearchMatch> matches;
+  const QStringList searchedWords = ctkDICOMSearchPrivate::words(text);
+  if (searchedWords.isEmpty() || maximumMatches <= 0)
+    {
+    return matches;
+    }
+  QTime time;
+  time.start();
+
+  // Short prefixes can match a large part of the database, only the first
+  // candidates are ranked.
+  const int candidates = maximumMatches * 8;
+  if (this->isIndexed())
+    {
+    d->findIndexed(searchedWords, candidates, matches);
+    }
+  else
+    {
+    d->findScanned(searchedWords, candidates, matches);
+    }
+
+  QList<ctkDICOMSearchMatch>::iterator it = matches.begin();
+  while (it != matches.end())
+    {
+    it->Score = ctkDICOMSearchPrivate::score(searchedWords, it->Text);
+    if (it->Score == 0.)
+      {
+      // a scanned word matched inside a word, not at its start
+      it = matches.erase(it);
+      continue;
+      }
+    it->Score += 0.1 * (SeriesLevel - it->Level);
+    ++it;
+    }
+  std::stable_sort(matches.begin(), matches.end(), scoreGreaterThan);
+  while (matches.size() > maximumMatches)
+    {
+    matches.removeLast();
+    }
+  for (it = matches.begin(); it != matches.end(); ++it)
+    {
+    d->setAncestors(*it);
+    }
+  logger.debug ( QString("Search of \"%1\": %2 matches in %3 ms")
+                 .arg(text).arg(matches.size()).arg(time.elapsed()) );
+  return matches;
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMSearch::indexedText(Level level, const ctkDICOMIndexerRecord& record)
+{
+  QStringList fields;
+  switch (level)
+    {
+    case PatientLevel:
+      fields << record.PatientsName << record.PatientID;
+      break;
+    case StudyLevel:
+      // the Modalities aggregate is empty until the series are counted,
+      // the study is then indexed again by ctkDICOMDatabaseWriter
+      fields << record.StudyDescription << record.AccessionNumber
+             << record.StudyID << record.ModalitiesInStudy << QString();
+      break;
+    case SeriesLevel:
+      fields << record.SeriesDescription << record.BodyPartExamined;
+      break;
+    }
+  return fields.join(" ");
+}
@@ -0,0 +1,117 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMSearch_h
+#define __ctkDICOMSearch_h
+
+// Qt includes
+#include <QList>
+#include <QSqlDatabase>
+#include <QString>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMCoreExport.h"
+
+struct ctkDICOMIndexerRecord;
+class ctkDICOMSearchPrivate;
+
+///
+/// Patient, study or series matching a search, with the UIDs of its
+/// ancestors. The UIDs below the level of the match are empty.
+struct CTK_DICOM_CORE_EXPORT ctkDICOMSearchMatch
+{
+  ctkDICOMSearchMatch() : Level(0), Score(0.) {}
+  /// ctkDICOMSearch::Level
+  int     Level;
+  /// Patients.UID
+  QString PatientUID;
+  QString StudyInstanceUID;
+  QString SeriesInstanceUID;
+  /// Indexed text of the match
+  QString Text;
+  /// Higher is better
+  double  Score;
+};
+
+///
+/// Search the patients, studies and series of a DICOM database by words or
+/// word prefixes: patient name and ID, study description, accession number
+/// and ID, modalities, series description and body part.
+/// The words are looked up in the SearchIndex full-text table, kept in sync
+/// by ctkDICOMDatabaseWriter. If the SQLite library has no full-text
+/// support, the tables are scanned instead.
+/// The search must be used from the thread owning the database connection.
+class CTK_DICOM_CORE_EXPORT ctkDICOMSearch
+{
+public:
+  enum Level
+  {
+    PatientLevel,
+    StudyLevel,
+    SeriesLevel
+  };
+
+  explicit ctkDICOMSearch(QSqlDatabase database = QSqlDatabase());
+  virtual ~ctkDICOMSearch();
+
+  void setDatabase(QSqlDatabase database);
+  QSqlDatabase database()const;
+
+  ///
+  /// Create the SearchIndex table of @param database if it doesn't exist
+  /// and index the rows already in the database. The table is part of the
+  /// database schema, this is only needed if it was dropped. Return false
+  /// if the SQLite library has no full-text support.
+  static bool createIndex(QSqlDatabase database);
+
+  ///
+  /// True if the database has a SearchIndex table
+  bool isIndexed()const;
+
+  ///
+  /// Index again all the patients, studies and series, after the tables
+  /// were changed without ctkDICOMDatabaseWriter.
+  bool rebuild();
+
+  ///
+  /// Index again the patient, study or series @param uid from its table,
+  /// e.g. once the Modalities aggregate of a study is updated.
+  bool reindex(Level level, const QString& uid);
+
+  ///
+  /// Patients, studies and series whose indexed text contains a word
+  /// starting with each word of @param text, best matches first. Exact
+  /// words rank before prefixes, patients before studies before series.
+  /// At most @param maximumMatches are returned, ranked among the
+  /// candidates with all the words exact then the shortest of a bounded
+  /// number of other ones.
+  QList<ctkDICOMSearchMatch> search(const QString& text, int maximumMatches = 100)const;
+
+  ///
+  /// Text indexed for the patient, study or series of @param record
+  static QString indexedText(Level level, const ctkDICOMIndexerRecord& record);
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMSearch);
+};
+
+#endif
@@ -0,0 +1,765 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QFile>
+#include <QRunnable>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QThread>
+#include <QThreadPool>
+#include <QTime>
+#include <QVariant>
+#include <QVector>
+
+// ctkDICOM includes
+#include "ctkDICOMSeriesLoader.h"
+#include "ctkLogger.h"
+
+// DCMTK includes
+#ifndef WIN32
+  #define HAVE_CONFIG_H
+#endif
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcfilefo.h>
+#include <dcmtk/dcmdata/dcdatset.h>
+#include <dcmtk/ofstd/ofcond.h>
+
+// STD includes
+#include <algorithm>
+#include <cstring>
+
+#ifdef Q_OS_UNIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMSeriesLoader" );
+
+//------------------------------------------------------------------------------
+/// Header attributes and mapping of one file
+struct ctkDICOMSeriesLoaderFile
+{
+  ctkDICOMSeriesLoaderFile();
+
+  QString Filename;
+  bool    Valid;
+  QString Error;
+
+  int    Rows;
+  int    Columns;
+  int    Frames;
+  int    SamplesPerPixel;
+  int    BitsAllocated;
+  int    PixelRepresentation;
+  double Slope;
+  double Intercept;
+
+  bool   HasGeometry;
+  double Position[3];
+  double Orientation[6];
+  double PixelSpacing[2];
+  /// SpacingBetweenSlices, or SliceThickness, of the frames of the file
+  double FrameSpacing;
+  /// Position along the slice normal
+  double Distance;
+
+  /// The whole file is mapped, Data is its pixel data
+  uchar*       Address;
+  qint64       MappedSize;
+  const uchar* Data;
+#ifndef Q_OS_UNIX
+  /// The mapping lasts as long as the file is open
+  QFile*       File;
+#endif
+};
+
+//------------------------------------------------------------------------------
+ctkDICOMSeriesLoaderFile::ctkDICOMSeriesLoaderFile()
+{
+  this->Valid = false;
+  this->Rows = 0;
+  this->Columns = 0;
+  this->Frames = 1;
+  this->SamplesPerPixel = 1;
+  this->BitsAllocated = 0;
+  this->PixelRepresentation = 0;
+  this->Slope = 1.;
+  this->Intercept = 0.;
+  this->HasGeometry = false;
+  for (int i = 0; i < 3; ++i)
+    {
+    this->Position[i] = 0.;
+    }
+  // axial slices by default
+  const double identity[6] = {1., 0., 0., 0., 1., 0.};
+  std::memcpy(this->Orientation, identity, sizeof(identity));
+  this->PixelSpacing[0] = this->PixelSpacing[1] = 1.;
+  this->FrameSpacing = 0.;
+  this->Distance = 0.;
+  this->Address = 0;
+  this->MappedSize = 0;
+  this->Data = 0;
+#ifndef Q_OS_UNIX
+  this->File = 0;
+#endif
+}
+
+namespace
+{
+//------------------------------------------------------------------------------
+bool distanceLessThan(const ctkDICOMSeriesLoaderFile* f1, const ctkDICOMSeriesLoaderFile* f2)
+{
+  return f1->Distance < f2->Distance;
+}
+
+//------------------------------------------------------------------------------
+quint32 readUint32(const uchar* data)
+{
+  return quint32(data[0]) | (quint32(data[1]) << 8) |
+    (quint32(data[2]) << 16) | (quint32(data[3]) << 24);
+}
+
+//------------------------------------------------------------------------------
+/// Offset of the value of the PixelData element of @param length bytes,
+/// -1 if it is not found. The element is usually the last one of the file,
+/// it is searched from the start of the file otherwise.
+qint64 pixelDataOffset(const uchar* data, qint64 size, qint64 length, bool explicitVR)
+{
+  // tag, then VR, 2 reserved bytes and length, or the length only
+  const qint64 headerLength = explicitVR ? 12 : 8;
+  const uchar tag[4] = {0xE0, 0x7F, 0x10, 0x00};
+  qint64 candidate = size - length - headerLength;
+  // odd lengths are padded
+  for (int padding = 0; padding < 2; ++padding, --candidate)
+    {
+    if (candidate >= 0 && std::memcmp(data + candidate, tag, 4) == 0 &&
+        readUint32(data + candidate + headerLength - 4) == length + padding)
+      {
+      return candidate + headerLength;
+      }
+    }
+  // after the 128 bytes preamble and "DICM"
+  for (qint64 pos = 132; pos + headerLength + length <= size; ++pos)
+    {
+    const uchar* found = static_cast<const uchar*>(
+      std::memchr(data + pos, tag[0], size - headerLength - length - pos + 1));
+    if (!found)
+      {
+      break;
+      }
+    pos = found - data;
+    if (std::memcmp(found, tag, 4) == 0 &&
+        (!explicitVR || (found[4] == 'O' && (found[5] == 'W' || found[5] == 'B'))))
+      {
+      const quint32 valueLength = readUint32(found + headerLength - 4);
+      // 0xFFFFFFFF is the undefined length of encapsulated pixel data
+      if (valueLength >= length && valueLength <= length + 1)
+        {
+        return pos + headerLength;
+        }
+      }
+    }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+OFCondition loadHeader(DcmFileFormat& fileformat, const QString& filePath)
+{
+  const QByteArray fileName = filePath.toLocal8Bit();
+#if OFFIS_DCMTK_VERSION_NUMBER >= 361
+  return fileformat.loadFileUntilTag(fileName.constData(), EXS_Unknown,
+    EGL_noChange, 4096, ERM_autoDetect, DCM_PixelData);
+#else
+  // the pixel data is skipped instead of being read, as any large value
+  return fileformat.loadFile(fileName.constData(), EXS_Unknown,
+    EGL_noChange, 4096, ERM_autoDetect);
+#endif
+}
+
+//------------------------------------------------------------------------------
+int readUint16(DcmDataset* dataset, const DcmTagKey& tag, int defaultValue)
+{
+  Uint16 value = 0;
+  return dataset->findAndGetUint16(tag, value).good() ? value : defaultValue;
+}
+
+//------------------------------------------------------------------------------
+bool readFloat64(DcmDataset* dataset, const DcmTagKey& tag, double* values, int count)
+{
+  for (int i = 0; i < count; ++i)
+    {
+    Float64 value = 0.;
+    if (!dataset->findAndGetFloat64(tag, value, i).good())
+      {
+      return false;
+      }
+    values[i] = value;
+    }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+/// Parse and map a range of the files
+class ctkDICOMSeriesLoaderTask : public QRunnable
+{
+public:
+  ctkDICOMSeriesLoaderTask(QVector<ctkDICOMSeriesLoaderFile>& files, int begin, int end)
+    : Files(files), Begin(begin), End(end) {}
+  virtual void run();
+
+  static void parse(ctkDICOMSeriesLoaderFile& file);
+  static void map(ctkDICOMSeriesLoaderFile& file, bool explicitVR);
+  static void unmap(ctkDICOMSeriesLoaderFile& file);
+
+private:
+  QVector<ctkDICOMSeriesLoaderFile>& Files;
+  int Begin;
+  int End;
+};
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoaderTask::run()
+{
+  for (int i = this->Begin; i < this->End; ++i)
+    {
+    parse(this->Files[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoaderTask::parse(ctkDICOMSeriesLoaderFile& file)
+{
+  DcmFileFormat fileformat;
+  if (!loadHeader(fileformat, file.Filename).good())
+    {
+    file.Error = "Could not read " + file.Filename;
+    return;
+    }
+  DcmDataset* dataset = fileformat.getDataset();
+  const E_TransferSyntax syntax = dataset->getOriginalXfer();
+  if (syntax != EXS_LittleEndianExplicit && syntax != EXS_LittleEndianImplicit)
+    {
+    file.Error = "Compressed or big endian pixel data in " + file.Filename;
+    return;
+    }
+  file.Rows = readUint16(dataset, DCM_Rows, 0);
+  file.Columns = readUint16(dataset, DCM_Columns, 0);
+  file.SamplesPerPixel = readUint16(dataset, DCM_SamplesPerPixel, 1);
+  file.BitsAllocated = readUint16(dataset, DCM_BitsAllocated, 0);
+  file.PixelRepresentation = readUint16(dataset, DCM_PixelRepresentation, 0);
+  Sint32 frames = 1;
+  if (dataset->findAndGetSint32(DCM_NumberOfFrames, frames).good() && frames > 0)
+    {
+    file.Frames = frames;
+    }
+  if (file.Rows == 0 || file.Columns == 0 ||
+      (file.BitsAllocated != 8 && file.BitsAllocated != 16 && file.BitsAllocated != 32))
+    {
+    file.Error = "No supported pixel data in " + file.Filename;
+    return;
+    }
+  file.HasGeometry = readFloat64(dataset, DCM_ImagePositionPatient, file.Position, 3) &&
+    readFloat64(dataset, DCM_ImageOrientationPatient, file.Orientation, 6);
+  readFloat64(dataset, DCM_PixelSpacing, file.PixelSpacing, 2);
+  if (!readFloat64(dataset, DCM_SpacingBetweenSlices, &file.FrameSpacing, 1))
+    {
+    readFloat64(dataset, DCM_SliceThickness, &file.FrameSpacing, 1);
+    }
+  readFloat64(dataset, DCM_RescaleSlope, &file.Slope, 1);
+  readFloat64(dataset, DCM_RescaleIntercept, &file.Intercept, 1);
+
+  map(file, syntax == EXS_LittleEndianExplicit);
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoaderTask::map(ctkDICOMSeriesLoaderFile& file, bool explicitVR)
+{
+  const qint64 length = qint64(file.Rows) * file.Columns * file.SamplesPerPixel *
+    (file.BitsAllocated / 8) * file.Frames;
+#ifdef Q_OS_UNIX
+  const QByteArray fileName = QFile::encodeName(file.Filename);
+  int fd = ::open(fileName.constData(), O_RDONLY);
+  struct stat status;
+  if (fd < 0 || ::fstat(fd, &status) != 0 || status.st_size == 0)
+    {
+    if (fd >= 0)
+      {
+      ::close(fd);
+      }
+    file.Error = "Could not open " + file.Filename;
+    return;
+    }
+  void* address = ::mmap(0, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  // the mapping outlives the descriptor, a series may have more files than
+  // a process can keep open
+  ::close(fd);
+  if (address == MAP_FAILED)
+    {
+    file.Error = "Could not map " + file.Filename;
+    return;
+    }
+  file.Address = static_cast<uchar*>(address);
+  file.MappedSize = status.st_size;
+#else
+  file.File = new QFile(file.Filename);
+  if (file.File->open(QIODevice::ReadOnly))
+    {
+    file.MappedSize = file.File->size();
+    file.Address = file.File->map(0, file.MappedSize);
+    }
+  if (!file.Address)
+    {
+    file.Error = "Could not map " + file.Filename;
+    unmap(file);
+    return;
+    }
+#endif
+  const qint64 offset = pixelDataOffset(file.Address, file.MappedSize, length, explicitVR);
+  if (offset < 0)
+    {
+    file.Error = "Pixel data not found in " + file.Filename;
+    unmap(file);
+    return;
+    }
+  file.Data = file.Address + offset;
+#if defined(Q_OS_UNIX) && defined(MADV_WILLNEED)
+  // start reading the pixels now, the pages of the whole series are read
+  // in parallel by the kernel instead of one page fault at a time
+  ::madvise(file.Address, file.MappedSize, MADV_WILLNEED);
+#endif
+  file.Valid = true;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoaderTask::unmap(ctkDICOMSeriesLoaderFile& file)
+{
+#ifdef Q_OS_UNIX
+  if (file.Address)
+    {
+    ::munmap(file.Address, file.MappedSize);
+    }
+#else
+  delete file.File;
+  file.File = 0;
+#endif
+  file.Address = 0;
+  file.Data = 0;
+  file.Valid = false;
+}
+
+//------------------------------------------------------------------------------
+class ctkDICOMSeriesLoaderPrivate: public ctkPrivate<ctkDICOMSeriesLoader>
+{
+public:
+  ctkDICOMSeriesLoaderPrivate();
+  /// Check that the files have the same format and sort them
+  bool sort();
+
+  QSqlDatabase Database;
+  int          NumberOfThreads;
+  QString      LastError;
+
+  QVector<ctkDICOMSeriesLoaderFile> Files;
+  /// Pixel data and file of each slice, sorted
+  QVector<const uchar*> Slices;
+  QVector<int>          SliceFiles;
+  bool                  Contiguous;
+  double Origin[3];
+  double Spacing[3];
+  double Directions[9];
+};
+
+//------------------------------------------------------------------------------
+// ctkDICOMSeriesLoaderPrivate methods
+
+//------------------------------------------------------------------------------
+ctkDICOMSeriesLoaderPrivate::ctkDICOMSeriesLoaderPrivate()
+{
+  this->NumberOfThreads = QThread::idealThreadCount();
+  this->Contiguous = false;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSeriesLoaderPrivate::sort()
+{
+  const ctkDICOMSeriesLoaderFile& first = this->Files[0];
+  QVector<ctkDICOMSeriesLoaderFile*> files;
+  bool geometry = true;
+  for (int i = 0; i < this->Files.size(); ++i)
+    {
+    ctkDICOMSeriesLoaderFile& file = this->Files[i];
+    if (file.Rows != first.Rows || file.Columns != first.Columns ||
+        file.SamplesPerPixel != first.SamplesPerPixel ||
+        file.BitsAllocated != first.BitsAllocated ||
+        file.PixelRepresentation != first.PixelRepresentation)
+      {
+      this->LastError = "Different image formats in " + first.Filename + " and " + file.Filename;
+      return false;
+      }
+    geometry = geometry && file.HasGeometry;
+    files << &file;
+    }
+
+  // row, column and normal directions
+  double* d = this->Directions;
+  std::memcpy(d, first.Orientation, 6 * sizeof(double));
+  d[6] = d[1] * d[5] - d[2] * d[4];
+  d[7] = d[2] * d[3] - d[0] * d[5];
+  d[8] = d[0] * d[4] - d[1] * d[3];
+  if (geometry)
+    {
+    foreach(ctkDICOMSeriesLoaderFile* file, files)
+      {
+      file->Distance = file->Position[0] * d[6] + file->Position[1] * d[7] +
+        file->Position[2] * d[8];
+      }
+    std::stable_sort(files.begin(), files.end(), distanceLessThan);
+    }
+
+  this->Spacing[0] = first.PixelSpacing[1];
+  this->Spacing[1] = first.PixelSpacing[0];
+  this->Spacing[2] = first.FrameSpacing > 0. ? first.FrameSpacing : 1.;
+  if (geometry && files.size() > 1)
+    {
+    const double distance = (files.last()->Distance - files.first()->Distance) /
+      (files.size() - 1);
+    if (distance > 0.)
+      {
+      this->Spacing[2] = distance;
+      }
+    else
+      {
+      logger.warn ( "Files of the series at the same position: " + first.Filename );
+      }
+    }
+  std::memcpy(this->Origin, files.first()->Position, 3 * sizeof(double));
+
+  const qint64 sliceSize = qint64(first.Rows) * first.Columns * first.SamplesPerPixel *
+    (first.BitsAllocated / 8);
+  foreach(ctkDICOMSeriesLoaderFile* file, files)
+    {
+    for (int frame = 0; frame < file->Frames; ++frame)
+      {
+      this->Slices << file->Data + frame * sliceSize;
+      this->SliceFiles << static_cast<int>(file - this->Files.data());
+      }
+    }
+  this->Contiguous = true;
+  for (int k = 1; k < this->Slices.size() && this->Contiguous; ++k)
+    {
+    this->Contiguous = this->Slices[k] == this->Slices[k - 1] + sliceSize;
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMSeriesLoader methods
+
+//------------------------------------------------------------------------------
+ctkDICOMSeriesLoader::ctkDICOMSeriesLoader(QSqlDatabase database)
+{
+  CTK_INIT_PRIVATE(ctkDICOMSeriesLoader);
+  CTK_D(ctkDICOMSeriesLoader);
+  d->Database = database;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMSeriesLoader::~ctkDICOMSeriesLoader()
+{
+  this->clear();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoader::setDatabase(QSqlDatabase database)
+{
+  CTK_D(ctkDICOMSeriesLoader);
+  d->Database = database;
+}
+
+//------------------------------------------------------------------------------
+QSqlDatabase ctkDICOMSeriesLoader::database()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return d->Database;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoader::setNumberOfThreads(int threads)
+{
+  CTK_D(ctkDICOMSeriesLoader);
+  d->NumberOfThreads = qMax(threads, 1);
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSeriesLoader::numberOfThreads()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return d->NumberOfThreads;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSeriesLoader::load(const QString& seriesInstanceUID)
+{
+  CTK_D(ctkDICOMSeriesLoader);
+  QSqlQuery query(d->Database);
+  query.setForwardOnly(true);
+  query.prepare("SELECT Filename FROM Images WHERE SeriesInstanceUID = ? ORDER BY Filename");
+  query.bindValue(0, seriesInstanceUID);
+  if (!query.exec())
+    {
+    this->clear();
+    d->LastError = query.lastError().text();
+    logger.error ( "Error listing the files of " + seriesInstanceUID + ": " + d->LastError );
+    return false;
+    }
+  QStringList files;
+  while (query.next())
+    {
+    files << query.value(0).toString();
+    }
+  if (files.isEmpty())
+    {
+    this->clear();
+    d->LastError = "No file in series " + seriesInstanceUID;
+    logger.error ( d->LastError );
+    return false;
+    }
+  return this->loadFiles(files);
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSeriesLoader::loadFiles(const QStringList& files)
+{
+  CTK_D(ctkDICOMSeriesLoader);
+  this->clear();
+  if (files.isEmpty())
+    {
+    d->LastError = "No file to load";
+    return false;
+    }
+  QTime time;
+  time.start();
+
+  d->Files.resize(files.size());
+  for (int i = 0; i < files.size(); ++i)
+    {
+    d->Files[i].Filename = files[i];
+    }
+  // a few tasks per thread so that slow files don't leave threads idle
+  QThreadPool pool;
+  pool.setMaxThreadCount(d->NumberOfThreads);
+  const int tasks = qMin(files.size(), d->NumberOfThreads * 4);
+  for (int task = 0; task < tasks; ++task)
+    {
+    pool.start(new ctkDICOMSeriesLoaderTask(d->Files,
+      task * files.size() / tasks, (task + 1) * files.size() / tasks));
+    }
+  pool.waitForDone();
+
+  foreach(const ctkDICOMSeriesLoaderFile& file, d->Files)
+    {
+    if (!file.Valid)
+      {
+      const QString error = file.Error;
+      this->clear();
+      d->LastError = error;
+      logger.error ( error );
+      return false;
+      }
+    }
+  if (!d->sort())
+    {
+    const QString error = d->LastError;
+    this->clear();
+    d->LastError = error;
+    logger.error ( error );
+    return false;
+    }
+  logger.info ( QString("%1 slices of %2 files mapped in %3 ms")
+                .arg(d->Slices.size()).arg(files.size()).arg(time.elapsed()) );
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoader::clear()
+{
+  CTK_D(ctkDICOMSeriesLoader);
+  for (int i = 0; i < d->Files.size(); ++i)
+    {
+    ctkDICOMSeriesLoaderTask::unmap(d->Files[i]);
+    }
+  d->Files.clear();
+  d->Slices.clear();
+  d->SliceFiles.clear();
+  d->Contiguous = false;
+  d->LastError.clear();
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMSeriesLoader::lastError()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return d->LastError;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSeriesLoader::isLoaded()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return !d->Slices.isEmpty();
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSeriesLoader::columns()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return this->isLoaded() ? d->Files[0].Columns : 0;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSeriesLoader::rows()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return this->isLoaded() ? d->Files[0].Rows : 0;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSeriesLoader::slices()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return d->Slices.size();
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSeriesLoader::samplesPerPixel()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return this->isLoaded() ? d->Files[0].SamplesPerPixel : 0;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSeriesLoader::bitsAllocated()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return this->isLoaded() ? d->Files[0].BitsAllocated : 0;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSeriesLoader::isSigned()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return this->isLoaded() && d->Files[0].PixelRepresentation == 1;
+}
+
+//------------------------------------------------------------------------------
+double ctkDICOMSeriesLoader::rescaleSlope()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return this->isLoaded() ? d->Files[0].Slope : 1.;
+}
+
+//------------------------------------------------------------------------------
+double ctkDICOMSeriesLoader::rescaleIntercept()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return this->isLoaded() ? d->Files[0].Intercept : 0.;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoader::origin(double origin[3])const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  std::memcpy(origin, d->Origin, 3 * sizeof(double));
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoader::spacing(double spacing[3])const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  std::memcpy(spacing, d->Spacing, 3 * sizeof(double));
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoader::orientation(double directions[9])const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  std::memcpy(directions, d->Directions, 9 * sizeof(double));
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSeriesLoader::pixelStride()const
+{
+  return this->samplesPerPixel() * this->bitsAllocated() / 8;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSeriesLoader::rowStride()const
+{
+  return this->columns() * this->pixelStride();
+}
+
+//------------------------------------------------------------------------------
+qint64 ctkDICOMSeriesLoader::sliceSize()const
+{
+  return qint64(this->rows()) * this->rowStride();
+}
+
+//------------------------------------------------------------------------------
+const uchar* ctkDICOMSeriesLoader::slice(int k)const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return k >= 0 && k < d->Slices.size() ? d->Slices[k] : 0;
+}
+
+//------------------------------------------------------------------------------
+const uchar* ctkDICOMSeriesLoader::voxel(int i, int j, int k)const
+{
+  const uchar* slice = this->slice(k);
+  return slice ? slice + j * this->rowStride() + i * this->pixelStride() : 0;
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMSeriesLoader::filename(int k)const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return k >= 0 && k < d->SliceFiles.size() ? d->Files[d->SliceFiles[k]].Filename : QString();
+}
+
+//------------------------------------------------------------------------------
+const uchar* ctkDICOMSeriesLoader::data()const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  return d->Contiguous ? d->Slices[0] : 0;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSeriesLoader::copyTo(uchar* buffer)const
+{
+  CTK_D(const ctkDICOMSeriesLoader);
+  const qint64 size = this->sliceSize();
+  for (int k = 0; k < d->Slices.size(); ++k)
+    {
+    std::memcpy(buffer + k * size, d->Slices[k], size);
+    }
+}
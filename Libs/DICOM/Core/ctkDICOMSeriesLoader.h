@@ -0,0 +1,127 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMSeriesLoader_h
+#define __ctkDICOMSeriesLoader_h
+
+// Qt includes
+#include <QSqlDatabase>
+#include <QStringList>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMCoreExport.h"
+
+class ctkDICOMSeriesLoaderPrivate;
+
+///
+/// Pixels of an indexed series, read without copy from the stored files.
+/// load() parses the headers of the files of the series in parallel, sorts
+/// them by position along the slice normal and memory maps their pixel
+/// data. The frames of a multi-frame file are consecutive slices.
+/// The volume is then a view on the mapped files: voxel (i, j, k) starts at
+/// slice(k) + j * rowStride() + i * pixelStride(). It stays valid until the
+/// next load(), clear() or the destruction of the loader.
+/// Only uncompressed little endian transfer syntaxes are supported; all the
+/// files must have the same rows, columns and pixel format.
+/// See ctkDICOMSeriesLoaderVTK.h to use the volume as a vtkImageData.
+class CTK_DICOM_CORE_EXPORT ctkDICOMSeriesLoader
+{
+public:
+  explicit ctkDICOMSeriesLoader(QSqlDatabase database = QSqlDatabase());
+  virtual ~ctkDICOMSeriesLoader();
+
+  void setDatabase(QSqlDatabase database);
+  QSqlDatabase database()const;
+
+  ///
+  /// Number of threads parsing the headers.
+  /// Default is QThread::idealThreadCount().
+  void setNumberOfThreads(int threads);
+  int numberOfThreads()const;
+
+  ///
+  /// Load the files of the series listed in the Images table of the
+  /// database. Return false and set lastError() if a file can't be used.
+  bool load(const QString& seriesInstanceUID);
+  ///
+  /// Load files of one series that are not indexed
+  bool loadFiles(const QStringList& files);
+  ///
+  /// Unmap the files
+  void clear();
+
+  QString lastError()const;
+  bool isLoaded()const;
+
+  int columns()const;
+  int rows()const;
+  int slices()const;
+  int samplesPerPixel()const;
+  /// 8, 16 or 32
+  int bitsAllocated()const;
+  bool isSigned()const;
+  /// Modality LUT, 1 and 0 if the files don't have one
+  double rescaleSlope()const;
+  double rescaleIntercept()const;
+
+  ///
+  /// Patient position of the first voxel of the first slice
+  void origin(double origin[3])const;
+  ///
+  /// Distance between the columns, the rows and the slices. The slice
+  /// spacing is the mean distance between the positions of the files.
+  void spacing(double spacing[3])const;
+  ///
+  /// Row direction, column direction and slice normal
+  void orientation(double directions[9])const;
+
+  ///
+  /// Bytes between consecutive pixels of a row
+  int pixelStride()const;
+  ///
+  /// Bytes between consecutive rows of a slice
+  int rowStride()const;
+  ///
+  /// Bytes of a slice
+  qint64 sliceSize()const;
+
+  ///
+  /// First byte of the k-th slice, in mapped memory
+  const uchar* slice(int k)const;
+  const uchar* voxel(int i, int j, int k)const;
+  ///
+  /// File of the k-th slice
+  QString filename(int k)const;
+
+  ///
+  /// The whole volume if its slices are consecutive in memory, as with a
+  /// single multi-frame file, 0 otherwise
+  const uchar* data()const;
+  ///
+  /// Copy the slices in @param buffer of slices() * sliceSize() bytes
+  void copyTo(uchar* buffer)const;
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMSeriesLoader);
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMSeriesLoaderVTK_h
+#define __ctkDICOMSeriesLoaderVTK_h
+
+/// Header only: CTKDICOMCore doesn't depend on VTK, applications linking
+/// with VTK include this file to hand a loaded series over to VTK.
+
+// CTK includes
+#include "ctkDICOMSeriesLoader.h"
+
+// VTK includes
+#include <vtkDataArray.h>
+#include <vtkImageData.h>
+#include <vtkPointData.h>
+#include <vtkType.h>
+
+///
+/// Set the dimensions, spacing, origin and scalars of @param imageData to
+/// the volume of @param loader. If the volume is contiguous in memory, the
+/// scalars point to the mapped file without copy and the loader must
+/// outlive imageData; the slices are copied otherwise.
+/// The orientation is not kept: vtkImageData is axis aligned.
+/// Return false if nothing is loaded.
+inline bool ctkDICOMSeriesLoaderToImageData(const ctkDICOMSeriesLoader& loader,
+                                            vtkImageData* imageData)
+{
+  if (!loader.isLoaded() || !imageData)
+    {
+    return false;
+    }
+  int scalarType = VTK_UNSIGNED_SHORT;
+  switch (loader.bitsAllocated())
+    {
+    case 8:
+      scalarType = loader.isSigned() ? VTK_SIGNED_CHAR : VTK_UNSIGNED_CHAR;
+      break;
+    case 16:
+      scalarType = loader.isSigned() ? VTK_SHORT : VTK_UNSIGNED_SHORT;
+      break;
+    case 32:
+      scalarType = loader.isSigned() ? VTK_INT : VTK_UNSIGNED_INT;
+      break;
+    }
+  double origin[3];
+  double spacing[3];
+  loader.origin(origin);
+  loader.spacing(spacing);
+  imageData->SetDimensions(loader.columns(), loader.rows(), loader.slices());
+  imageData->SetOrigin(origin);
+  imageData->SetSpacing(spacing);
+  imageData->SetScalarType(scalarType);
+  imageData->SetNumberOfScalarComponents(loader.samplesPerPixel());
+
+  vtkDataArray* scalars = vtkDataArray::CreateDataArray(scalarType);
+  scalars->SetNumberOfComponents(loader.samplesPerPixel());
+  const vtkIdType tuples = static_cast<vtkIdType>(loader.columns()) *
+    loader.rows() * loader.slices();
+  if (loader.data())
+    {
+    // save = 1: the array doesn't free the mapped memory
+    scalars->SetVoidArray(const_cast<uchar*>(loader.data()),
+                          tuples * loader.samplesPerPixel(), 1);
+    }
+  else
+    {
+    scalars->SetNumberOfTuples(tuples);
+    loader.copyTo(static_cast<uchar*>(scalars->GetVoidPointer(0)));
+    }
+  imageData->GetPointData()->SetScalars(scalars);
+  scalars->Delete();
+  return true;
+}
+
+#endif
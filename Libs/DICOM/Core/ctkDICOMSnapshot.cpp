@@ -0,0 +1,781 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QFile>
+#include <QHash>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QSqlRecord>
+#include <QVector>
+
+// ctkDICOM includes
+#include "ctkDICOMSnapshot.h"
+#include "ctkLogger.h"
+
+// STD includes
+#include <cstring>
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMSnapshot" );
+
+static const char    SnapshotMagic[8] = {'C', 'T', 'K', 'D', 'S', 'N', 'A', 'P'};
+static const quint32 SnapshotVersion = 1;
+/// Read back as another value on a machine with another byte order
+static const quint32 SnapshotByteOrder = 0x01020304;
+
+//------------------------------------------------------------------------------
+/// First bytes of the file. The offsets are from the start of the file and
+/// multiple of 8, so that the arrays are aligned in the mapped memory.
+struct ctkDICOMSnapshotHeader
+{
+  char    Magic[8];
+  quint32 Version;
+  quint32 ByteOrder;
+  quint32 TableCount;
+  /// Strings of the dictionary, NULL included
+  quint32 StringCount;
+  /// TableCount ctkDICOMSnapshotTable
+  quint64 TablesOffset;
+  /// StringCount + 1 offsets in the string data, string i is the UTF-8
+  /// bytes between offsets i and i + 1
+  quint64 StringOffsetsOffset;
+  quint64 StringDataOffset;
+  quint64 StringDataSize;
+  quint64 FileSize;
+};
+
+//------------------------------------------------------------------------------
+struct ctkDICOMSnapshotTable
+{
+  /// Name in the dictionary
+  quint32 NameId;
+  quint32 ColumnCount;
+  quint64 RowCount;
+  /// ColumnCount ctkDICOMSnapshotColumn
+  quint64 ColumnsOffset;
+};
+
+//------------------------------------------------------------------------------
+struct ctkDICOMSnapshotColumn
+{
+  quint32 NameId;
+  /// ctkDICOMSnapshot::ColumnType
+  quint32 Type;
+  /// RowCount values
+  quint64 DataOffset;
+  /// Bitmap of the NULL rows, 0 if the column has no NULL or has strings
+  quint64 NullsOffset;
+};
+
+//------------------------------------------------------------------------------
+/// Append the sections of a snapshot to a file and build its dictionary
+class ctkDICOMSnapshotWriter
+{
+public:
+  ctkDICOMSnapshotWriter(QFile& file);
+
+  quint32 stringId(const QString& value);
+  /// Write @param size bytes at the end of the file, aligned on 8 bytes.
+  /// Return their offset, 0 if the write failed.
+  quint64 append(const void* data, qint64 size);
+  /// Read the values of a column and append them
+  bool appendColumn(QSqlDatabase& database, const QString& table,
+                    ctkDICOMSnapshotColumn& column, quint64 rowCount,
+                    QString& error);
+
+  QFile&                  File;
+  QHash<QString, quint32> Ids;
+  QVector<quint64>        Offsets;
+  QByteArray              Strings;
+};
+
+//------------------------------------------------------------------------------
+class ctkDICOMSnapshotPrivate: public ctkPrivate<ctkDICOMSnapshot>
+{
+public:
+  ctkDICOMSnapshotPrivate();
+
+  /// Check that the sections described by the header are in the file
+  bool checkLayout();
+  bool contains(quint64 offset, quint64 size)const;
+  const ctkDICOMSnapshotTable* tableAt(int table)const;
+  const ctkDICOMSnapshotColumn* columnAt(int table, int column)const;
+  const uchar* columnData(int table, int column, ctkDICOMSnapshot::ColumnType type)const;
+
+  QFile                         File;
+  const uchar*                  Data;
+  quint64                       Size;
+  const ctkDICOMSnapshotHeader* Header;
+  QString                       LastError;
+};
+
+namespace
+{
+//------------------------------------------------------------------------------
+/// Type of the values of a column declared with @param declaredType,
+/// following the affinity rules of SQLite. Dates and columns without
+/// affinity are kept as strings.
+ctkDICOMSnapshot::ColumnType affinity(const QString& declaredType)
+{
+  const QString type = declaredType.toUpper();
+  if (type.contains("INT"))
+    {
+    return ctkDICOMSnapshot::IntegerColumn;
+    }
+  if (type.contains("REAL") || type.contains("FLOA") || type.contains("DOUB"))
+    {
+    return ctkDICOMSnapshot::RealColumn;
+    }
+  return ctkDICOMSnapshot::StringColumn;
+}
+
+//------------------------------------------------------------------------------
+QString quoted(const QString& identifier)
+{
+  return "\"" + QString(identifier).replace("\"", "\"\"") + "\"";
+}
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMSnapshotWriter methods
+
+//------------------------------------------------------------------------------
+ctkDICOMSnapshotWriter::ctkDICOMSnapshotWriter(QFile& file)
+  : File(file)
+{
+  // id 0 is NULL, an empty string distinct from ''
+  this->Offsets << 0 << 0;
+}
+
+//------------------------------------------------------------------------------
+quint32 ctkDICOMSnapshotWriter::stringId(const QString& value)
+{
+  QHash<QString, quint32>::const_iterator it = this->Ids.find(value);
+  if (it != this->Ids.end())
+    {
+    return it.value();
+    }
+  const quint32 id = static_cast<quint32>(this->Offsets.size() - 1);
+  this->Strings += value.toUtf8();
+  this->Offsets << static_cast<quint64>(this->Strings.size());
+  this->Ids.insert(value, id);
+  return id;
+}
+
+//------------------------------------------------------------------------------
+quint64 ctkDICOMSnapshotWriter::append(const void* data, qint64 size)
+{
+  const qint64 offset = (this->File.size() + 7) / 8 * 8;
+  if (!this->File.seek(offset) ||
+      this->File.write(static_cast<const char*>(data), size) != size)
+    {
+    return 0;
+    }
+  return static_cast<quint64>(offset);
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSnapshotWriter::appendColumn(QSqlDatabase& database, const QString& table,
+                                          ctkDICOMSnapshotColumn& column,
+                                          quint64 rowCount, QString& error)
+{
+  const QString name = QString::fromUtf8(
+    this->Strings.constData() + this->Offsets[column.NameId],
+    static_cast<int>(this->Offsets[column.NameId + 1] - this->Offsets[column.NameId]));
+  // one column at a time: only one column of values is in memory
+  QSqlQuery query(database);
+  query.setForwardOnly(true);
+  if (!query.exec("SELECT " + quoted(name) + " FROM " + quoted(table) + " ORDER BY rowid"))
+    {
+    error = query.lastError().text();
+    return false;
+    }
+  const int rows = static_cast<int>(rowCount);
+  QVector<qint64>  integers;
+  QVector<double>  reals;
+  QVector<quint32> ids;
+  QByteArray       nulls;
+  bool             hasNull = false;
+  switch (column.Type)
+    {
+    case ctkDICOMSnapshot::IntegerColumn: integers.fill(0, rows); break;
+    case ctkDICOMSnapshot::RealColumn: reals.fill(0., rows); break;
+    default: ids.fill(0, rows); break;
+    }
+  if (column.Type != ctkDICOMSnapshot::StringColumn)
+    {
+    nulls.fill(0, (rows + 7) / 8);
+    }
+
+  int row = 0;
+  for (; query.next(); ++row)
+    {
+    if (row >= rows)
+      {
+      break;
+      }
+    const QVariant value = query.value(0);
+    if (column.Type == ctkDICOMSnapshot::StringColumn)
+      {
+      ids[row] = value.isNull() ? 0 : this->stringId(value.toString());
+      }
+    else if (value.isNull())
+      {
+      hasNull = true;
+      nulls[row / 8] = static_cast<char>(nulls[row / 8] | (1 << (row % 8)));
+      }
+    else if (column.Type == ctkDICOMSnapshot::IntegerColumn)
+      {
+      integers[row] = value.toLongLong();
+      }
+    else
+      {
+      reals[row] = value.toDouble();
+      }
+    }
+  if (row != rows)
+    {
+    error = "the rows of " + table + " changed during the export";
+    return false;
+    }
+
+  switch (column.Type)
+    {
+    case ctkDICOMSnapshot::IntegerColumn:
+      column.DataOffset = this->append(integers.constData(), qint64(rows) * sizeof(qint64));
+      break;
+    case ctkDICOMSnapshot::RealColumn:
+      column.DataOffset = this->append(reals.constData(), qint64(rows) * sizeof(double));
+      break;
+    default:
+      column.DataOffset = this->append(ids.constData(), qint64(rows) * sizeof(quint32));
+      break;
+    }
+  column.NullsOffset = hasNull ? this->append(nulls.constData(), nulls.size()) : 0;
+  if (column.DataOffset == 0 || (hasNull && column.NullsOffset == 0))
+    {
+    error = this->File.errorString();
+    return false;
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMSnapshotPrivate methods
+
+//------------------------------------------------------------------------------
+ctkDICOMSnapshotPrivate::ctkDICOMSnapshotPrivate()
+{
+  this->Data = 0;
+  this->Size = 0;
+  this->Header = 0;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSnapshotPrivate::contains(quint64 offset, quint64 size)const
+{
+  return offset <= this->Size && size <= this->Size - offset;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSnapshotPrivate::checkLayout()
+{
+  // the per row data is not read: opening doesn't depend on the row count
+  const ctkDICOMSnapshotHeader* header =
+    reinterpret_cast<const ctkDICOMSnapshotHeader*>(this->Data);
+  if (this->Size < sizeof(ctkDICOMSnapshotHeader) ||
+      std::memcmp(header->Magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0)
+    {
+    this->LastError = "not a DICOM snapshot";
+    return false;
+    }
+  if (header->ByteOrder != SnapshotByteOrder || header->Version != SnapshotVersion)
+    {
+    this->LastError = "unsupported snapshot version or byte order";
+    return false;
+    }
+  if (header->FileSize != this->Size ||
+      header->TablesOffset % 8 || header->StringOffsetsOffset % 8 ||
+      !this->contains(header->TablesOffset,
+                      quint64(header->TableCount) * sizeof(ctkDICOMSnapshotTable)) ||
+      !this->contains(header->StringOffsetsOffset,
+                      (quint64(header->StringCount) + 1) * sizeof(quint64)) ||
+      !this->contains(header->StringDataOffset, header->StringDataSize))
+    {
+    this->LastError = "truncated snapshot";
+    return false;
+    }
+  this->Header = header;
+  for (quint32 t = 0; t < header->TableCount; ++t)
+    {
+    const ctkDICOMSnapshotTable* table = this->tableAt(t);
+    if (table->NameId >= header->StringCount || table->ColumnsOffset % 8 ||
+        table->RowCount > this->Size ||
+        !this->contains(table->ColumnsOffset,
+                        quint64(table->ColumnCount) * sizeof(ctkDICOMSnapshotColumn)))
+      {
+      this->LastError = "corrupted table";
+      this->Header = 0;
+      return false;
+      }
+    for (quint32 c = 0; c < table->ColumnCount; ++c)
+      {
+      const ctkDICOMSnapshotColumn* column = this->columnAt(t, c);
+      quint64 valueSize = sizeof(quint32);
+      if (column->Type == ctkDICOMSnapshot::IntegerColumn)
+        {
+        valueSize = sizeof(qint64);
+        }
+      else if (column->Type == ctkDICOMSnapshot::RealColumn)
+        {
+        valueSize = sizeof(double);
+        }
+      else if (column->Type != ctkDICOMSnapshot::StringColumn)
+        {
+        valueSize = 0;
+        }
+      if (valueSize == 0 || column->NameId >= header->StringCount ||
+          column->DataOffset % 8 ||
+          !this->contains(column->DataOffset, table->RowCount * valueSize) ||
+          (column->NullsOffset &&
+           !this->contains(column->NullsOffset, (table->RowCount + 7) / 8)))
+        {
+        this->LastError = "corrupted column";
+        this->Header = 0;
+        return false;
+        }
+      }
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+const ctkDICOMSnapshotTable* ctkDICOMSnapshotPrivate::tableAt(int table)const
+{
+  if (!this->Header || table < 0 || table >= static_cast<int>(this->Header->TableCount))
+    {
+    return 0;
+    }
+  return reinterpret_cast<const ctkDICOMSnapshotTable*>(
+    this->Data + this->Header->TablesOffset) + table;
+}
+
+//------------------------------------------------------------------------------
+const ctkDICOMSnapshotColumn* ctkDICOMSnapshotPrivate::columnAt(int table, int column)const
+{
+  const ctkDICOMSnapshotTable* t = this->tableAt(table);
+  if (!t || column < 0 || column >= static_cast<int>(t->ColumnCount))
+    {
+    return 0;
+    }
+  return reinterpret_cast<const ctkDICOMSnapshotColumn*>(
+    this->Data + t->ColumnsOffset) + column;
+}
+
+//------------------------------------------------------------------------------
+const uchar* ctkDICOMSnapshotPrivate::columnData(int table, int column,
+                                                 ctkDICOMSnapshot::ColumnType type)const
+{
+  const ctkDICOMSnapshotColumn* c = this->columnAt(table, column);
+  return c && c->Type == static_cast<quint32>(type) ? this->Data + c->DataOffset : 0;
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMSnapshot methods
+
+//------------------------------------------------------------------------------
+ctkDICOMSnapshot::ctkDICOMSnapshot()
+{
+  CTK_INIT_PRIVATE(ctkDICOMSnapshot);
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMSnapshot::~ctkDICOMSnapshot()
+{
+  this->close();
+}
+
+//------------------------------------------------------------------------------
+QStringList ctkDICOMSnapshot::defaultTables()
+{
+  return QStringList() << "Patients" << "Studies" << "Series" << "Images";
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSnapshot::write(QSqlDatabase database, const QString& fileName,
+                             const QStringList& tables, QString* error)
+{
+  QString message;
+  QFile file(fileName);
+  if (!file.open(QIODevice::ReadWrite | QIODevice::Truncate))
+    {
+    message = file.errorString();
+    }
+  ctkDICOMSnapshotWriter writer(file);
+  ctkDICOMSnapshotHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.Magic, SnapshotMagic, sizeof(SnapshotMagic));
+  header.Version = SnapshotVersion;
+  header.ByteOrder = SnapshotByteOrder;
+  // the header is written again once the offsets are known
+  if (message.isEmpty() &&
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header)) != sizeof(header))
+    {
+    message = file.errorString();
+    }
+
+  // a read transaction: the columns of all the tables are consistent
+  const bool transaction = message.isEmpty() && database.transaction();
+  QVector<ctkDICOMSnapshotTable> tableDescriptors;
+  QList<QVector<ctkDICOMSnapshotColumn> > columnDescriptors;
+  foreach(const QString& name, tables)
+    {
+    if (!message.isEmpty())
+      {
+      break;
+      }
+    QSqlQuery query(database);
+    QVector<ctkDICOMSnapshotColumn> columns;
+    if (!query.exec("PRAGMA table_info(" + quoted(name) + ")"))
+      {
+      message = query.lastError().text();
+      break;
+      }
+    while (query.next())
+      {
+      ctkDICOMSnapshotColumn column;
+      column.NameId = writer.stringId(query.value(1).toString());
+      column.Type = affinity(query.value(2).toString());
+      column.DataOffset = 0;
+      column.NullsOffset = 0;
+      columns << column;
+      }
+    if (columns.isEmpty() ||
+        !query.exec("SELECT COUNT(*) FROM " + quoted(name)) || !query.next())
+      {
+      message = "no table " + name;
+      break;
+      }
+    ctkDICOMSnapshotTable table;
+    table.NameId = writer.stringId(name);
+    table.ColumnCount = static_cast<quint32>(columns.size());
+    table.RowCount = query.value(0).toULongLong();
+    table.ColumnsOffset = 0;
+    for (int c = 0; c < columns.size() && message.isEmpty(); ++c)
+      {
+      writer.appendColumn(database, name, columns[c], table.RowCount, message);
+      }
+    tableDescriptors << table;
+    columnDescriptors << columns;
+    }
+  if (transaction)
+    {
+    database.rollback();
+    }
+
+  for (int t = 0; t < tableDescriptors.size() && message.isEmpty(); ++t)
+    {
+    const QVector<ctkDICOMSnapshotColumn>& columns = columnDescriptors[t];
+    tableDescriptors[t].ColumnsOffset =
+      writer.append(columns.constData(), qint64(columns.size()) * sizeof(ctkDICOMSnapshotColumn));
+    if (tableDescriptors[t].ColumnsOffset == 0)
+      {
+      message = file.errorString();
+      }
+    }
+  if (message.isEmpty())
+    {
+    header.TableCount = static_cast<quint32>(tableDescriptors.size());
+    header.StringCount = static_cast<quint32>(writer.Offsets.size() - 1);
+    header.TablesOffset = writer.append(tableDescriptors.constData(),
+      qint64(tableDescriptors.size()) * sizeof(ctkDICOMSnapshotTable));
+    header.StringOffsetsOffset = writer.append(writer.Offsets.constData(),
+      qint64(writer.Offsets.size()) * sizeof(quint64));
+    header.StringDataSize = static_cast<quint64>(writer.Strings.size());
+    // an empty dictionary is at the end of the file
+    header.StringDataOffset = writer.Strings.isEmpty() ?
+      static_cast<quint64>(file.size()) :
+      writer.append(writer.Strings.constData(), writer.Strings.size());
+    header.FileSize = static_cast<quint64>(file.size());
+    if (header.TablesOffset == 0 || header.StringOffsetsOffset == 0 ||
+        header.StringDataOffset == 0 || !file.seek(0) ||
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header)) != sizeof(header))
+      {
+      message = file.errorString();
+      }
+    }
+  file.close();
+
+  if (!message.isEmpty())
+    {
+    logger.error("Could not write the snapshot " + fileName + ": " + message);
+    file.remove();
+    if (error)
+      {
+      *error = message;
+      }
+    return false;
+    }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSnapshot::open(const QString& fileName)
+{
+  CTK_D(ctkDICOMSnapshot);
+  this->close();
+  d->File.setFileName(fileName);
+  if (!d->File.open(QIODevice::ReadOnly))
+    {
+    d->LastError = d->File.errorString();
+    return false;
+    }
+  d->Size = static_cast<quint64>(d->File.size());
+  d->Data = d->Size ? d->File.map(0, d->File.size()) : 0;
+  if (!d->Data)
+    {
+    d->LastError = d->Size ? d->File.errorString() : QString("empty file");
+    this->close();
+    return false;
+    }
+  if (!d->checkLayout())
+    {
+    const QString error = d->LastError;
+    this->close();
+    d->LastError = error;
+    return false;
+    }
+  d->LastError.clear();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMSnapshot::close()
+{
+  CTK_D(ctkDICOMSnapshot);
+  if (d->Data)
+    {
+    d->File.unmap(const_cast<uchar*>(d->Data));
+    }
+  d->File.close();
+  d->Data = 0;
+  d->Size = 0;
+  d->Header = 0;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSnapshot::isOpen()const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  return d->Header != 0;
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMSnapshot::lastError()const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  return d->LastError;
+}
+
+//------------------------------------------------------------------------------
+QStringList ctkDICOMSnapshot::tables()const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  QStringList names;
+  for (int t = 0; d->tableAt(t); ++t)
+    {
+    names << this->string(d->tableAt(t)->NameId);
+    }
+  return names;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSnapshot::table(const QString& name)const
+{
+  return this->tables().indexOf(name);
+}
+
+//------------------------------------------------------------------------------
+qint64 ctkDICOMSnapshot::rowCount(int table)const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  const ctkDICOMSnapshotTable* t = d->tableAt(table);
+  return t ? static_cast<qint64>(t->RowCount) : 0;
+}
+
+//------------------------------------------------------------------------------
+QStringList ctkDICOMSnapshot::columns(int table)const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  QStringList names;
+  for (int c = 0; d->columnAt(table, c); ++c)
+    {
+    names << this->string(d->columnAt(table, c)->NameId);
+    }
+  return names;
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSnapshot::column(int table, const QString& name)const
+{
+  return this->columns(table).indexOf(name);
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMSnapshot::ColumnType ctkDICOMSnapshot::columnType(int table, int column)const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  const ctkDICOMSnapshotColumn* c = d->columnAt(table, column);
+  return c ? static_cast<ColumnType>(c->Type) : StringColumn;
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSnapshot::isNull(int table, int column, qint64 row)const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  const ctkDICOMSnapshotColumn* c = d->columnAt(table, column);
+  if (!c || row < 0 || row >= this->rowCount(table))
+    {
+    return true;
+    }
+  if (c->Type == StringColumn)
+    {
+    return this->stringIds(table, column)[row] == 0;
+    }
+  return c->NullsOffset &&
+    ((d->Data[c->NullsOffset + static_cast<quint64>(row) / 8] >> (row % 8)) & 1);
+}
+
+//------------------------------------------------------------------------------
+QVariant ctkDICOMSnapshot::value(int table, int column, qint64 row)const
+{
+  if (this->isNull(table, column, row))
+    {
+    return QVariant();
+    }
+  switch (this->columnType(table, column))
+    {
+    case IntegerColumn:
+      return QVariant(this->integers(table, column)[row]);
+    case RealColumn:
+      return QVariant(this->reals(table, column)[row]);
+    default:
+      return QVariant(this->string(this->stringIds(table, column)[row]));
+    }
+}
+
+//------------------------------------------------------------------------------
+const qint64* ctkDICOMSnapshot::integers(int table, int column)const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  return reinterpret_cast<const qint64*>(d->columnData(table, column, IntegerColumn));
+}
+
+//------------------------------------------------------------------------------
+const double* ctkDICOMSnapshot::reals(int table, int column)const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  return reinterpret_cast<const double*>(d->columnData(table, column, RealColumn));
+}
+
+//------------------------------------------------------------------------------
+const quint32* ctkDICOMSnapshot::stringIds(int table, int column)const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  return reinterpret_cast<const quint32*>(d->columnData(table, column, StringColumn));
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMSnapshot::stringCount()const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  return d->Header ? static_cast<int>(d->Header->StringCount) : 0;
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMSnapshot::string(quint32 id)const
+{
+  CTK_D(const ctkDICOMSnapshot);
+  if (!d->Header || id == 0 || id >= d->Header->StringCount)
+    {
+    return QString();
+    }
+  const quint64* offsets = reinterpret_cast<const quint64*>(
+    d->Data + d->Header->StringOffsetsOffset);
+  if (offsets[id] > offsets[id + 1] || offsets[id + 1] > d->Header->StringDataSize)
+    {
+    return QString();
+    }
+  return QString::fromUtf8(
+    reinterpret_cast<const char*>(d->Data + d->Header->StringDataOffset + offsets[id]),
+    static_cast<int>(offsets[id + 1] - offsets[id]));
+}
+
+//------------------------------------------------------------------------------
+bool ctkDICOMSnapshot::restore(QSqlDatabase database)const
+{
+  if (!this->isOpen() || !database.transaction())
+    {
+    return false;
+    }
+  bool res = true;
+  const QStringList names = this->tables();
+  for (int t = 0; t < names.size() && res; ++t)
+    {
+    const QSqlRecord record = database.record(names[t]);
+    QList<int> columns;
+    QStringList quotedColumns;
+    QStringList placeholders;
+    const QStringList snapshotColumns = this->columns(t);
+    for (int c = 0; c < snapshotColumns.size(); ++c)
+      {
+      if (record.contains(snapshotColumns[c]))
+        {
+        columns << c;
+        quotedColumns << quoted(snapshotColumns[c]);
+        placeholders << "?";
+        }
+      }
+    QSqlQuery query(database);
+    res = !columns.isEmpty() && query.exec("DELETE FROM " + quoted(names[t])) &&
+      query.prepare("INSERT INTO " + quoted(names[t]) + " (" + quotedColumns.join(", ") +
+                    ") VALUES (" + placeholders.join(", ") + ")");
+    const qint64 rows = this->rowCount(t);
+    for (qint64 row = 0; row < rows && res; ++row)
+      {
+      for (int c = 0; c < columns.size(); ++c)
+        {
+        query.bindValue(c, this->value(t, columns[c], row));
+        }
+      res = query.exec();
+      }
+    if (!res)
+      {
+      logger.error("Could not restore the table " + names[t] + ": " +
+                   query.lastError().text());
+      }
+    }
+  if (!res)
+    {
+    database.rollback();
+    return false;
+    }
+  return database.commit();
+}
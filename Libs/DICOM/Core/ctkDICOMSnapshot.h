@@ -0,0 +1,116 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMSnapshot_h
+#define __ctkDICOMSnapshot_h
+
+// Qt includes
+#include <QSqlDatabase>
+#include <QStringList>
+#include <QVariant>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMCoreExport.h"
+
+class ctkDICOMSnapshotPrivate;
+
+///
+/// Read-only columnar copy of tables of a DICOM database, in one file.
+/// write() stores each column as a contiguous array: 64 bits integers,
+/// doubles, or 32 bits ids of strings. The strings of all the columns,
+/// UIDs included, are stored once in a dictionary; id 0 is NULL. Integer
+/// and real columns with NULL values have a bitmap of the NULL rows.
+/// open() maps the file and only checks its layout: opening does not
+/// depend on the number of rows, the values are decoded when accessed.
+/// The arrays are in the byte order of the machine that wrote the file,
+/// a file written with another byte order is rejected.
+/// restore() writes the rows of a snapshot back in a database.
+class CTK_DICOM_CORE_EXPORT ctkDICOMSnapshot
+{
+public:
+  enum ColumnType
+  {
+    IntegerColumn = 1,
+    RealColumn = 2,
+    StringColumn = 3
+  };
+
+  ctkDICOMSnapshot();
+  virtual ~ctkDICOMSnapshot();
+
+  ///
+  /// Patients, Studies, Series and Images
+  static QStringList defaultTables();
+
+  ///
+  /// Write @param tables of @param database in @param file. The type of a
+  /// column is the affinity of its declared type. The tables are read in
+  /// one transaction, they are consistent with each other.
+  static bool write(QSqlDatabase database, const QString& file,
+                    const QStringList& tables = defaultTables(),
+                    QString* error = 0);
+
+  ///
+  /// Map @param file, return false and set lastError() if it is not a
+  /// valid snapshot.
+  bool open(const QString& file);
+  void close();
+  bool isOpen()const;
+  QString lastError()const;
+
+  QStringList tables()const;
+  /// Index of the table, -1 if not in the snapshot
+  int table(const QString& name)const;
+  qint64 rowCount(int table)const;
+  QStringList columns(int table)const;
+  /// Index of the column in the table, -1 if not in the snapshot
+  int column(int table, const QString& name)const;
+  ColumnType columnType(int table, int column)const;
+
+  bool isNull(int table, int column, qint64 row)const;
+  ///
+  /// Value of a cell, a null QVariant for NULL
+  QVariant value(int table, int column, qint64 row)const;
+
+  ///
+  /// Arrays of rowCount() values of a column in mapped memory, 0 if the
+  /// column has another type. The values of NULL integers and reals are 0.
+  const qint64*  integers(int table, int column)const;
+  const double*  reals(int table, int column)const;
+  const quint32* stringIds(int table, int column)const;
+
+  ///
+  /// Number of strings in the dictionary, NULL included
+  int stringCount()const;
+  QString string(quint32 id)const;
+
+  ///
+  /// Replace the rows of the snapshot tables in @param database by the
+  /// rows of the snapshot, in one transaction. The columns that are not
+  /// in the database table are ignored.
+  bool restore(QSqlDatabase database)const;
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMSnapshot);
+};
+
+#endif
@@ -0,0 +1,363 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutex>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QThread>
+#include <QThreadPool>
+
+// ctkDICOM includes
+#include "ctkDICOMIndexerRecord.h"
+#include "ctkDICOMStorage.h"
+#include "ctkLogger.h"
+
+#ifdef Q_OS_UNIX
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef Q_OS_LINUX
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+#endif
+
+static ctkLogger logger ( "org.commontk.dicom.DICOMStorage" );
+
+/// Maximum number of transfers waiting for a thread, store() blocks beyond
+static const int MaxPendingTransfers = 256;
+
+namespace
+{
+//------------------------------------------------------------------------------
+bool linkFile(const QString& source, const QString& destination)
+{
+#ifdef Q_OS_UNIX
+  return ::link(QFile::encodeName(source).constData(),
+                QFile::encodeName(destination).constData()) == 0;
+#else
+  Q_UNUSED(source);
+  Q_UNUSED(destination);
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// Copy without reading the content in user space, false if not supported
+bool cloneFile(const QString& source, const QString& destination)
+{
+#ifdef Q_OS_LINUX
+  const int in = ::open(QFile::encodeName(source).constData(), O_RDONLY);
+  if (in < 0)
+    {
+    return false;
+    }
+  struct stat info;
+  if (::fstat(in, &info) != 0)
+    {
+    ::close(in);
+    return false;
+    }
+  const int out = ::open(QFile::encodeName(destination).constData(),
+                         O_WRONLY | O_CREAT | O_TRUNC, info.st_mode & 0777);
+  if (out < 0)
+    {
+    ::close(in);
+    return false;
+    }
+  bool done = false;
+# ifdef FICLONE
+  // reflink: the blocks are shared until one of the files is modified
+  done = ::ioctl(out, FICLONE, in) == 0;
+# endif
+# ifdef __NR_copy_file_range
+  if (!done)
+    {
+    off_t remaining = info.st_size;
+    done = true;
+    while (remaining > 0)
+      {
+      const ssize_t copied = ::syscall(__NR_copy_file_range, in, static_cast<loff_t*>(0),
+                                       out, static_cast<loff_t*>(0),
+                                       static_cast<size_t>(remaining), 0u);
+      if (copied <= 0)
+        {
+        done = false;
+        break;
+        }
+      remaining -= copied;
+      }
+    }
+# endif
+  ::close(out);
+  ::close(in);
+  if (!done)
+    {
+    QFile::remove(destination);
+    }
+  return done;
+#else
+  Q_UNUSED(source);
+  Q_UNUSED(destination);
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+bool transfer(ctkDICOMStorage::Mode mode, const QString& source, const QString& destination)
+{
+  if (QFile::exists(destination))
+    {
+    // same SOP instance, already stored
+    return true;
+    }
+  if (!QDir().mkpath(QFileInfo(destination).path()))
+    {
+    return false;
+    }
+  switch (mode)
+    {
+    case ctkDICOMStorage::HardLink:
+      if (linkFile(source, destination))
+        {
+        return true;
+        }
+      break;
+    case ctkDICOMStorage::Move:
+      // QFile::rename copies and removes across devices
+      return QFile::rename(source, destination);
+    default:
+      break;
+    }
+
+  // The content is written under a temporary name so that a partial file
+  // never shows up at the destination
+  const QString temporary = destination + QString(".%1.part").arg(
+    reinterpret_cast<quintptr>(QThread::currentThreadId()));
+  QFile::remove(temporary);
+  bool res = false;
+  if (mode == ctkDICOMStorage::Clone)
+    {
+    res = cloneFile(source, temporary);
+    }
+  if (!res)
+    {
+    res = QFile::copy(source, temporary);
+    }
+  if (res && !QFile::rename(temporary, destination))
+    {
+    // another transfer stored the same instance in the meantime
+    res = QFile::exists(destination);
+    }
+  QFile::remove(temporary);
+  return res;
+}
+}
+
+//------------------------------------------------------------------------------
+class ctkDICOMStoragePrivate: public ctkPrivate<ctkDICOMStorage>
+{
+public:
+  ctkDICOMStoragePrivate();
+
+  void addFailure(const QString& destination);
+
+  QString               Directory;
+  ctkDICOMStorage::Mode Mode;
+  QThreadPool           Pool;
+  QSemaphore            Pending;
+
+  QMutex                FailuresMutex;
+  QStringList           Failures;
+};
+
+//------------------------------------------------------------------------------
+/// Transfer of one file, run by the thread pool of the storage
+class ctkDICOMStorageTask : public QRunnable
+{
+public:
+  ctkDICOMStorageTask(ctkDICOMStoragePrivate* storage, ctkDICOMStorage::Mode mode,
+                      const QString& source, const QString& destination)
+    : Storage(storage), Mode(mode), Source(source), Destination(destination)
+    {
+    }
+
+  virtual void run()
+    {
+    if (!transfer(this->Mode, this->Source, this->Destination))
+      {
+      logger.error ( "Could not store " + this->Source + " as " + this->Destination );
+      this->Storage->addFailure(this->Destination);
+      }
+    this->Storage->Pending.release();
+    }
+
+private:
+  ctkDICOMStoragePrivate* Storage;
+  ctkDICOMStorage::Mode   Mode;
+  QString                 Source;
+  QString                 Destination;
+};
+
+//------------------------------------------------------------------------------
+// ctkDICOMStoragePrivate methods
+
+//------------------------------------------------------------------------------
+ctkDICOMStoragePrivate::ctkDICOMStoragePrivate()
+  : Pending(MaxPendingTransfers)
+{
+  this->Mode = ctkDICOMStorage::Copy;
+  this->Pool.setMaxThreadCount(4);
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMStoragePrivate::addFailure(const QString& destination)
+{
+  QMutexLocker locker(&this->FailuresMutex);
+  this->Failures << destination;
+}
+
+//------------------------------------------------------------------------------
+// ctkDICOMStorage methods
+
+//------------------------------------------------------------------------------
+ctkDICOMStorage::ctkDICOMStorage(const QString& directory)
+{
+  CTK_INIT_PRIVATE(ctkDICOMStorage);
+  this->setDirectory(directory);
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMStorage::~ctkDICOMStorage()
+{
+  this->waitForDone();
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMStorage::setDirectory(const QString& directory)
+{
+  CTK_D(ctkDICOMStorage);
+  d->Directory = directory.isEmpty() ? QString() : QDir(directory).absolutePath();
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMStorage::directory()const
+{
+  CTK_D(const ctkDICOMStorage);
+  return d->Directory;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMStorage::setMode(Mode mode)
+{
+  CTK_D(ctkDICOMStorage);
+  d->Mode = mode;
+}
+
+//------------------------------------------------------------------------------
+ctkDICOMStorage::Mode ctkDICOMStorage::mode()const
+{
+  CTK_D(const ctkDICOMStorage);
+  return d->Mode;
+}
+
+//------------------------------------------------------------------------------
+void ctkDICOMStorage::setMaxConcurrentTransfers(int transfers)
+{
+  CTK_D(ctkDICOMStorage);
+  d->Pool.setMaxThreadCount(qMax(transfers, 1));
+}
+
+//------------------------------------------------------------------------------
+int ctkDICOMStorage::maxConcurrentTransfers()const
+{
+  CTK_D(const ctkDICOMStorage);
+  return d->Pool.maxThreadCount();
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMStorage::pathComponent(const QString& uid)
+{
+  QString component = uid;
+  for (int i = 0; i < component.size(); ++i)
+    {
+    const QChar c = component[i];
+    if (!c.isLetterOrNumber() && c != '.' && c != '-')
+      {
+      component[i] = '_';
+      }
+    }
+  // "." and ".." would name the parent directories
+  if (component.isEmpty() || component == "." || component == "..")
+    {
+    return QString("unknown");
+    }
+  return component;
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMStorage::relativePath(const QString& studyInstanceUID,
+                                      const QString& seriesInstanceUID,
+                                      const QString& sopInstanceUID)
+{
+  return pathComponent(studyInstanceUID) + "/" + pathComponent(seriesInstanceUID) +
+    "/" + pathComponent(sopInstanceUID) + ".dcm";
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMStorage::destinationPath(const ctkDICOMIndexerRecord& record)const
+{
+  CTK_D(const ctkDICOMStorage);
+  QString instance = record.SOPInstanceUID;
+  if (instance.isEmpty())
+    {
+    instance = QCryptographicHash::hash(record.Filename.toUtf8(),
+                                        QCryptographicHash::Md5).toHex();
+    }
+  return d->Directory + "/" +
+    relativePath(record.StudyInstanceUID, record.SeriesInstanceUID, instance);
+}
+
+//------------------------------------------------------------------------------
+QString ctkDICOMStorage::store(const ctkDICOMIndexerRecord& record)
+{
+  CTK_D(ctkDICOMStorage);
+  const QString destination = this->destinationPath(record);
+  d->Pending.acquire();
+  d->Pool.start(new ctkDICOMStorageTask(d, d->Mode, record.Filename, destination));
+  return destination;
+}
+
+//------------------------------------------------------------------------------
+QStringList ctkDICOMStorage::waitForDone()
+{
+  CTK_D(ctkDICOMStorage);
+  d->Pool.waitForDone();
+  QMutexLocker locker(&d->FailuresMutex);
+  QStringList failures = d->Failures;
+  d->Failures.clear();
+  return failures;
+}
@@ -0,0 +1,111 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMStorage_h
+#define __ctkDICOMStorage_h
+
+// Qt includes
+#include <QString>
+#include <QStringList>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMCoreExport.h"
+
+struct ctkDICOMIndexerRecord;
+class ctkDICOMStoragePrivate;
+
+///
+/// Managed storage of imported DICOM files.
+/// Each file is stored as
+/// <directory>/<StudyInstanceUID>/<SeriesInstanceUID>/<SOPInstanceUID>.dcm
+/// so that different instances never collide. The transfers run in the
+/// background on a bounded number of threads, store() only blocks when too
+/// many transfers are pending.
+class CTK_DICOM_CORE_EXPORT ctkDICOMStorage
+{
+public:
+  enum Mode
+  {
+    /// Copy the file content
+    Copy,
+    /// Hard link the file, copy if the destination is on another device
+    HardLink,
+    /// Share the file blocks with a reflink, or copy in the kernel with
+    /// copy_file_range, where the file system and the platform support it.
+    /// Copy otherwise.
+    Clone,
+    /// Move the file, copy and remove it if the destination is on another
+    /// device
+    Move
+  };
+
+  explicit ctkDICOMStorage(const QString& directory = QString());
+  /// Wait for the pending transfers
+  virtual ~ctkDICOMStorage();
+
+  void setDirectory(const QString& directory);
+  QString directory()const;
+
+  /// Default is Copy
+  void setMode(Mode mode);
+  Mode mode()const;
+
+  ///
+  /// Number of files transferred at the same time. Default is 4.
+  void setMaxConcurrentTransfers(int transfers);
+  int maxConcurrentTransfers()const;
+
+  ///
+  /// Path where @param record is stored. The SOPInstanceUID is replaced by
+  /// a hash of the source file name if the record doesn't have one.
+  QString destinationPath(const ctkDICOMIndexerRecord& record)const;
+
+  ///
+  /// File name for @param uid: the characters other than letters, digits,
+  /// '.' and '-' are replaced by '_'. UIDs received from a peer can't name
+  /// a file out of the directory.
+  static QString pathComponent(const QString& uid);
+
+  ///
+  /// Path of an instance relative to the directory:
+  /// <StudyInstanceUID>/<SeriesInstanceUID>/<SOPInstanceUID>.dcm, each
+  /// UID going through pathComponent().
+  static QString relativePath(const QString& studyInstanceUID,
+                              const QString& seriesInstanceUID,
+                              const QString& sopInstanceUID);
+
+  ///
+  /// Start transferring record.Filename to destinationPath(record) and
+  /// return the destination path. A destination that already exists is
+  /// kept: it is the same instance.
+  QString store(const ctkDICOMIndexerRecord& record);
+
+  ///
+  /// Wait for the pending transfers and return the destination paths of
+  /// the transfers that failed since the last call.
+  QStringList waitForDone();
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMStorage);
+};
+
+#endif
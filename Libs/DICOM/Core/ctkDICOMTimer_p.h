@@ -0,0 +1,65 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMTimer_p_h
+#define __ctkDICOMTimer_p_h
+
+// Qt includes
+#include <QTime>
+
+#if defined(Q_OS_UNIX)
+#include <sys/time.h>
+#elif defined(Q_OS_WIN)
+#include <windows.h>
+#endif
+
+//------------------------------------------------------------------------------
+/// Microseconds elapsed since start(). The statistics of the import sum
+/// durations of single files and statements, QTime only counts ms.
+class ctkDICOMTimer
+{
+public:
+  ctkDICOMTimer() { this->start(); }
+  void start() { this->Start = ctkDICOMTimer::now(); }
+  qint64 elapsed()const { return ctkDICOMTimer::now() - this->Start; }
+
+  static qint64 now()
+    {
+#if defined(Q_OS_UNIX)
+    struct timeval time;
+    gettimeofday(&time, 0);
+    return qint64(time.tv_sec) * 1000000 + time.tv_usec;
+#elif defined(Q_OS_WIN)
+    LARGE_INTEGER count;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return count.QuadPart / frequency.QuadPart * 1000000 +
+      count.QuadPart % frequency.QuadPart * 1000000 / frequency.QuadPart;
+#else
+    return qint64(QTime(0, 0).msecsTo(QTime::currentTime())) * 1000;
+#endif
+    }
+
+private:
+  qint64 Start;
+};
+
+#endif
@@ -1,4 +1,11 @@
 
+// Qt includes
+#include <QDir>
+#include <QTimer>
+
+// ctkDICOMCore includes
+#include "ctkDICOMListener.h"
+
 // ctkDICOMWidgets includes
 #include "ctkDICOMListenerWidget.h"
 #include "ui_ctkDICOMListenerWidget.h"
@@ -9,6 +16,9 @@ class ctkDICOMListenerWidgetPrivate: public ctkPrivate<ctkDICOMListenerWidget>,
 {
 public:
   ctkDICOMListenerWidgetPrivate(){}
+
+  ctkDICOMListener Listener;
+  QTimer           StatisticsTimer;
 };
 
 //----------------------------------------------------------------------------
@@ -23,13 +33,101 @@ ctkDICOMListenerWidget::ctkDICOMListenerWidget(QWidget* _parent):Superclass(_par
 {
   CTK_INIT_PRIVATE(ctkDICOMListenerWidget);
   CTK_D(ctkDICOMListenerWidget);
-  
+
   d->setupUi(this);
+  d->AETitleEdit->setText(d->Listener.AETitle());
+  d->PortSpinBox->setValue(d->Listener.port());
+  d->MaximumAssociationsSpinBox->setValue(d->Listener.maximumAssociations());
+  d->StorageDirectoryButton->setDirectory(d->Listener.storageDirectory());
+
+  d->StatisticsTimer.setInterval(1000);
+  connect(&d->StatisticsTimer, SIGNAL(timeout()), this, SLOT(updateStatistics()));
+  connect(d->ListenButton, SIGNAL(toggled(bool)), this, SLOT(setListening(bool)));
 }
 
 //----------------------------------------------------------------------------
 ctkDICOMListenerWidget::~ctkDICOMListenerWidget()
 {
+  this->stop();
+}
+
+//----------------------------------------------------------------------------
+ctkDICOMListener* ctkDICOMListenerWidget::listener()const
+{
+  CTK_D(const ctkDICOMListenerWidget);
+  return const_cast<ctkDICOMListener*>(&d->Listener);
+}
+
+//----------------------------------------------------------------------------
+bool ctkDICOMListenerWidget::start()
+{
+  CTK_D(ctkDICOMListenerWidget);
+  if (!d->Listener.isListening())
+    {
+    d->Listener.setAETitle(d->AETitleEdit->text().trimmed());
+    d->Listener.setPort(d->PortSpinBox->value());
+    d->Listener.setMaximumAssociations(d->MaximumAssociationsSpinBox->value());
+    d->Listener.setStorageDirectory(QDir(d->StorageDirectoryButton->directory()).absolutePath());
+    d->Listener.start();
+    }
+  const bool listening = d->Listener.isListening();
+  if (listening)
+    {
+    d->StatisticsTimer.start();
+    }
+  d->AETitleEdit->setEnabled(!listening);
+  d->PortSpinBox->setEnabled(!listening);
+  d->MaximumAssociationsSpinBox->setEnabled(!listening);
+  d->StorageDirectoryButton->setEnabled(!listening);
+  d->ListenButton->blockSignals(true);
+  d->ListenButton->setChecked(listening);
+  d->ListenButton->setText(listening ? tr("Stop") : tr("Start"));
+  d->ListenButton->blockSignals(false);
+  this->updateStatistics();
+  return listening;
 }
 
+//----------------------------------------------------------------------------
+void ctkDICOMListenerWidget::stop()
+{
+  CTK_D(ctkDICOMListenerWidget);
+  d->Listener.stop();
+  d->StatisticsTimer.stop();
+  d->AETitleEdit->setEnabled(true);
+  d->PortSpinBox->setEnabled(true);
+  d->MaximumAssociationsSpinBox->setEnabled(true);
+  d->StorageDirectoryButton->setEnabled(true);
+  d->ListenButton->blockSignals(true);
+  d->ListenButton->setChecked(false);
+  d->ListenButton->setText(tr("Start"));
+  d->ListenButton->blockSignals(false);
+  this->updateStatistics();
+}
 
+//----------------------------------------------------------------------------
+void ctkDICOMListenerWidget::setListening(bool listening)
+{
+  if (listening)
+    {
+    this->start();
+    }
+  else
+    {
+    this->stop();
+    }
+}
+
+//----------------------------------------------------------------------------
+void ctkDICOMListenerWidget::updateStatistics()
+{
+  CTK_D(ctkDICOMListenerWidget);
+  const ctkDICOMListener::Statistics statistics = d->Listener.statistics();
+  d->AssociationsValue->setText(QString("%1 / %2 / %3")
+    .arg(statistics.ActiveAssociations).arg(statistics.Associations)
+    .arg(statistics.RejectedAssociations));
+  d->InstancesValue->setText(QString("%1 / %2")
+    .arg(statistics.InstancesReceived).arg(statistics.InstancesFailed));
+  d->ThroughputValue->setText(QString::number(statistics.InstancesPerSecond, 'f', 1));
+  d->BytesValue->setText(QString("%1 MB")
+    .arg(statistics.BytesReceived / 1000000., 0, 'f', 1));
+}
@@ -29,15 +29,35 @@
 
 #include "CTKDICOMWidgetsExport.h"
 
+class ctkDICOMListener;
 class ctkDICOMListenerWidgetPrivate;
 
+///
+/// Settings, start and stop of a ctkDICOMListener, with its association
+/// counts and throughput refreshed every second while it listens.
+/// The database of the listener is set on listener().
 class CTK_DICOM_WIDGETS_EXPORT ctkDICOMListenerWidget : public QWidget
 {
+  Q_OBJECT
 public:
   typedef QWidget Superclass;
   explicit ctkDICOMListenerWidget(QWidget* parent=0);
+  /// Stop the listener
   virtual ~ctkDICOMListenerWidget();
 
+  ctkDICOMListener* listener()const;
+
+public slots:
+  ///
+  /// Start the listener with the settings of the widget, return false if
+  /// it could not listen
+  bool start();
+  void stop();
+  void updateStatistics();
+
+protected slots:
+  void setListening(bool listening);
+
 private:
   CTK_DECLARE_PRIVATE(ctkDICOMListenerWidget);
 };
@@ -0,0 +1,169 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// Qt includes
+#include <QList>
+#include <QSet>
+
+// ctkDICOMCore includes
+#include "ctkDICOMModel.h"
+#include "ctkDICOMSearch.h"
+
+// ctkDICOMWidgets includes
+#include "ctkDICOMSearchFilterProxyModel.h"
+
+//----------------------------------------------------------------------------
+class ctkDICOMSearchFilterProxyModelPrivate: public ctkPrivate<ctkDICOMSearchFilterProxyModel>
+{
+public:
+  ctkDICOMSearchFilterProxyModelPrivate();
+  /// Fill the accepted UIDs with the matches of the search text
+  void search();
+  /// Restrict the source model to the accepted UIDs
+  void filter();
+
+  QSqlDatabase Database;
+  QString      SearchText;
+  int          MaximumMatches;
+  /// UIDs of the matches and of their ancestors, per level, empty if
+  /// there is no search text
+  QList<QSet<QString> > Accepted;
+  /// UIDs of the matches, their descendants are accepted too
+  QList<QSet<QString> > Matched;
+};
+
+//----------------------------------------------------------------------------
+// ctkDICOMSearchFilterProxyModelPrivate methods
+
+//----------------------------------------------------------------------------
+ctkDICOMSearchFilterProxyModelPrivate::ctkDICOMSearchFilterProxyModelPrivate()
+{
+  this->MaximumMatches = 100;
+}
+
+//----------------------------------------------------------------------------
+void ctkDICOMSearchFilterProxyModelPrivate::search()
+{
+  this->Accepted.clear();
+  this->Matched.clear();
+  if (this->SearchText.trimmed().isEmpty())
+    {
+    return;
+    }
+  for (int level = ctkDICOMSearch::PatientLevel; level <= ctkDICOMSearch::SeriesLevel; ++level)
+    {
+    this->Accepted << QSet<QString>();
+    this->Matched << QSet<QString>();
+    }
+  ctkDICOMSearch search(this->Database);
+  foreach(const ctkDICOMSearchMatch& match, search.search(this->SearchText, this->MaximumMatches))
+    {
+    const QString uids[] = {match.PatientUID, match.StudyInstanceUID, match.SeriesInstanceUID};
+    this->Matched[match.Level].insert(uids[match.Level]);
+    for (int level = ctkDICOMSearch::PatientLevel; level <= match.Level; ++level)
+      {
+      this->Accepted[level].insert(uids[level]);
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+void ctkDICOMSearchFilterProxyModelPrivate::filter()
+{
+  CTK_P(ctkDICOMSearchFilterProxyModel);
+  ctkDICOMModel* model = qobject_cast<ctkDICOMModel*>(p->sourceModel());
+  if (model)
+    {
+    model->setUIDFilter(this->Accepted, this->Matched);
+    }
+}
+
+//----------------------------------------------------------------------------
+// ctkDICOMSearchFilterProxyModel methods
+
+//----------------------------------------------------------------------------
+ctkDICOMSearchFilterProxyModel::ctkDICOMSearchFilterProxyModel(QObject* _parent)
+  : Superclass(_parent)
+{
+  CTK_INIT_PRIVATE(ctkDICOMSearchFilterProxyModel);
+}
+
+//----------------------------------------------------------------------------
+ctkDICOMSearchFilterProxyModel::~ctkDICOMSearchFilterProxyModel()
+{
+}
+
+//----------------------------------------------------------------------------
+void ctkDICOMSearchFilterProxyModel::setDatabase(const QSqlDatabase& database)
+{
+  CTK_D(ctkDICOMSearchFilterProxyModel);
+  d->Database = database;
+  d->search();
+  d->filter();
+}
+
+//----------------------------------------------------------------------------
+QSqlDatabase ctkDICOMSearchFilterProxyModel::database()const
+{
+  CTK_D(const ctkDICOMSearchFilterProxyModel);
+  return d->Database;
+}
+
+//----------------------------------------------------------------------------
+QString ctkDICOMSearchFilterProxyModel::searchText()const
+{
+  CTK_D(const ctkDICOMSearchFilterProxyModel);
+  return d->SearchText;
+}
+
+//----------------------------------------------------------------------------
+void ctkDICOMSearchFilterProxyModel::setMaximumMatches(int matches)
+{
+  CTK_D(ctkDICOMSearchFilterProxyModel);
+  d->MaximumMatches = qMax(matches, 1);
+}
+
+//----------------------------------------------------------------------------
+int ctkDICOMSearchFilterProxyModel::maximumMatches()const
+{
+  CTK_D(const ctkDICOMSearchFilterProxyModel);
+  return d->MaximumMatches;
+}
+
+//----------------------------------------------------------------------------
+void ctkDICOMSearchFilterProxyModel::setSearchText(const QString& text)
+{
+  CTK_D(ctkDICOMSearchFilterProxyModel);
+  if (text == d->SearchText)
+    {
+    return;
+    }
+  d->SearchText = text;
+  d->search();
+  d->filter();
+}
+
+//----------------------------------------------------------------------------
+void ctkDICOMSearchFilterProxyModel::setSourceModel(QAbstractItemModel* model)
+{
+  CTK_D(ctkDICOMSearchFilterProxyModel);
+  this->Superclass::setSourceModel(model);
+  d->filter();
+}
@@ -0,0 +1,80 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef __ctkDICOMSearchFilterProxyModel_h
+#define __ctkDICOMSearchFilterProxyModel_h
+
+// Qt includes
+#include <QSortFilterProxyModel>
+#include <QSqlDatabase>
+
+// CTK includes
+#include <ctkPimpl.h>
+
+#include "CTKDICOMWidgetsExport.h"
+
+class ctkDICOMSearchFilterProxyModelPrivate;
+
+///
+/// Filter a ctkDICOMModel with the matches of ctkDICOMSearch: the patients,
+/// studies and series matching searchText() are shown with their ancestors
+/// and all their descendants. The search is run once per text, the UIDs
+/// found then restrict the queries of the source model
+/// (ctkDICOMModel::setUIDFilter()) so that no row is read to be filtered.
+/// An empty text shows all the rows.
+class CTK_DICOM_WIDGETS_EXPORT ctkDICOMSearchFilterProxyModel : public QSortFilterProxyModel
+{
+  Q_OBJECT
+  Q_PROPERTY(QString searchText READ searchText WRITE setSearchText);
+  Q_PROPERTY(int maximumMatches READ maximumMatches WRITE setMaximumMatches);
+public:
+  typedef QSortFilterProxyModel Superclass;
+  explicit ctkDICOMSearchFilterProxyModel(QObject* parent = 0);
+  virtual ~ctkDICOMSearchFilterProxyModel();
+
+  ///
+  /// Database searched, usually the one of the source model
+  void setDatabase(const QSqlDatabase& database);
+  QSqlDatabase database()const;
+
+  QString searchText()const;
+
+  ///
+  /// Maximum number of patients, studies and series matched, the best
+  /// ones are shown. Default is 100.
+  void setMaximumMatches(int matches);
+  int maximumMatches()const;
+
+  ///
+  /// The source model must be a ctkDICOMModel, its UID filter is set to
+  /// the matches of searchText()
+  virtual void setSourceModel(QAbstractItemModel* sourceModel);
+
+public slots:
+  ///
+  /// Search the database and filter the rows, typically connected to the
+  /// textChanged() signal of a line edit.
+  void setSearchText(const QString& text);
+
+private:
+  CTK_DECLARE_PRIVATE(ctkDICOMSearchFilterProxyModel);
+};
+
+#endif
@@ -0,0 +1,136 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// CTK includes
+#include "ctkPluginArchive_p.h"
+#include "ctkPluginDatabaseSnapshot_p.h"
+#include "ctkPluginManifest_p.h"
+
+#include <iostream>
+#include <cstdlib>
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutex>
+#include <QWaitCondition>
+
+
+bool WriteSnapshotTestFile(const QString& path, const QByteArray& content);
+
+//-----------------------------------------------------------------------------
+int ctkPluginDatabaseSnapshotTest(int argc, char * argv [] )
+{
+  Q_UNUSED(argc);
+  Q_UNUSED(argv);
+
+  // Files stand for the plugin database and a plugin library
+  QDir testDir(QDir::temp().filePath("ctkPluginDatabaseSnapshotTest"));
+  testDir.mkpath(".");
+  const QString database = testDir.filePath("pluginfw.db");
+  const QString library = testDir.filePath("libtest.so");
+  const QString snapshotPath = testDir.filePath("pluginfw.snapshot");
+  QFile::remove(snapshotPath);
+  if (!WriteSnapshotTestFile(database, "database") || !WriteSnapshotTestFile(library, "library"))
+  {
+    std::cerr << "Could not write the test files" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const ctkPluginManifest manifest("Plugin-SymbolicName: test\nRequire-Plugin: base\n");
+  ctkPluginArchive archive(0, QUrl::fromLocalFile(library), library, 3, manifest);
+  if (!ctkPluginDatabaseSnapshot::write(snapshotPath, database,
+                                        QList<ctkPluginArchive*>() << &archive))
+  {
+    std::cerr << "Could not write the snapshot" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  ctkPluginDatabaseSnapshot snapshot;
+  if (!snapshot.read(snapshotPath, database) || snapshot.records.size() != 1 ||
+      snapshot.records.at(0).id != 3 ||
+      snapshot.records.at(0).location != QUrl::fromLocalFile(library) ||
+      snapshot.records.at(0).localPath != library ||
+      snapshot.records.at(0).manifest.getAttribute("Require-Plugin") != "base")
+  {
+    std::cerr << "Unexpected records in the snapshot" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A library of another size invalidates the snapshot
+  if (!WriteSnapshotTestFile(library, "rebuilt library") ||
+      snapshot.read(snapshotPath, database) || !snapshot.records.isEmpty())
+  {
+    std::cerr << "Snapshot read after the size of the library changed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // So does a library of the same size modified later. The modification
+  // times are compared in seconds.
+  if (!ctkPluginDatabaseSnapshot::write(snapshotPath, database,
+                                        QList<ctkPluginArchive*>() << &archive) ||
+      !snapshot.read(snapshotPath, database))
+  {
+    std::cerr << "Could not write the snapshot again" << std::endl;
+    return EXIT_FAILURE;
+  }
+  QMutex mutex;
+  QWaitCondition wait;
+  mutex.lock();
+  wait.wait(&mutex, 1100);
+  mutex.unlock();
+  if (!WriteSnapshotTestFile(library, "rebuilt_library") ||
+      snapshot.read(snapshotPath, database))
+  {
+    std::cerr << "Snapshot read after the library was modified" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // And a modified database
+  if (!ctkPluginDatabaseSnapshot::write(snapshotPath, database,
+                                        QList<ctkPluginArchive*>() << &archive) ||
+      !WriteSnapshotTestFile(database, "modified database") ||
+      snapshot.read(snapshotPath, database))
+  {
+    std::cerr << "Snapshot read after the database changed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A missing library too
+  if (!ctkPluginDatabaseSnapshot::write(snapshotPath, database,
+                                        QList<ctkPluginArchive*>() << &archive) ||
+      !QFile::remove(library) || snapshot.read(snapshotPath, database))
+  {
+    std::cerr << "Snapshot read without the library" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  QFile::remove(snapshotPath);
+  QFile::remove(database);
+  return EXIT_SUCCESS;
+}
+
+bool WriteSnapshotTestFile(const QString& path, const QByteArray& content)
+{
+  QFile file(path);
+  return file.open(QIODevice::WriteOnly | QIODevice::Truncate) &&
+      file.write(content) == content.size();
+}
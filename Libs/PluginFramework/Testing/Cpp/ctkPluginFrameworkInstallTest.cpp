@@ -0,0 +1,136 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// CTK includes
+#include "ctkPlugin.h"
+#include "ctkPluginContext.h"
+#include "ctkPluginFramework.h"
+#include "ctkPluginFrameworkFactory.h"
+#include "ctkPluginFrameworkTestUtil.h"
+
+#include <iostream>
+#include <cstdlib>
+
+#include <QCoreApplication>
+#include <QDir>
+
+
+//-----------------------------------------------------------------------------
+int ctkPluginFrameworkInstallTest(int argc, char * argv [] )
+{
+  QCoreApplication app(argc, argv);
+
+  if (argc < 2)
+  {
+    std::cerr << "Usage: ctkPluginFrameworkInstallTest <plugins directory>" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const QUrl base = ctkPluginFrameworkTestPlugin(argv[1], "org_commontk_pluginfwtest_base");
+  const QUrl dependent = ctkPluginFrameworkTestPlugin(argv[1], "org_commontk_pluginfwtest_dependent");
+  if (base.isEmpty() || dependent.isEmpty())
+  {
+    std::cerr << "The test plugins are missing in " << argv[1] << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!ctkPluginFrameworkTestStorage(QDir::temp().filePath("ctkPluginFrameworkInstallTest")))
+  {
+    std::cerr << "Could not create the framework storage" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  ctkPluginFrameworkFactory factory;
+  ctkPluginFramework* framework = factory.getFramework();
+  framework->init();
+  framework->start();
+  ctkPluginContext* context = framework->getPluginContext();
+
+  // The dependent plugin comes first. The missing library and the
+  // unsupported scheme must not prevent the other installs.
+  QList<QUrl> locations;
+  locations << dependent
+            << QUrl::fromLocalFile(QDir::current().filePath("libmissing.so"))
+            << QUrl("http://localhost/libplugin.so")
+            << base
+            << dependent;
+  QList<ctkPlugin*> plugins;
+  try
+  {
+    plugins = context->installPlugins(locations, 2);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "The bulk install failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  ctkPlugin* basePlugin = 0;
+  ctkPlugin* dependentPlugin = 0;
+  foreach (ctkPlugin* plugin, plugins)
+  {
+    if (plugin->getSymbolicName() == "org.commontk.pluginfwtest.base")
+    {
+      basePlugin = plugin;
+    }
+    else if (plugin->getSymbolicName() == "org.commontk.pluginfwtest.dependent")
+    {
+      dependentPlugin = plugin;
+    }
+  }
+  if (plugins.size() != 2 || !basePlugin || !dependentPlugin)
+  {
+    std::cerr << "Expected the two test plugins, got " << plugins.size() << " plugins" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The required plugin is installed first
+  if (basePlugin->getPluginId() >= dependentPlugin->getPluginId())
+  {
+    std::cerr << "The required plugin got id " << basePlugin->getPluginId()
+              << ", after the dependent plugin " << dependentPlugin->getPluginId() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Installed plugins are returned as they are
+  plugins = context->installPlugins(QList<QUrl>() << base << dependent);
+  if (plugins.size() != 2 || !plugins.contains(basePlugin) || !plugins.contains(dependentPlugin))
+  {
+    std::cerr << "Installing the plugins again did not return the installed plugins" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    basePlugin->start(0);
+    dependentPlugin->start(0);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Could not start the installed plugins: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (basePlugin->getState() != ctkPlugin::ACTIVE ||
+      dependentPlugin->getState() != ctkPlugin::ACTIVE)
+  {
+    std::cerr << "The installed plugins are not active" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
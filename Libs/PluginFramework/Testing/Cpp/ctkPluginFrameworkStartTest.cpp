@@ -0,0 +1,143 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// CTK includes
+#include "ctkPlugin.h"
+#include "ctkPluginConstants.h"
+#include "ctkPluginContext.h"
+#include "ctkPluginFramework.h"
+#include "ctkPluginFrameworkFactory.h"
+#include "ctkPluginFrameworkTestUtil.h"
+
+#include <iostream>
+#include <cstdlib>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QMutex>
+#include <QStringList>
+
+
+// The plugins started on worker threads log too
+static QMutex MessagesMutex;
+static QStringList Messages;
+
+void CaptureMessage(QtMsgType type, const char* message);
+
+//-----------------------------------------------------------------------------
+int ctkPluginFrameworkStartTest(int argc, char * argv [] )
+{
+  QCoreApplication app(argc, argv);
+
+  if (argc < 2)
+  {
+    std::cerr << "Usage: ctkPluginFrameworkStartTest <plugins directory>" << std::endl;
+    return EXIT_FAILURE;
+  }
+  // The dependent plugin is installed first and gets the lowest id,
+  // it is only started after the plugin it requires
+  QList<QUrl> locations;
+  locations << ctkPluginFrameworkTestPlugin(argv[1], "org_commontk_pluginfwtest_dependent")
+            << ctkPluginFrameworkTestPlugin(argv[1], "org_commontk_pluginfwtest_independent")
+            << ctkPluginFrameworkTestPlugin(argv[1], "org_commontk_pluginfwtest_base");
+  if (locations.contains(QUrl()))
+  {
+    std::cerr << "The test plugins are missing in " << argv[1] << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!ctkPluginFrameworkTestStorage(QDir::temp().filePath("ctkPluginFrameworkStartTest")))
+  {
+    std::cerr << "Could not create the framework storage" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Install the plugins one by one and start them persistently
+  {
+    ctkPluginFrameworkFactory factory;
+    ctkPluginFramework* framework = factory.getFramework();
+    framework->init();
+    framework->start();
+
+    QList<ctkPlugin*> plugins;
+    try
+    {
+      foreach (const QUrl& location, locations)
+      {
+        plugins.push_back(framework->getPluginContext()->installPlugin(location));
+      }
+      plugins.at(2)->start(0);
+      plugins.at(1)->start(0);
+      plugins.at(0)->start(0);
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << "Could not install and start the plugins: " << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The plugins are started again on launch, by levels of their
+  // requirements, on several threads
+  ctkPluginFrameworkFactory::Properties properties;
+  properties.insert(PluginConstants::FRAMEWORK_START_THREADS, 4);
+  ctkPluginFrameworkFactory factory(properties);
+  ctkPluginFramework* framework = factory.getFramework();
+  qInstallMsgHandler(CaptureMessage);
+  framework->init();
+  framework->start();
+  qInstallMsgHandler(0);
+
+  int activePlugins = 0;
+  foreach (ctkPlugin* plugin, framework->getPluginContext()->getPlugins())
+  {
+    if (plugin->getSymbolicName().startsWith("org.commontk.pluginfwtest."))
+    {
+      if (plugin->getState() != ctkPlugin::ACTIVE)
+      {
+        std::cerr << qPrintable(plugin->getSymbolicName()) << " is not active after launch" << std::endl;
+        return EXIT_FAILURE;
+      }
+      ++activePlugins;
+    }
+  }
+  if (activePlugins != 3)
+  {
+    std::cerr << "Expected 3 active test plugins, got " << activePlugins << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The independent plugins share the first level
+  if (Messages.filter("Started 3 plugins in 2 levels").isEmpty())
+  {
+    std::cerr << "The plugins were not started in 2 levels:" << std::endl
+              << qPrintable(Messages.join("\n")) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
+void CaptureMessage(QtMsgType type, const char* message)
+{
+  Q_UNUSED(type);
+  QMutexLocker lock(&MessagesMutex);
+  Messages << QString::fromLocal8Bit(message);
+}
@@ -0,0 +1,73 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#include "ctkPluginFrameworkTestUtil.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QLibrary>
+#include <QStringList>
+
+bool RemoveDirectory(const QString& path);
+
+//-----------------------------------------------------------------------------
+QUrl ctkPluginFrameworkTestPlugin(const QString& pluginsDir, const QString& pluginName)
+{
+  QDir dir(pluginsDir);
+  foreach (const QString& fileName, dir.entryList(QStringList("lib" + pluginName + ".*"), QDir::Files))
+  {
+    if (QLibrary::isLibrary(fileName))
+    {
+      return QUrl::fromLocalFile(dir.absoluteFilePath(fileName));
+    }
+  }
+  return QUrl();
+}
+
+//-----------------------------------------------------------------------------
+bool ctkPluginFrameworkTestStorage(const QString& path)
+{
+  if (QFileInfo(path).exists() && !RemoveDirectory(path))
+  {
+    return false;
+  }
+  return QDir().mkpath(path) && QDir::setCurrent(path);
+}
+
+//-----------------------------------------------------------------------------
+bool RemoveDirectory(const QString& path)
+{
+  QDir dir(path);
+  foreach (const QFileInfo& info, dir.entryInfoList(QDir::AllEntries | QDir::Hidden | QDir::NoDotAndDotDot))
+  {
+    if (info.isDir() && !info.isSymLink())
+    {
+      if (!RemoveDirectory(info.absoluteFilePath()))
+      {
+        return false;
+      }
+    }
+    else if (!dir.remove(info.fileName()))
+    {
+      return false;
+    }
+  }
+  return dir.rmdir(dir.absolutePath());
+}
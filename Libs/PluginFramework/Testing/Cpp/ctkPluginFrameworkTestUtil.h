@@ -0,0 +1,36 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+#ifndef CTKPLUGINFRAMEWORKTESTUTIL_H
+#define CTKPLUGINFRAMEWORKTESTUTIL_H
+
+#include <QString>
+#include <QUrl>
+
+/// Location of the test plugin library \a pluginName (for instance
+/// "org_commontk_pluginfwtest_base") built in \a pluginsDir, or an empty
+/// url if it is missing
+QUrl ctkPluginFrameworkTestPlugin(const QString& pluginsDir, const QString& pluginName);
+
+/// Create the empty directory \a path and make it the current directory:
+/// the framework keeps its plugin database in the current directory
+bool ctkPluginFrameworkTestStorage(const QString& path);
+
+#endif
@@ -0,0 +1,121 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// CTK includes
+#include "ctkPlugin.h"
+#include "ctkPluginContext.h"
+#include "ctkPluginFramework.h"
+#include "ctkPluginFrameworkFactory.h"
+#include "ctkPluginFrameworkTestUtil.h"
+#include "ctkServiceReference.h"
+
+#include <iostream>
+#include <cstdlib>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QLibrary>
+
+
+//-----------------------------------------------------------------------------
+int ctkPluginLazyActivationTest(int argc, char * argv [] )
+{
+  QCoreApplication app(argc, argv);
+
+  if (argc < 2)
+  {
+    std::cerr << "Usage: ctkPluginLazyActivationTest <plugins directory>" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const QUrl lazy = ctkPluginFrameworkTestPlugin(argv[1], "org_commontk_pluginfwtest_lazy");
+  if (lazy.isEmpty())
+  {
+    std::cerr << "The test plugin is missing in " << argv[1] << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!ctkPluginFrameworkTestStorage(QDir::temp().filePath("ctkPluginLazyActivationTest")))
+  {
+    std::cerr << "Could not create the framework storage" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  {
+    ctkPluginFrameworkFactory factory;
+    ctkPluginFramework* framework = factory.getFramework();
+    framework->init();
+    framework->start();
+    ctkPluginContext* context = framework->getPluginContext();
+
+    try
+    {
+      ctkPlugin* plugin = context->installPlugin(lazy);
+      plugin->start(ctkPlugin::START_ACTIVATION_POLICY);
+
+      // The declared service is advertised, the library is not loaded
+      if (plugin->getState() != ctkPlugin::STARTING ||
+          QLibrary(lazy.toLocalFile()).isLoaded())
+      {
+        std::cerr << "The lazy plugin was activated on start" << std::endl;
+        return EXIT_FAILURE;
+      }
+      ctkServiceReference* reference = context->getServiceReference("ctkPluginFwTestLazy");
+      if (!reference || plugin->getState() != ctkPlugin::STARTING)
+      {
+        std::cerr << "The declared service of the lazy plugin is missing" << std::endl;
+        return EXIT_FAILURE;
+      }
+
+      // Its first use activates the plugin
+      context->getService(reference);
+      if (plugin->getState() != ctkPlugin::ACTIVE)
+      {
+        std::cerr << "The lazy plugin was not activated by the use of its service" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << "Lazy activation failed: " << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The activation kept the autostart setting, the plugin waits for its
+  // activation again after a relaunch
+  ctkPluginFrameworkFactory factory;
+  ctkPluginFramework* framework = factory.getFramework();
+  framework->init();
+  framework->start();
+  ctkPlugin* plugin = 0;
+  foreach (ctkPlugin* installed, framework->getPluginContext()->getPlugins())
+  {
+    if (installed->getSymbolicName() == "org.commontk.pluginfwtest.lazy")
+    {
+      plugin = installed;
+    }
+  }
+  if (!plugin || plugin->getState() != ctkPlugin::STARTING)
+  {
+    std::cerr << "The lazy plugin is not waiting for its activation after a relaunch" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
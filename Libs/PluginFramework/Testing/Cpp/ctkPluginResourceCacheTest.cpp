@@ -0,0 +1,112 @@
+/*=========================================================================
+
+  Library:   CTK
+
+  Copyright (c) 2010  Kitware Inc.
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+      http://www.commontk.org/LICENSE
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=========================================================================*/
+
+// CTK includes
+#include "ctkPluginException.h"
+#include "ctkPluginResourceCache_p.h"
+
+#include <iostream>
+#include <cstdlib>
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+
+bool WriteFile(const QString& path, const QByteArray& content);
+
+//-----------------------------------------------------------------------------
+int ctkPluginResourceCacheTest(int argc, char * argv [] )
+{
+  Q_UNUSED(argc);
+  Q_UNUSED(argv);
+
+  // A directory stands for the resources of a plugin library
+  QDir testDir(QDir::temp().filePath("ctkPluginResourceCacheTest"));
+  testDir.mkpath("resources/META-INF");
+  const QString library = testDir.filePath("libtest.so");
+  const QString cachePath = testDir.filePath("cache/test.res");
+  QFile::remove(cachePath);
+  if (!WriteFile(library, "library") ||
+      !WriteFile(testDir.filePath("resources/META-INF/MANIFEST.MF"), "Plugin-SymbolicName: test\n") ||
+      !WriteFile(testDir.filePath("resources/servicedescriptor.xml"), "<service/>"))
+  {
+    std::cerr << "Could not write the test files" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    ctkPluginResourceCache::write(library, cachePath, testDir.filePath("resources"));
+  }
+  catch (const ctkPluginException& exc)
+  {
+    std::cerr << "Could not write the cache: " << exc.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Reopen the written cache
+  {
+    ctkPluginResourceCache cache;
+    if (!cache.open(cachePath, library) ||
+        cache.getResource("META-INF/MANIFEST.MF") != "Plugin-SymbolicName: test\n" ||
+        cache.getResource("/servicedescriptor.xml") != "<service/>" ||
+        !cache.getResource("missing").isNull())
+    {
+      std::cerr << "Unexpected resources in the cache" << std::endl;
+      return EXIT_FAILURE;
+    }
+    QStringList paths = cache.findResourcesPath("/");
+    paths.sort();
+    if (paths != (QStringList() << "META-INF/" << "servicedescriptor.xml") ||
+        cache.findResourcesPath("META-INF") != QStringList("MANIFEST.MF"))
+    {
+      std::cerr << "Unexpected resource paths in the cache" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The cache of another library is rejected
+  ctkPluginResourceCache cache;
+  if (cache.open(cachePath, testDir.filePath("libother.so")) || cache.isOpen())
+  {
+    std::cerr << "Cache opened for another library" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The cache is outdated once the library changed
+  if (!WriteFile(library, "rebuilt library") || cache.open(cachePath, library))
+  {
+    std::cerr << "Outdated cache opened" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  cache.close();
+  QFile::remove(cachePath);
+  return EXIT_SUCCESS;
+}
+
+bool WriteFile(const QString& path, const QByteArray& content)
+{
+  QFile file(path);
+  return file.open(QIODevice::WriteOnly | QIODevice::Truncate) &&
+      file.write(content) == content.size();
+}
@@ -0,0 +1 @@
+SET(Require-Plugin org.commontk.pluginfwtest.base)
@@ -0,0 +1,50 @@
+/*=============================================================================
+
+  Library: CTK
+
+  Copyright (c) 2010 German Cancer Research Center,
+    Division of Medical and Biological Informatics
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#include "ctkPluginFwTestLazyPlugin_p.h"
+
+#include <QtPlugin>
+#include <QServiceInterfaceDescriptor>
+
+using namespace QtMobility;
+
+
+  void ctkPluginFwTestLazyPlugin::start(ctkPluginContext* context)
+  {
+    Q_UNUSED(context)
+  }
+
+  void ctkPluginFwTestLazyPlugin::stop(ctkPluginContext* context)
+  {
+    Q_UNUSED(context)
+  }
+
+  QObject* ctkPluginFwTestLazyPlugin::createInstance(const QServiceInterfaceDescriptor& descriptor,
+                                                     QServiceContext* context,
+                                                     QAbstractSecuritySession* session)
+  {
+    Q_UNUSED(descriptor)
+    Q_UNUSED(context)
+    Q_UNUSED(session)
+    return new QObject();
+  }
+
+Q_EXPORT_PLUGIN2(org_commontk_pluginfwtest_lazy, ctkPluginFwTestLazyPlugin)
@@ -56,6 +56,9 @@
   {
     Q_D(ctkPlugin);
 
+    // Lazy activations may be triggered from other threads
+    QMutexLocker lock(&d->activationLock);
+
     if (d->state == UNINSTALLED)
     {
       throw std::logic_error("ctkPlugin is uninstalled");
@@ -65,7 +68,6 @@
     // activation.
 
     //TODO 1: If activating or deactivating, wait a litle
-    // we don't use mutliple threads to start plugins for now
     //waitOnActivation(lock, "ctkPlugin::start", false);
 
     //2: start() is idempotent, i.e., nothing to do when already started
@@ -87,11 +89,7 @@
     //only register if we are not already in the STARTING state
     if (d->state != STARTING)
     {
-      QByteArray serviceDescriptor = getResource("servicedescriptor.xml");
-      if (!serviceDescriptor.isEmpty())
-      {
-        d->fwCtx->services.registerService(d, serviceDescriptor);
-      }
+      d->registerServiceDescriptor();
     }
 
     //6: Eager?
@@ -99,7 +97,10 @@
     {
       if (STARTING == d->state) return;
       d->state = STARTING;
-      d->pluginContext = new ctkPluginContext(this->d_func());
+      if (!d->pluginContext)
+      {
+        d->pluginContext = new ctkPluginContext(this->d_func());
+      }
       ctkPluginEvent pluginEvent(ctkPluginEvent::LAZY_ACTIVATION, this);
       d->fwCtx->listeners.emitPluginChanged(pluginEvent);
     }
@@ -167,7 +168,14 @@
   QByteArray ctkPlugin::getResource(const QString& path) const
   {
     Q_D(const ctkPlugin);
-    return d->archive->getPluginResource(path);
+    // The archive returns a view on its memory mapped resource cache,
+    // which is unmapped when the plugin is uninstalled
+    const QByteArray resource = d->archive->getPluginResource(path);
+    if (resource.isNull())
+    {
+      return resource;
+    }
+    return QByteArray(resource.constData(), resource.size());
   }
 
   ctkVersion ctkPlugin::getVersion() const
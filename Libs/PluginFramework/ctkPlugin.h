@@ -560,6 +560,9 @@ public:
    * begin with &quot;/&quot;. A path value of &quot;/&quot; indicates the
    * root of this plugin.
    * <p>
+   * The returned byte array is a copy owned by the caller and stays
+   * valid after this plugin is uninstalled.
+   * <p>
    *
    * @param path The path name of the resource.
    * @return A QString to the resource, or a null QString if no resource could be
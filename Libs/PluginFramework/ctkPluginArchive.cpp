@@ -26,6 +26,7 @@
 
 #include <QStringList>
 #include <QFile>
+#include <QMutexLocker>
 
 
   const QString ctkPluginArchive::AUTOSTART_SETTING_STOPPED("stopped");
@@ -39,6 +40,17 @@
                   location(pluginLocation), localPluginPath(localPluginPath),
                   storage(pluginStorage)
   {
+    // Extract the resources only if the cache is missing or outdated
+    const QString cachePath = storage->getResourceCachePath(localPluginPath);
+    if (!resources.open(cachePath, localPluginPath))
+    {
+      ctkPluginResourceCache::write(localPluginPath, cachePath);
+      if (!resources.open(cachePath, localPluginPath))
+      {
+        throw ctkPluginException(QString("Could not open resource cache: ") + cachePath);
+      }
+    }
+
     QByteArray manifestResource = this->getPluginResource("META-INF/MANIFEST.MF");
     if (manifestResource.isEmpty())
     {
@@ -47,6 +59,16 @@
     manifest.read(manifestResource);
   }
 
+  ctkPluginArchive::ctkPluginArchive(ctkPluginStorage* pluginStorage,
+                const QUrl& pluginLocation, const QString& localPluginPath,
+                int pluginId, const ctkPluginManifest& pluginManifest)
+                  : autostartSetting(-1), id(pluginId), lastModified(0),
+                  location(pluginLocation), localPluginPath(localPluginPath),
+                  manifest(pluginManifest), storage(pluginStorage)
+  {
+
+  }
+
   QString ctkPluginArchive::getAttribute(const QString& key) const
   {
     return manifest.getAttribute(key);
@@ -57,6 +79,11 @@
     return manifest.getMainAttributes();
   }
 
+  const ctkPluginManifest& ctkPluginArchive::getManifest() const
+  {
+    return manifest;
+  }
+
   int ctkPluginArchive::getPluginId() const
   {
     return id;
@@ -74,12 +101,36 @@
 
   QByteArray ctkPluginArchive::getPluginResource(const QString& component) const
   {
-    return storage->getPluginResource(getPluginId(), component);
+    return getResources().getResource(component);
   }
 
   QStringList ctkPluginArchive::findResourcesPath(const QString& path) const
   {
-    return storage->findResourcesPath(getPluginId(), path);
+    return getResources().findResourcesPath(path);
+  }
+
+  const ctkPluginResourceCache& ctkPluginArchive::getResources() const
+  {
+    QMutexLocker lock(&resourcesLock);
+    if (!resources.isOpen())
+    {
+      const QString cachePath = storage->getResourceCachePath(localPluginPath);
+      if (!resources.open(cachePath, localPluginPath))
+      {
+        // The library changed after the snapshot was validated
+        try
+        {
+          ctkPluginResourceCache::write(localPluginPath, cachePath);
+        }
+        catch (const ctkPluginException& exc)
+        {
+          qWarning() << exc;
+          return resources;
+        }
+        resources.open(cachePath, localPluginPath);
+      }
+    }
+    return resources;
   }
 
   int ctkPluginArchive::getStartLevel() const
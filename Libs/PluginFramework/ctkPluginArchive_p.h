@@ -25,8 +25,12 @@
 #include <QString>
 #include <QHash>
 #include <QUrl>
+#include <QMutex>
+
+#include "CTKPluginFrameworkExport.h"
 
 #include "ctkPluginManifest_p.h"
+#include "ctkPluginResourceCache_p.h"
 
 // Qt forward declarations
 class QIODevice;
@@ -40,7 +44,7 @@ class ctkPluginStorage;
 * Class for managing plugin data.
 *
 */
-class ctkPluginArchive {
+class CTK_PLUGINFW_EXPORT ctkPluginArchive {
 
 public:
 
@@ -70,8 +74,16 @@ qtimestamp lastModified;
 QUrl location;
 QString localPluginPath;
 ctkPluginManifest manifest;
+mutable ctkPluginResourceCache resources;
+mutable QMutex resourcesLock;
 ctkPluginStorage* storage;
 
+/**
+ * Returns the resource cache, which is opened on first use
+ * if the archive was created from a startup snapshot.
+ */
+const ctkPluginResourceCache& getResources() const;
+
 public:
 
 /**
@@ -81,6 +93,15 @@ public:
 ctkPluginArchive(ctkPluginStorage* pluginStorage, const QUrl& pluginLocation,
 	      const QString& localPluginPath, int pluginId);
 
+/**
+ * Construct a plugin archive from the already parsed \a pluginManifest,
+ * see ctkPluginDatabaseSnapshot. The resource cache is only opened
+ * when a resource is requested.
+ */
+ctkPluginArchive(ctkPluginStorage* pluginStorage, const QUrl& pluginLocation,
+	      const QString& localPluginPath, int pluginId,
+	      const ctkPluginManifest& pluginManifest);
+
 /**
  * Get an attribute from the manifest of a plugin.
  *
@@ -96,6 +117,11 @@ QString getAttribute(const QString& key) const;
  */
 QHash<QString,QString> getUnlocalizedAttributes() const;
 
+/**
+ * @returns the parsed manifest of the plugin
+ */
+const ctkPluginManifest& getManifest() const;
+
 
 /**
  * Get plugin identifier for this plugin archive.
@@ -125,6 +151,9 @@ QUrl getPluginLocation() const;
  * Get a Qt resource as a byte array from a plugin. The resource
  * is cached and may be aquired even if the plugin is not active.
  *
+ * The byte array shares the memory mapped resource cache of this
+ * archive and is only valid as long as the archive exists.
+ *
  * @param component Resource to get the byte array from.
  * @return QByteArray to the entry (empty if it doesn't exist).
  */
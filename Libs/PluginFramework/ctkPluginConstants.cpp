@@ -25,6 +25,7 @@ const QString	PluginConstants::SYSTEM_PLUGIN_LOCATION = "System Plugin";
 const QString	PluginConstants::SYSTEM_PLUGIN_SYMBOLICNAME = "system.plugin";
 
 const QString PluginConstants::FRAMEWORK_STORAGE = "org.commontk.pluginfw.storage";
+const QString PluginConstants::FRAMEWORK_START_THREADS = "org.commontk.pluginfw.start.threads";
 
 const QString	PluginConstants::PLUGIN_SYMBOLICNAME = "Plugin-SymbolicName";
 const QString PluginConstants::PLUGIN_COPYRIGHT = "Plugin-Copyright";
@@ -57,6 +57,25 @@ struct CTK_PLUGINFW_EXPORT PluginConstants {
    */
   static const QString FRAMEWORK_STORAGE; // = "org.commontk.pluginfw.storage"
 
+  /**
+   * Specifies the number of threads used to start the plugins which are
+   * started on launch of the framework. Plugins are started by levels of
+   * their Require-Plugin dependencies, and the plugins of one level are
+   * started concurrently. Their activators must then allow to be started
+   * outside of the framework thread.
+   * <p>
+   * Once a plugin is started in a worker thread, its activator and the
+   * service objects it registered, with their parents, are moved to the
+   * framework thread. Other QObjects created by
+   * <code>ctkPluginActivator::start()</code> keep the affinity of the
+   * worker thread, which has no event loop: they must be children of the
+   * activator or of a registered service, or be created later.
+   * <p>
+   * If this property is not set, the plugins are started one after the
+   * other in the framework thread.
+   */
+  static const QString FRAMEWORK_START_THREADS; // = "org.commontk.pluginfw.start.threads"
+
 
   /**
    * Manifest header identifying the plugin's symbolic name.
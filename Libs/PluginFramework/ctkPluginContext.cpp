@@ -96,6 +96,13 @@
     return d->plugin->fwCtx->plugins->install(location, in);
   }
 
+  QList<ctkPlugin*> ctkPluginContext::installPlugins(const QList<QUrl>& locations, int threads)
+  {
+    Q_D(ctkPluginContext);
+    d->isPluginContextValid();
+    return d->plugin->fwCtx->plugins->install(locations, threads);
+  }
+
   ctkServiceRegistration* ctkPluginContext::registerService(const QStringList& clazzes, QObject* service, const ServiceProperties& properties)
   {
     Q_D(ctkPluginContext);
@@ -339,6 +339,27 @@
 
     ctkPlugin* installPlugin(const QUrl& location, QIODevice* in = 0);
 
+    /**
+     * Installs several plugins from the specified locations at once.
+     *
+     * This is faster than calling installPlugin() for each location: the
+     * plugin libraries are read on a thread pool and all plugins are
+     * recorded in one database transaction. Plugins which require other
+     * plugins of the list get higher plugin ids.
+     *
+     * A plugin which cannot be installed does not abort the others, it is
+     * reported by a {@link ctkPluginFrameworkEvent::ERROR} event instead.
+     *
+     * @param locations The locations of the plugins to install.
+     * @param threads The number of worker threads, <code>0</code> for
+     *        one per processor core.
+     * @return The installed plugins, including those which were already
+     *         installed.
+     * @throws ctkPluginException If the plugins could not be recorded.
+     * @throws std::logic_error If this ctkPluginContext is no longer valid.
+     */
+    QList<ctkPlugin*> installPlugins(const QList<QUrl>& locations, int threads = 0);
+
 
     bool connectPluginListener(const QObject* receiver, const char* method, Qt::ConnectionType type = Qt::QueuedConnection);
 
@@ -29,6 +29,8 @@
 #include "ctkServiceException.h"
 
 #include <QApplication>
+#include <QCryptographicHash>
+#include <QFile>
 #include <QFileInfo>
 #include <QUrl>
 #include <QServiceManager>
@@ -40,8 +42,16 @@
 
 //database table names
 #define PLUGINS_TABLE "Plugins"
+
+//legacy table which cached the plugin resources as BLOBs
 #define PLUGIN_RESOURCES_TABLE "PluginResources"
 
+//suffix of the resource cache directory, see getResourceCachePath()
+#define PLUGINDATABASE_RESOURCES_SUFFIX "_resources"
+
+//suffix of the startup snapshot, see getSnapshotPath()
+#define PLUGINDATABASE_SNAPSHOT_SUFFIX ".snapshot"
+
 //separator
 #define PLUGINDATABASE_PATH_SEPARATOR "//"
 
@@ -60,7 +70,8 @@ enum TBindIndexes
 };
 
 ctkPluginDatabase::ctkPluginDatabase(ctkPluginStorage* storage)
-:m_isDatabaseOpen(false), m_inTransaction(false), m_PluginStorage(storage)
+:m_isDatabaseOpen(false), m_inTransaction(false), m_PluginStorage(storage),
+ m_isSnapshotValid(false)
 {
 }
 
@@ -150,6 +161,13 @@ void ctkPluginDatabase::open()
   }
   query.finish();
 
+  //An up to date snapshot implies that the tables exist and
+  //that no plugin library changed since the last launch
+  m_isSnapshotValid = m_snapshot.read(getSnapshotPath(), path);
+  if (m_isSnapshotValid)
+  {
+    return;
+  }
 
   //Check database structure (tables) and recreate tables if neccessary
   //If one of the tables is missing remove all tables and recreate them
@@ -159,6 +177,8 @@ void ctkPluginDatabase::open()
     if (dropTables())
     {
       createTables();
+      clearResourceCache();
+      invalidateSnapshot();
     }
     else
     {
@@ -267,156 +287,131 @@ ctkPluginArchive* ctkPluginDatabase::insertPlugin(const QUrl& location, const QS
 {
   checkConnection();
 
-  // Assemble the data for the sql record
-  QFileInfo fileInfo(localPath);
-  const QString lastModified = fileInfo.lastModified().toString(Qt::ISODate);
-
-  QString resourcePrefix = fileInfo.baseName();
-  if (resourcePrefix.startsWith("lib"))
-  {
-    resourcePrefix = resourcePrefix.mid(3);
-  }
-  resourcePrefix.replace("_", ".");
-
-  resourcePrefix = QString(":/") + resourcePrefix + "/";
-
   QSqlDatabase database = QSqlDatabase::database(m_connectionName);
   QSqlQuery query(database);
 
   beginTransaction(&query, Write);
 
-  QString statement = "INSERT INTO Plugins(Location,LocalPath,SymbolicName,Version,State,Timestamp) VALUES(?,?,?,?,?,?)";
-
-  QList<QVariant> bindValues;
-  bindValues.append(location.toString());
-  bindValues.append(localPath);
-  bindValues.append(QString("na"));
-  bindValues.append(QString("na"));
-  bindValues.append(ctkPlugin::INSTALLED);
-  bindValues.append(lastModified);
-
-  qlonglong pluginId = -1;
+  ctkPluginArchive* archive = 0;
   try
   {
-    executeQuery(&query, statement, bindValues);
-    QVariant lastId = query.lastInsertId();
-    if (lastId.isValid())
-    {
-      pluginId = lastId.toLongLong();
-    }
+    archive = insertPluginRecord(&query, location, localPath);
+    commitTransaction(&query);
+    invalidateSnapshot();
   }
   catch (...)
   {
+    delete archive;
     rollbackTransaction(&query);
     throw;
   }
 
-  // Load the plugin and cache the resources
-  QPluginLoader pluginLoader;
-  pluginLoader.setFileName(localPath);
-  if (!pluginLoader.load())
+  if (!createArchive)
   {
-    rollbackTransaction(&query);
-    throw ctkPluginException(QString("The plugin could not be loaded: %1").arg(localPath));
+    delete archive;
+    archive = 0;
   }
 
-  QDirIterator dirIter(resourcePrefix, QDirIterator::Subdirectories);
-  while (dirIter.hasNext())
-  {
-    QString resourcePath = dirIter.next();
-    if (QFileInfo(resourcePath).isDir()) continue;
+  return archive;
+}
 
-    QFile resourceFile(resourcePath);
-    resourceFile.open(QIODevice::ReadOnly);
-    QByteArray resourceData = resourceFile.readAll();
-    resourceFile.close();
+QList<ctkPluginArchive*> ctkPluginDatabase::insertPlugins(const QList<QUrl>& locations, const QStringList& localPaths,
+                                                         QStringList* errors)
+{
+  Q_ASSERT(locations.size() == localPaths.size());
 
-    statement = "INSERT INTO PluginResources(PluginID, ResourcePath, Resource) VALUES(?,?,?)";
-    bindValues.clear();
-    bindValues.append(QVariant::fromValue<qlonglong>(pluginId));
-    bindValues.append(resourcePath.mid(resourcePrefix.size()-1));
-    bindValues.append(resourceData);
+  checkConnection();
 
-    try
-    {
-      executeQuery(&query, statement, bindValues);
-    }
-    catch (...)
-    {
-      rollbackTransaction(&query);
-      throw;
-    }
-  }
+  QSqlDatabase database = QSqlDatabase::database(m_connectionName);
+  QSqlQuery query(database);
 
-  pluginLoader.unload();
+  beginTransaction(&query, Write);
 
+  QList<ctkPluginArchive*> archives;
   try
   {
-    ctkPluginArchive* archive = new ctkPluginArchive(m_PluginStorage, location, localPath,
-                                               pluginId);;
-
-    statement = "UPDATE Plugins SET SymbolicName=?,Version=? WHERE ID=?";
-    QString versionString = archive->getAttribute(PluginConstants::PLUGIN_VERSION);
-    bindValues.clear();
-    bindValues.append(archive->getAttribute(PluginConstants::PLUGIN_SYMBOLICNAME));
-    bindValues.append(versionString.isEmpty() ? "0.0.0" : versionString);
-    bindValues.append(pluginId);
-
-    if (!createArchive)
+    for (int i = 0; i < locations.size(); ++i)
     {
-      delete archive;
-      archive = 0;
+      // A savepoint per plugin undoes the rows of a failed plugin only
+      executeQuery(&query, "SAVEPOINT InsertPlugin");
+      ctkPluginArchive* archive = 0;
+      QString error;
+      try
+      {
+        archive = insertPluginRecord(&query, locations.at(i), localPaths.at(i));
+      }
+      catch (const std::exception& e)
+      {
+        error = e.what();
+        executeQuery(&query, "ROLLBACK TO SAVEPOINT InsertPlugin");
+      }
+      executeQuery(&query, "RELEASE SAVEPOINT InsertPlugin");
+      archives.append(archive);
+      if (errors)
+      {
+        errors->append(error);
+      }
     }
-
-    executeQuery(&query, statement, bindValues);
-
     commitTransaction(&query);
-
-    return archive;
+    invalidateSnapshot();
   }
   catch (...)
   {
-      rollbackTransaction(&query);
-      throw;
+    qDeleteAll(archives);
+    rollbackTransaction(&query);
+    throw;
   }
 
+  return archives;
 }
 
-QStringList ctkPluginDatabase::findResourcesPath(long pluginId, const QString& path) const
+ctkPluginArchive* ctkPluginDatabase::insertPluginRecord(QSqlQuery* query, const QUrl& location, const QString& localPath)
 {
-  checkConnection();
-
-  QString statement = "SELECT SUBSTR(ResourcePath,?) FROM PluginResources WHERE PluginID=? AND SUBSTR(ResourcePath,1,?)=?";
+  // Assemble the data for the sql record
+  QFileInfo fileInfo(localPath);
+  const QString lastModified = fileInfo.lastModified().toString(Qt::ISODate);
 
-  QString resourcePath = path.startsWith('/') ? path : QString("/") + path;
-  if (!resourcePath.endsWith('/'))
-    resourcePath += "/";
+  QString statement = "INSERT INTO Plugins(Location,LocalPath,SymbolicName,Version,State,Timestamp) VALUES(?,?,?,?,?,?)";
 
   QList<QVariant> bindValues;
-  bindValues.append(resourcePath.size()+1);
-  bindValues.append(qlonglong(pluginId));
-  bindValues.append(resourcePath.size());
-  bindValues.append(resourcePath);
+  bindValues.append(location.toString());
+  bindValues.append(localPath);
+  bindValues.append(QString("na"));
+  bindValues.append(QString("na"));
+  bindValues.append(ctkPlugin::INSTALLED);
+  bindValues.append(lastModified);
 
-  QSqlDatabase database = QSqlDatabase::database(m_connectionName);
-  QSqlQuery query(database);
+  qlonglong pluginId = -1;
+  executeQuery(query, statement, bindValues);
+  QVariant lastId = query->lastInsertId();
+  if (lastId.isValid())
+  {
+    pluginId = lastId.toLongLong();
+  }
 
-  executeQuery(&query, statement, bindValues);
+  // Extracts the plugin resources into the resource cache,
+  // unless the cache is up to date
+  ctkPluginArchive* archive = new ctkPluginArchive(m_PluginStorage, location, localPath,
+                                             pluginId);
 
-  QStringList paths;
-  while (query.next())
-  {
-    QString currPath = query.value(EBindIndex).toString();
-    int slashIndex = currPath.indexOf('/');
-    if (slashIndex > 0)
-    {
-      currPath = currPath.left(slashIndex+1);
-    }
+  statement = "UPDATE Plugins SET SymbolicName=?,Version=? WHERE ID=?";
+  QString versionString = archive->getAttribute(PluginConstants::PLUGIN_VERSION);
+  bindValues.clear();
+  bindValues.append(archive->getAttribute(PluginConstants::PLUGIN_SYMBOLICNAME));
+  bindValues.append(versionString.isEmpty() ? "0.0.0" : versionString);
+  bindValues.append(pluginId);
 
-    paths << currPath;
+  try
+  {
+    executeQuery(query, statement, bindValues);
+  }
+  catch (...)
+  {
+    delete archive;
+    throw;
   }
 
-  return paths;
+  return archive;
 }
 
 void ctkPluginDatabase::removeArchive(const ctkPluginArchive *pa)
@@ -432,6 +427,7 @@ void ctkPluginDatabase::removeArchive(const ctkPluginArchive *pa)
   bindValues.append(pa->getPluginId());
 
   executeQuery(&query, statement, bindValues);
+  invalidateSnapshot();
 }
 
 void ctkPluginDatabase::executeQuery(QSqlQuery *query, const QString &statement, const QList<QVariant> &bindValues) const
@@ -550,28 +546,52 @@ QString ctkPluginDatabase::getDatabasePath() const
 }
 
 
-QByteArray ctkPluginDatabase::getPluginResource(long pluginId, const QString& res) const
+QString ctkPluginDatabase::getResourceCachePath(const QString& localPath) const
 {
-  checkConnection();
+  QFileInfo dbFileInfo(m_databasePath);
+  const QByteArray pathHash = QCryptographicHash::hash(localPath.toUtf8(), QCryptographicHash::Md5).toHex();
+  return dbFileInfo.dir().filePath(dbFileInfo.completeBaseName() + PLUGINDATABASE_RESOURCES_SUFFIX
+                                   + "/" + QString(pathHash) + ".res");
+}
 
-  QSqlDatabase database = QSqlDatabase::database(m_connectionName);
-  QSqlQuery query(database);
 
-  QString statement = "SELECT Resource FROM PluginResources WHERE PluginID=? AND ResourcePath=?";
+void ctkPluginDatabase::clearResourceCache()
+{
+  QFileInfo dbFileInfo(m_databasePath);
+  QDir cacheDir(dbFileInfo.dir().filePath(dbFileInfo.completeBaseName() + PLUGINDATABASE_RESOURCES_SUFFIX));
+  foreach(const QString& cacheFile, cacheDir.entryList(QStringList("*.res*"), QDir::Files))
+  {
+    cacheDir.remove(cacheFile);
+  }
+}
+
 
-  QString resourcePath = res.startsWith('/') ? res : QString("/") + res;
-  QList<QVariant> bindValues;
-  bindValues.append(qlonglong(pluginId));
-  bindValues.append(resourcePath);
+QString ctkPluginDatabase::getSnapshotPath() const
+{
+  QFileInfo dbFileInfo(m_databasePath);
+  return dbFileInfo.dir().filePath(dbFileInfo.completeBaseName() + PLUGINDATABASE_SNAPSHOT_SUFFIX);
+}
+
+
+void ctkPluginDatabase::invalidateSnapshot()
+{
+  m_isSnapshotValid = false;
+  m_snapshot.records.clear();
+  QFile::remove(getSnapshotPath());
+}
 
-  executeQuery(&query, statement, bindValues);
 
-  if (query.next())
+void ctkPluginDatabase::writeSnapshot(const QList<ctkPluginArchive*>& archives)
+{
+  if (m_isSnapshotValid)
+    return;
+
+  if (!ctkPluginDatabaseSnapshot::write(getSnapshotPath(), m_databasePath, archives))
   {
-    return query.value(EBindIndex).toByteArray();
+    qWarning() << "ctkPluginFramework:- Could not write startup snapshot:" << getSnapshotPath();
+    return;
   }
-
-  return QByteArray();
+  m_isSnapshotValid = true;
 }
 
 
@@ -601,21 +621,6 @@ void ctkPluginDatabase::createTables()
       throw;
     }
 
-    statement = "CREATE TABLE PluginResources("
-                "PluginID INTEGER NOT NULL,"
-                "ResourcePath TEXT NOT NULL, "
-                "Resource BLOB NOT NULL,"
-                "FOREIGN KEY(PluginID) REFERENCES Plugins(ID) ON DELETE CASCADE)";
-    try
-    {
-      executeQuery(&query, statement);
-    }
-    catch (...)
-    {
-      rollbackTransaction(&query);
-      throw;
-    }
-
     try
     {
       commitTransaction(&query);
@@ -633,8 +638,10 @@ bool ctkPluginDatabase::checkTables() const
 {
   bool bTables(false);
   QStringList tables = QSqlDatabase::database(m_connectionName).tables();
+  // Databases with resource BLOBs are recreated, their plugins
+  // have no resource cache
   if (tables.contains(PLUGINS_TABLE)
-      && tables.contains(PLUGIN_RESOURCES_TABLE))
+      && !tables.contains(PLUGIN_RESOURCES_TABLE))
   {
     bTables = true;
   }
@@ -648,7 +655,7 @@ bool ctkPluginDatabase::dropTables()
   QSqlDatabase database = QSqlDatabase::database(m_connectionName);
   QSqlQuery query(database);
   QStringList expectedTables;
-  expectedTables << PLUGINS_TABLE << PLUGIN_RESOURCES_TABLE;
+  expectedTables << PLUGIN_RESOURCES_TABLE << PLUGINS_TABLE;
 
   if (database.tables().count() > 0)
   {
@@ -669,15 +676,15 @@ bool ctkPluginDatabase::dropTables()
           throw;
         }
       }
-      try
-      {
-        commitTransaction(&query);
-      }
-      catch (...)
-      {
-        rollbackTransaction(&query);
-        throw;
-      }
+    }
+    try
+    {
+      commitTransaction(&query);
+    }
+    catch (...)
+    {
+      rollbackTransaction(&query);
+      throw;
     }
   }
   return true;
@@ -763,6 +770,17 @@ QList<ctkPluginArchive*> ctkPluginDatabase::getPluginArchives() const
 {
   checkConnection();
 
+  QList<ctkPluginArchive*> archives;
+  if (m_isSnapshotValid)
+  {
+    foreach(const ctkPluginDatabaseSnapshot::Record& record, m_snapshot.records)
+    {
+      archives.append(new ctkPluginArchive(m_PluginStorage, record.location, record.localPath,
+                                           record.id, record.manifest));
+    }
+    return archives;
+  }
+
   QSqlQuery query(QSqlDatabase::database(m_connectionName));
   QString statement("SELECT ID, Location, LocalPath FROM Plugins WHERE State != ?");
   QList<QVariant> bindValues;
@@ -770,7 +788,6 @@ QList<ctkPluginArchive*> ctkPluginDatabase::getPluginArchives() const
 
   executeQuery(&query, statement, bindValues);
 
-  QList<ctkPluginArchive*> archives;
   while (query.next())
   {
     const long id = query.value(EBindIndex).toLongLong();
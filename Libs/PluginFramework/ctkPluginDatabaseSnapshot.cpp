@@ -0,0 +1,140 @@
+/*=============================================================================
+
+  Library: CTK
+
+  Copyright (c) 2010 German Cancer Research Center,
+    Division of Medical and Biological Informatics
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#include "ctkPluginDatabaseSnapshot_p.h"
+
+#include "ctkPluginArchive_p.h"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+
+// "CTKS"
+#define SNAPSHOT_MAGIC 0x43544b53
+#define SNAPSHOT_VERSION 1
+
+
+  /**
+   * Size and modification time identify a version of a file, as for
+   * ctkPluginResourceCache
+   */
+  static void writeFileVersion(QDataStream& out, const QString& path)
+  {
+    QFileInfo info(path);
+    out << info.size() << info.lastModified().toTime_t();
+  }
+
+  static bool checkFileVersion(QDataStream& in, const QString& path)
+  {
+    qint64 size = 0;
+    uint lastModified = 0;
+    in >> size >> lastModified;
+    QFileInfo info(path);
+    return in.status() == QDataStream::Ok && info.exists() &&
+        size == info.size() && lastModified == info.lastModified().toTime_t();
+  }
+
+  bool ctkPluginDatabaseSnapshot::read(const QString& snapshotPath, const QString& databasePath)
+  {
+    records.clear();
+
+    QFile snapshotFile(snapshotPath);
+    if (!snapshotFile.open(QIODevice::ReadOnly))
+    {
+      return false;
+    }
+    const QByteArray snapshot = snapshotFile.readAll();
+    snapshotFile.close();
+
+    QDataStream in(snapshot);
+    quint32 magic = 0;
+    quint32 version = 0;
+    in >> magic >> version;
+    if (magic != SNAPSHOT_MAGIC || version != SNAPSHOT_VERSION ||
+        !checkFileVersion(in, databasePath))
+    {
+      return false;
+    }
+
+    quint32 count = 0;
+    in >> count;
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i)
+    {
+      Record record;
+      qint64 id = 0;
+      QString location;
+      in >> id >> location >> record.localPath;
+      if (!checkFileVersion(in, record.localPath))
+      {
+        records.clear();
+        return false;
+      }
+      in >> record.manifest;
+      record.id = static_cast<long>(id);
+      record.location = QUrl(location);
+      records.append(record);
+    }
+
+    if (in.status() != QDataStream::Ok)
+    {
+      records.clear();
+      return false;
+    }
+    return true;
+  }
+
+  bool ctkPluginDatabaseSnapshot::write(const QString& snapshotPath, const QString& databasePath,
+                                        const QList<ctkPluginArchive*>& archives)
+  {
+    QByteArray snapshot;
+    QDataStream out(&snapshot, QIODevice::WriteOnly);
+    out << quint32(SNAPSHOT_MAGIC) << quint32(SNAPSHOT_VERSION);
+    writeFileVersion(out, databasePath);
+
+    out << quint32(archives.size());
+    foreach (const ctkPluginArchive* pa, archives)
+    {
+      out << qint64(pa->getPluginId()) << pa->getPluginLocation().toString() << pa->getLibLocation();
+      writeFileVersion(out, pa->getLibLocation());
+      out << pa->getManifest();
+    }
+
+    // Never leave a truncated snapshot
+    const QString partPath = snapshotPath + ".part";
+    QFile snapshotFile(partPath);
+    if (!snapshotFile.open(QIODevice::WriteOnly | QIODevice::Truncate) ||
+        snapshotFile.write(snapshot) != snapshot.size() || !snapshotFile.flush())
+    {
+      snapshotFile.remove();
+      return false;
+    }
+    snapshotFile.close();
+
+    QFile::remove(snapshotPath);
+    if (!QFile::rename(partPath, snapshotPath))
+    {
+      QFile::remove(partPath);
+      return false;
+    }
+    return true;
+
+}
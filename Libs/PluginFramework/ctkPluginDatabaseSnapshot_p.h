@@ -0,0 +1,80 @@
+/*=============================================================================
+
+  Library: CTK
+
+  Copyright (c) 2010 German Cancer Research Center,
+    Division of Medical and Biological Informatics
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CTKPLUGINDATABASESNAPSHOT_P_H
+#define CTKPLUGINDATABASESNAPSHOT_P_H
+
+#include <QList>
+#include <QUrl>
+
+#include "CTKPluginFrameworkExport.h"
+
+#include "ctkPluginManifest_p.h"
+
+// CTK class forward declarations
+class ctkPluginArchive;
+
+
+  /**
+   * Binary copy of the plugin archive records of the plugin database,
+   * including the parsed manifests, which is read in one go when the
+   * framework starts.
+   *
+   * The snapshot is only valid as long as neither the database file nor
+   * any of the plugin libraries changed since it was written. In that
+   * case the database needs no consistency checks and the archives need
+   * neither SQL nor manifest parsing.
+   */
+  class CTK_PLUGINFW_EXPORT ctkPluginDatabaseSnapshot {
+
+  public:
+
+    struct Record
+    {
+      long id;
+      QUrl location;
+      QString localPath;
+      ctkPluginManifest manifest;
+    };
+
+    /**
+     * Read the snapshot file \a snapshotPath written for the database
+     * \a databasePath. Fails if the snapshot is missing, corrupted or
+     * outdated.
+     */
+    bool read(const QString& snapshotPath, const QString& databasePath);
+
+    /**
+     * Write the plugin archives \a archives of the database \a databasePath
+     * to the snapshot file \a snapshotPath.
+     */
+    static bool write(const QString& snapshotPath, const QString& databasePath,
+                      const QList<ctkPluginArchive*>& archives);
+
+    /**
+     * The records of the last successful read(), in plugin id order
+     */
+    QList<Record> records;
+
+  };
+
+
+#endif // CTKPLUGINDATABASESNAPSHOT_P_H
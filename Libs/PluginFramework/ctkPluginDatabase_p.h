@@ -25,6 +25,7 @@
 #include <QtSql>
 #include <QList>
 
+#include "ctkPluginDatabaseSnapshot_p.h"
 
 
 // CTK class forward declarations
@@ -74,28 +75,13 @@ class ctkPluginDatabase {
     QString getDatabasePath() const;
 
     /**
-     * Get a Qt resource cached in the database. The resource path \a res
-     * must be relative to the plugin specific resource prefix, but may
-     * start with a '/'.
-     *
-     * @param pluginId The id of the plugin from which to get the resource
-     * @param res The path to the resource in the plugin
-     * @return The byte array of the cached resource
-     *
-     * @throws ctkPluginDatabaseException
-     */
-    QByteArray getPluginResource(long pluginId, const QString& res) const;
-
-    /**
-     * Get a list of resource entries under the given path.
-     *
-     * @param pluginId The id of the plugin from which to get the entries
-     * @param path A resource path relative to the plugin specific resource prefix.
-     * @return A QStringList containing the cached resource entries.
-     *
-     * @throws ctkPluginDatabaseException
+     * Returns the path of the resource cache file of the plugin library
+     * \a localPath. The cache files are kept in a directory next to
+     * the database file, see ctkPluginResourceCache. They are named after
+     * the library path, so that resources can be extracted before the
+     * plugin has an id.
      */
-    QStringList findResourcesPath(long pluginId, const QString& path) const;
+    QString getResourceCachePath(const QString& localPath) const;
 
     /**
      * Inserts a new plugin into the database. This method assumes that
@@ -110,6 +96,28 @@ class ctkPluginDatabase {
      */
     ctkPluginArchive* insertPlugin(const QUrl& location, const QString& localPath, bool createArchive = true);
 
+    /**
+     * Inserts several new plugins into the database, in one transaction.
+     * The plugins get increasing ids in the order of \a locations. A
+     * plugin which cannot be inserted is skipped, the others are still
+     * inserted.
+     *
+     * Inserting is fastest if the resource caches of the plugins are
+     * already up to date, see ctkPluginResourceCache.
+     *
+     * @param locations The URLs to the plugins.
+     * @param localPaths The paths to the plugin libraries on the local file system.
+     * @param errors If not null, the reason why each plugin was skipped is
+     *        appended to it, an empty string for the inserted plugins.
+     * @return A new ctkPluginArchive instance for each plugin, <code>0</code>
+     *         for the skipped plugins.
+     *
+     * @throws ctkPluginDatabaseException If the transaction fails, then no
+     *         plugin is inserted.
+     */
+    QList<ctkPluginArchive*> insertPlugins(const QList<QUrl>& locations, const QStringList& localPaths,
+                                           QStringList* errors = 0);
+
     /**
      * Removes all persisted data related to the given ctkPluginArchive.
      *
@@ -125,6 +133,17 @@ class ctkPluginDatabase {
      */
     QList<ctkPluginArchive*> getPluginArchives() const;
 
+    /**
+     * Writes the startup snapshot of the plugin archives \a archives,
+     * unless they were read from a valid snapshot in the first place.
+     * The next open() skips the table checks and the timestamp comparison
+     * of updateDB() if neither the database nor a plugin library changed,
+     * and getPluginArchives() reads no SQL and parses no manifest.
+     *
+     * @see ctkPluginDatabaseSnapshot
+     */
+    void writeSnapshot(const QList<ctkPluginArchive*>& archives);
+
 
   private:
 
@@ -138,6 +157,15 @@ class ctkPluginDatabase {
     void createTables();
     bool dropTables();
 
+    /**
+     * Helper method that inserts the row of a new plugin within the
+     * current transaction and creates its ctkPluginArchive.
+     *
+     * @throws ctkPluginDatabaseException
+     * @throws ctkPluginException
+     */
+    ctkPluginArchive* insertPluginRecord(QSqlQuery* query, const QUrl& location, const QString& localPath);
+
     /**
      * Helper method that checks if all the expected tables exist in the database.
      *
@@ -145,6 +173,21 @@ class ctkPluginDatabase {
      */
     bool checkTables() const;
 
+    /**
+     * Removes all resource cache files, used when the tables are recreated.
+     */
+    void clearResourceCache();
+
+    /**
+     * Returns the path of the startup snapshot, next to the database file.
+     */
+    QString getSnapshotPath() const;
+
+    /**
+     * Removes the startup snapshot, used whenever the plugin records change.
+     */
+    void invalidateSnapshot();
+
     /**
      * Checks the database connection.
      *
@@ -201,6 +244,8 @@ class ctkPluginDatabase {
     bool m_isDatabaseOpen;
     bool m_inTransaction;
     ctkPluginStorage* m_PluginStorage;
+    ctkPluginDatabaseSnapshot m_snapshot;
+    bool m_isSnapshotValid;
 };
 
 
@@ -63,7 +63,6 @@
     QStringList pluginsToStart;
     {
       QMutexLocker sync(&d->lock);
-      // TODO: parallel start
       //waitOnActivation(lock, "ctkPluginFramework::start", true);
 
       switch (d->state)
@@ -84,26 +83,15 @@
     }
 
     // Start plugins according to their autostart setting.
+    QList<ctkPlugin*> plugins;
     QStringListIterator i(pluginsToStart);
     while (i.hasNext())
     {
       ctkPlugin* p = d->fwCtx->plugins->getPlugin(i.next());
-      try {
-        const int autostartSetting = p->d_func()->archive->getAutostartSetting();
-        // Launch must not change the autostart setting of a plugin
-        StartOptions option = ctkPlugin::START_TRANSIENT;
-        if (ctkPlugin::START_ACTIVATION_POLICY == autostartSetting)
-        {
-          // Transient start according to the plugins activation policy.
-          option |= ctkPlugin::START_ACTIVATION_POLICY;
-        }
-        p->start(option);
-      }
-      catch (const ctkPluginException& pe)
-      {
-        d->fwCtx->listeners.frameworkError(p, pe);
-      }
+      if (p) plugins.push_back(p);
     }
+    const int threads = d->fwCtx->props.value(PluginConstants::FRAMEWORK_START_THREADS, 1).toInt();
+    d->fwCtx->plugins->startPlugins(plugins, threads);
 
     {
       QMutexLocker sync(&d->lock);
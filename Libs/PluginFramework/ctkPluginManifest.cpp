@@ -21,6 +21,7 @@
 
 #include "ctkPluginManifest_p.h"
 
+#include <QDataStream>
 #include <QStringList>
 #include <QIODevice>
 #include <QDebug>
@@ -137,5 +138,15 @@
   QStringList ctkPluginManifest::getSections() const
   {
     return sections.keys();
+  }
+
+  QDataStream& operator<<(QDataStream& out, const ctkPluginManifest& manifest)
+  {
+    return out << manifest.mainAttributes << manifest.sections;
+  }
+
+  QDataStream& operator>>(QDataStream& in, ctkPluginManifest& manifest)
+  {
+    return in >> manifest.mainAttributes >> manifest.sections;
 
 }
@@ -24,10 +24,13 @@
 
 #include <QHash>
 
+#include "CTKPluginFrameworkExport.h"
+
+class QDataStream;
 class QIODevice;
 
 
-  class ctkPluginManifest
+  class CTK_PLUGINFW_EXPORT ctkPluginManifest
   {
 
   public:
@@ -45,6 +48,12 @@ class QIODevice;
 
     QStringList getSections() const;
 
+    /**
+     * (De)serialize the parsed attributes, used by ctkPluginDatabaseSnapshot
+     */
+    friend QDataStream& operator<<(QDataStream& out, const ctkPluginManifest& manifest);
+    friend QDataStream& operator>>(QDataStream& in, ctkPluginManifest& manifest);
+
   private:
 
     Attributes mainAttributes;
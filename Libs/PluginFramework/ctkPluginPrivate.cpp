@@ -28,6 +28,9 @@
 #include "ctkPluginFrameworkUtil_p.h"
 #include "ctkPluginActivator.h"
 
+#include <QThread>
+#include <QTime>
+
 
   const ctkPlugin::States ctkPluginPrivate::RESOLVED_FLAGS = ctkPlugin::RESOLVED | ctkPlugin::STARTING | ctkPlugin::ACTIVE | ctkPlugin::STOPPING;
 
@@ -38,8 +41,9 @@
       ctkPluginArchive* pa)
     : q_ptr(&qq), fwCtx(fw), id(pa->getPluginId()),
     location(pa->getPluginLocation().toString()), state(ctkPlugin::INSTALLED),
-    archive(pa), pluginContext(0), pluginActivator(0), pluginLoader(pa->getLibLocation()),
-    lastModified(0), eagerActivation(false), activating(false), deactivating(false)
+    archive(pa), pluginContext(0), pluginActivator(0),
+    lastModified(0), eagerActivation(false), activating(false), deactivating(false),
+    serviceDescriptorRegistered(false), activationTime(-1), activationLock(QMutex::Recursive)
   {
     //TODO
     //checkCertificates(pa);
@@ -69,7 +73,8 @@
       : q_ptr(&qq), fwCtx(fw), id(id), location(loc), symbolicName(sym), version(ver),
       state(ctkPlugin::INSTALLED), archive(0), pluginContext(0),
       pluginActivator(0), lastModified(0),
-      eagerActivation(false), activating(false), deactivating(false)
+      eagerActivation(false), activating(false), deactivating(false),
+    serviceDescriptorRegistered(false), activationTime(-1), activationLock(QMutex::Recursive)
   {
 
   }
@@ -174,8 +179,10 @@
         }
         try
         {
-          //TODO maybe call this in its own thread
+          QTime activationTimer;
+          activationTimer.start();
           start0();
+          activationTime = activationTimer.elapsed();
         }
         catch (...)
         {
@@ -185,6 +192,7 @@
           fwCtx->listeners.emitPluginChanged(ctkPluginEvent(ctkPluginEvent::STOPPING, this->q_func()));
           removePluginResources();
           delete pluginContext;
+          pluginContext = 0;
 
           state = ctkPlugin::RESOLVED;
           // NYI, call outside lock
@@ -206,11 +214,57 @@
       }
   }
 
+  void ctkPluginPrivate::activateLazily()
+  {
+    QMutexLocker lock(&activationLock);
+
+    switch (state)
+    {
+      case ctkPlugin::ACTIVE:
+        return;
+      case ctkPlugin::STARTING:
+        if (activating) return; // activation in progress, e.g. by the activator
+        qDebug() << "lazy activation of #" << this->id;
+        finalizeActivation();
+        break;
+      default:
+        // The plugin is not started
+        q_func()->start(0);
+    }
+  }
+
+  void ctkPluginPrivate::registerServiceDescriptor()
+  {
+    if (serviceDescriptorRegistered)
+    {
+      return;
+    }
+    QByteArray serviceDescriptor = archive->getPluginResource("servicedescriptor.xml");
+    if (!serviceDescriptor.isEmpty())
+    {
+      fwCtx->services.registerService(this, serviceDescriptor);
+    }
+    serviceDescriptorRegistered = true;
+  }
+
+  void ctkPluginPrivate::prepareActivation()
+  {
+    registerServiceDescriptor();
+    if (!pluginContext)
+    {
+      pluginContext = new ctkPluginContext(this);
+    }
+  }
+
   void ctkPluginPrivate::start0()
   {
     fwCtx->listeners.emitPluginChanged(ctkPluginEvent(ctkPluginEvent::STARTING, this->q_func()));
 
     try {
+      if (!pluginLoader.isLoaded())
+      {
+        pluginLoader.setFileName(archive->getLibLocation());
+      }
       pluginLoader.load();
       if (!pluginLoader.isLoaded())
       {
@@ -227,6 +281,16 @@
 
       pluginActivator->start(pluginContext);
 
+      // Plugins may be started by a worker thread of
+      // ctkPlugins::startPlugins(), the activator and the services it
+      // registered belong to the framework thread
+      QObject* activatorObject = pluginLoader.instance();
+      if (activatorObject->thread() != fwCtx->listeners.thread())
+      {
+        activatorObject->moveToThread(fwCtx->listeners.thread());
+        fwCtx->services.moveRegisteredToThread(this, fwCtx->listeners.thread());
+      }
+
       if (ctkPlugin::UNINSTALLED == state)
       {
         throw ctkPluginException("ctkPlugin uninstalled during start()", ctkPluginException::STATECHANGE_ERROR);
@@ -27,6 +27,7 @@
 #include "ctkRequirePlugin_p.h"
 
 #include <QHash>
+#include <QMutex>
 #include <QPluginLoader>
 
 
@@ -91,6 +92,33 @@
      */
     void finalizeActivation();
 
+    /**
+     * Activates a plugin which was started according to its lazy
+     * activation policy and waits in the STARTING state. Called when
+     * a consumer first fetches one of the services the plugin declared
+     * in its service descriptor, this loads the plugin library and calls
+     * the start method of its activator. The autostart setting of the
+     * plugin is not changed.
+     *
+     * Does nothing if the plugin is active or being activated.
+     */
+    void activateLazily();
+
+    /**
+     * Registers the Qt Mobility service descriptor of the plugin, if not
+     * done yet. QServiceManager is not thread safe, this must be called
+     * in the framework thread.
+     */
+    void registerServiceDescriptor();
+
+    /**
+     * Registers the service descriptor and creates the context of the
+     * plugin, such that the activation does not touch the QServiceManager
+     * and the context is owned by the framework thread. Called by
+     * ctkPlugins::startPlugins() before starting plugins concurrently.
+     */
+    void prepareActivation();
+
     /**
      * Union of flags allowing plugin class access
      */
@@ -139,7 +167,8 @@
     ctkPluginActivator* pluginActivator;
 
     /**
-     * The Qt plugin loader for the plugin
+     * The Qt plugin loader for the plugin. Its file name is only set when
+     * the plugin is activated, the library is not touched before.
      */
     QPluginLoader pluginLoader;
 
@@ -170,6 +199,22 @@
     /** True during the state change from active to resolved. */
     bool deactivating;
 
+    /** True once the service descriptor of the plugin is registered. */
+    bool serviceDescriptorRegistered;
+
+    /**
+     * Milliseconds spent loading the plugin and in the start method of
+     * its activator during the last activation, -1 if it was not activated.
+     */
+    int activationTime;
+
+    /**
+     * Serializes starting the plugin. A lazy activation may be triggered
+     * from any thread using the services of the plugin, and by the
+     * activator of the plugin itself.
+     */
+    QMutex activationLock;
+
     /** Saved exception of resolve failure */
     //ctkPluginException resolveFailException;
 
@@ -0,0 +1,285 @@
+/*=============================================================================
+
+  Library: CTK
+
+  Copyright (c) 2010 German Cancer Research Center,
+    Division of Medical and Biological Informatics
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#include "ctkPluginResourceCache_p.h"
+
+#include "ctkPluginException.h"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QPluginLoader>
+#include <QSet>
+
+// "CTKR"
+#define RESOURCECACHE_MAGIC 0x43544b52
+#define RESOURCECACHE_VERSION 1
+
+// magic, version and index offset
+#define RESOURCECACHE_HEADER_SIZE 16
+
+
+  ctkPluginResourceCache::ctkPluginResourceCache()
+    : data(0), dataSize(0)
+  {
+
+  }
+
+  ctkPluginResourceCache::~ctkPluginResourceCache()
+  {
+    close();
+  }
+
+  QString ctkPluginResourceCache::resourcePrefix(const QString& localPath)
+  {
+    QString prefix = QFileInfo(localPath).baseName();
+    if (prefix.startsWith("lib"))
+    {
+      prefix = prefix.mid(3);
+    }
+    prefix.replace("_", ".");
+
+    return QString(":/") + prefix + "/";
+  }
+
+  void ctkPluginResourceCache::write(const QString& localPath, const QString& cachePath)
+  {
+    QPluginLoader pluginLoader;
+    pluginLoader.setFileName(localPath);
+    if (!pluginLoader.load())
+    {
+      throw ctkPluginException(QString("The plugin could not be loaded: %1").arg(localPath));
+    }
+
+    try
+    {
+      write(localPath, cachePath, resourcePrefix(localPath));
+    }
+    catch (...)
+    {
+      pluginLoader.unload();
+      throw;
+    }
+    pluginLoader.unload();
+  }
+
+  void ctkPluginResourceCache::write(const QString& localPath, const QString& cachePath,
+                                     const QString& resourceDir)
+  {
+    QFileInfo cacheInfo(cachePath);
+    if (!cacheInfo.dir().exists() && !QDir::root().mkpath(cacheInfo.path()))
+    {
+      throw ctkPluginException(QString("Could not create resource cache directory: %1").arg(cacheInfo.path()));
+    }
+
+    // Write to a temporary file first, so that a crash never leaves
+    // a truncated cache which looks valid
+    const QString partPath = cachePath + ".part";
+    QFile cacheFile(partPath);
+    if (!cacheFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+      throw ctkPluginException(QString("Could not write resource cache: %1").arg(partPath));
+    }
+
+    QDataStream out(&cacheFile);
+    out << quint32(RESOURCECACHE_MAGIC) << quint32(RESOURCECACHE_VERSION) << qint64(0);
+
+    // The resource data is written as it is read, the index follows it
+    const QString prefix = resourceDir.endsWith('/') ? resourceDir : resourceDir + "/";
+    QList<QPair<QString, QPair<qint64, qint64> > > entries;
+    qint64 offset = RESOURCECACHE_HEADER_SIZE;
+    QDirIterator dirIter(prefix, QDirIterator::Subdirectories);
+    while (dirIter.hasNext())
+    {
+      QString resourcePath = dirIter.next();
+      if (QFileInfo(resourcePath).isDir()) continue;
+
+      QFile resourceFile(resourcePath);
+      if (!resourceFile.open(QIODevice::ReadOnly))
+      {
+        cacheFile.remove();
+        throw ctkPluginException(QString("Could not read resource %1 of %2").arg(resourcePath).arg(localPath));
+      }
+      QByteArray resourceData = resourceFile.readAll();
+      resourceFile.close();
+
+      out.writeRawData(resourceData.constData(), resourceData.size());
+      entries.append(qMakePair(resourcePath.mid(prefix.size()-1),
+                               qMakePair(offset, qint64(resourceData.size()))));
+      offset += resourceData.size();
+    }
+
+    QFileInfo pluginInfo(localPath);
+    out << localPath << pluginInfo.size() << pluginInfo.lastModified().toTime_t()
+        << quint32(entries.size());
+    for (int i = 0; i < entries.size(); ++i)
+    {
+      out << entries[i].first << entries[i].second.first << entries[i].second.second;
+    }
+
+    cacheFile.seek(8);
+    out << offset;
+
+    if (out.status() != QDataStream::Ok || !cacheFile.flush())
+    {
+      cacheFile.remove();
+      throw ctkPluginException(QString("Could not write resource cache: %1").arg(partPath));
+    }
+    cacheFile.close();
+
+    QFile::remove(cachePath);
+    if (!QFile::rename(partPath, cachePath))
+    {
+      QFile::remove(partPath);
+      throw ctkPluginException(QString("Could not write resource cache: %1").arg(cachePath));
+    }
+  }
+
+  bool ctkPluginResourceCache::open(const QString& cachePath, const QString& localPath)
+  {
+    close();
+
+    file.setFileName(cachePath);
+    if (!file.open(QIODevice::ReadOnly) || file.size() < RESOURCECACHE_HEADER_SIZE)
+    {
+      close();
+      return false;
+    }
+    dataSize = file.size();
+    data = file.map(0, dataSize);
+    if (!data)
+    {
+      close();
+      return false;
+    }
+
+    QDataStream header(QByteArray::fromRawData(reinterpret_cast<const char*>(data),
+                                               RESOURCECACHE_HEADER_SIZE));
+    quint32 magic = 0;
+    quint32 version = 0;
+    qint64 indexOffset = 0;
+    header >> magic >> version >> indexOffset;
+    if (magic != RESOURCECACHE_MAGIC || version != RESOURCECACHE_VERSION ||
+        indexOffset < RESOURCECACHE_HEADER_SIZE || indexOffset >= dataSize)
+    {
+      close();
+      return false;
+    }
+
+    QDataStream in(QByteArray::fromRawData(reinterpret_cast<const char*>(data + indexOffset),
+                                           dataSize - indexOffset));
+    QString pluginPath;
+    qint64 pluginSize = 0;
+    uint pluginLastModified = 0;
+    quint32 count = 0;
+    in >> pluginPath >> pluginSize >> pluginLastModified >> count;
+
+    // The cache is outdated if the plugin library changed
+    QFileInfo pluginInfo(localPath);
+    if (in.status() != QDataStream::Ok || pluginPath != localPath ||
+        pluginSize != pluginInfo.size() ||
+        pluginLastModified != pluginInfo.lastModified().toTime_t())
+    {
+      close();
+      return false;
+    }
+
+    index.reserve(count);
+    for (quint32 i = 0; i < count; ++i)
+    {
+      QString path;
+      qint64 offset = 0;
+      qint64 size = 0;
+      in >> path >> offset >> size;
+      if (in.status() != QDataStream::Ok || offset < RESOURCECACHE_HEADER_SIZE ||
+          size < 0 || offset + size > indexOffset)
+      {
+        close();
+        return false;
+      }
+      index.insert(path, qMakePair(offset, size));
+    }
+
+    return true;
+  }
+
+  void ctkPluginResourceCache::close()
+  {
+    index.clear();
+    if (data)
+    {
+      file.unmap(data);
+      data = 0;
+    }
+    dataSize = 0;
+    file.close();
+  }
+
+  bool ctkPluginResourceCache::isOpen() const
+  {
+    return data != 0;
+  }
+
+  QByteArray ctkPluginResourceCache::getResource(const QString& res) const
+  {
+    QString resourcePath = res.startsWith('/') ? res : QString("/") + res;
+    QHash<QString, QPair<qint64, qint64> >::const_iterator entry = index.find(resourcePath);
+    if (entry == index.end())
+    {
+      return QByteArray();
+    }
+
+    return QByteArray::fromRawData(reinterpret_cast<const char*>(data + entry.value().first),
+                                   static_cast<int>(entry.value().second));
+  }
+
+  QStringList ctkPluginResourceCache::findResourcesPath(const QString& path) const
+  {
+    QString resourcePath = path.startsWith('/') ? path : QString("/") + path;
+    if (!resourcePath.endsWith('/'))
+      resourcePath += "/";
+
+    QStringList paths;
+    QSet<QString> found;
+    QHash<QString, QPair<qint64, qint64> >::const_iterator entry;
+    for (entry = index.begin(); entry != index.end(); ++entry)
+    {
+      if (!entry.key().startsWith(resourcePath)) continue;
+
+      QString currPath = entry.key().mid(resourcePath.size());
+      int slashIndex = currPath.indexOf('/');
+      if (slashIndex > 0)
+      {
+        currPath = currPath.left(slashIndex+1);
+      }
+
+      if (!found.contains(currPath))
+      {
+        found.insert(currPath);
+        paths << currPath;
+      }
+    }
+
+    return paths;
+
+}
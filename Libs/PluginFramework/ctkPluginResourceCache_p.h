@@ -0,0 +1,123 @@
+/*=============================================================================
+
+  Library: CTK
+
+  Copyright (c) 2010 German Cancer Research Center,
+    Division of Medical and Biological Informatics
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CTKPLUGINRESOURCECACHE_P_H
+#define CTKPLUGINRESOURCECACHE_P_H
+
+#include <QFile>
+#include <QHash>
+#include <QPair>
+#include <QStringList>
+
+#include "CTKPluginFrameworkExport.h"
+
+  /**
+   * Read-only, memory-mapped copy of the Qt resources embedded in a
+   * plugin library.
+   *
+   * The cache file is written once per plugin library (see write()) and
+   * records the path, size and modification time of the library it was
+   * extracted from. Resources are returned as QByteArray views on the
+   * mapped file, without copying and without loading the plugin library.
+   *
+   * Exported for the tests only, it is not part of the public API.
+   */
+  class CTK_PLUGINFW_EXPORT ctkPluginResourceCache {
+
+  public:
+
+    ctkPluginResourceCache();
+
+    /**
+     * Unmaps the cache file. Byte arrays returned by getResource()
+     * must not be used afterwards.
+     */
+    ~ctkPluginResourceCache();
+
+    /**
+     * Extract all resources of the plugin library \a localPath into the
+     * cache file \a cachePath. The library is loaded with a QPluginLoader
+     * and unloaded again.
+     *
+     * @throws ctkPluginException if the library could not be loaded or
+     *         the cache file could not be written.
+     */
+    static void write(const QString& localPath, const QString& cachePath);
+
+    /**
+     * Write the files under \a resourceDir, a Qt resource prefix or a
+     * directory, into the cache file \a cachePath, recorded as extracted
+     * from the library \a localPath.
+     *
+     * @throws ctkPluginException if a resource could not be read or
+     *         the cache file could not be written.
+     */
+    static void write(const QString& localPath, const QString& cachePath,
+                      const QString& resourceDir);
+
+    /**
+     * Map the cache file \a cachePath. Fails if the file does not exist,
+     * is not a resource cache or was not extracted from the current
+     * version of the plugin library \a localPath.
+     */
+    bool open(const QString& cachePath, const QString& localPath);
+
+    void close();
+
+    bool isOpen() const;
+
+    /**
+     * Get a resource relative to the plugin specific resource prefix.
+     * The returned byte array shares the mapped memory of the cache and
+     * is only valid as long as the cache stays open.
+     *
+     * @return The resource, or an empty byte array if it doesn't exist.
+     */
+    QByteArray getResource(const QString& res) const;
+
+    /**
+     * Get the entries directly under \a path. Sub-directories end with a '/'.
+     */
+    QStringList findResourcesPath(const QString& path) const;
+
+  private:
+
+    Q_DISABLE_COPY(ctkPluginResourceCache)
+
+    /**
+     * The resource prefix of a plugin, derived from its library name.
+     * E.g. ":/org.commontk.eventbus/" for "liborg_commontk_eventbus.so".
+     */
+    static QString resourcePrefix(const QString& localPath);
+
+    QFile file;
+    uchar* data;
+    qint64 dataSize;
+
+    /**
+     * Resource path -> offset and size in the mapped file
+     */
+    QHash<QString, QPair<qint64, qint64> > index;
+
+  };
+
+
+#endif // CTKPLUGINRESOURCECACHE_P_H
@@ -25,6 +25,7 @@
 #include <QFileInfo>
 #include <QUrl>
 #include <QDir>
+#include <QFile>
 
 // CTK includes
 #include "ctkPluginArchive_p.h"
@@ -43,6 +44,7 @@
 
     pluginDatabase.open();
     archives << pluginDatabase.getPluginArchives();
+    pluginDatabase.writeSnapshot(archives);
   }
 
   ctkPluginArchive* ctkPluginStorage::insertPlugin(const QUrl& location, const QString& localPath)
@@ -52,6 +54,20 @@
     return pa;
   }
 
+  QList<ctkPluginArchive*> ctkPluginStorage::insertPlugins(const QList<QUrl>& locations, const QStringList& localPaths,
+                                                          QStringList* errors)
+  {
+    QList<ctkPluginArchive*> pas = pluginDatabase.insertPlugins(locations, localPaths, errors);
+    foreach (ctkPluginArchive* pa, pas)
+    {
+      if (pa)
+      {
+        archives << pa;
+      }
+    }
+    return pas;
+  }
+
   ctkPluginArchive* ctkPluginStorage::updatePluginArchive(ctkPluginArchive* old, const QString& localPath)
   {
     //return new BundleArchiveImpl((BundleArchiveImpl)old, is);
@@ -111,7 +127,10 @@
     {
       pluginDatabase.removeArchive(pa);
       removed = archives.removeAll(pa);
+      // The resource cache is unmapped when the archive is deleted
+      const QString cachePath = getResourceCachePath(pa->getLibLocation());
       delete pa;
+      QFile::remove(cachePath);
     }
     catch (const ctkPluginDatabaseException& exc)
     {
@@ -122,29 +141,8 @@
     return removed;
   }
 
-  QByteArray ctkPluginStorage::getPluginResource(long pluginId, const QString& res) const
-  {
-    try
-    {
-      return pluginDatabase.getPluginResource(pluginId, res);
-    }
-    catch (const ctkPluginDatabaseException& exc)
-    {
-      qDebug() << QString("Getting plugin resource %1 failed:").arg(res) << exc;
-      return QByteArray();
-    }
-  }
-
-  QStringList ctkPluginStorage::findResourcesPath(long pluginId, const QString& path) const
+  QString ctkPluginStorage::getResourceCachePath(const QString& localPath) const
   {
-    try
-    {
-      return pluginDatabase.findResourcesPath(pluginId, path);
-    }
-    catch (const ctkPluginDatabaseException& exc)
-    {
-      qDebug() << QString("Getting plugin resource paths for %1 failed:").arg(path) << exc;
-      return QStringList();
-    }
+    return pluginDatabase.getResourceCachePath(localPath);
 
 }
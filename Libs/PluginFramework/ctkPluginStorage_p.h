@@ -79,6 +79,21 @@ class QIODevice;
     ctkPluginArchive* insertPlugin(const QUrl& location, const QString& localPath);
 
 
+    /**
+     * Insert several plugins (shared libraries) into the persistent storage
+     * at once.
+     *
+     * @param locations Locations of the plugins.
+     * @param localPaths Paths to the plugins on the local file system
+     * @param errors Reasons why plugins were skipped, see
+     *        ctkPluginDatabase::insertPlugins().
+     * @return ctkPlugin archive objects, in the order of \a locations,
+     *         <code>0</code> for the skipped plugins.
+     */
+    QList<ctkPluginArchive*> insertPlugins(const QList<QUrl>& locations, const QStringList& localPaths,
+                                           QStringList* errors = 0);
+
+
     /**
      * Insert a new plugin (shared library) into the persistent
      * storagedata as an update
@@ -128,9 +143,13 @@ class QIODevice;
      */
     QList<QString> getStartOnLaunchPlugins();
 
-    QByteArray getPluginResource(long pluginId, const QString& res) const;
-
-    QStringList findResourcesPath(long pluginId, const QString& path) const;
+    /**
+     * Get the path of the resource cache file of a plugin.
+     *
+     * @param localPath Path to the plugin library on the local file system.
+     * @return The path to the cache file, which may not exist yet.
+     */
+    QString getResourceCachePath(const QString& localPath) const;
 
     /**
      * Close this plugin storage and all bundles in it.
@@ -24,13 +24,240 @@
 #include "ctkPluginPrivate_p.h"
 #include "ctkPluginArchive_p.h"
 #include "ctkPluginException.h"
+#include "ctkPluginConstants.h"
 #include "ctkPluginFrameworkContext_p.h"
+#include "ctkPluginFrameworkUtil_p.h"
+#include "ctkPluginResourceCache_p.h"
 #include "ctkVersionRange_p.h"
 
+#include <ctkDependencyGraph.h>
+
 #include <stdexcept>
 #include <iostream>
 
+#include <QRunnable>
+#include <QSet>
+#include <QThreadPool>
+#include <QTime>
 #include <QUrl>
+#include <QVector>
+
+
+  /**
+   * Brings the resource cache of a plugin library up to date and reads
+   * the symbolic names from its manifest, without touching the database.
+   * Runs in a worker thread of ctkPlugins::install(const QList<QUrl>&, int).
+   */
+  class ctkPluginInstallTask : public QRunnable
+  {
+
+  public:
+
+    const QUrl location;
+    const QString localPath;
+    const QString cachePath;
+
+    QString symbolicName;
+    QStringList requiredNames;
+
+    /**
+     * Empty if the plugin can be installed
+     */
+    QString error;
+
+    ctkPluginInstallTask(const QUrl& location, const QString& cachePath)
+      : location(location), localPath(location.toLocalFile()), cachePath(cachePath)
+    {
+      setAutoDelete(false);
+    }
+
+    void run()
+    {
+      try
+      {
+        ctkPluginResourceCache resources;
+        if (!resources.open(cachePath, localPath))
+        {
+          ctkPluginResourceCache::write(localPath, cachePath);
+          if (!resources.open(cachePath, localPath))
+          {
+            throw ctkPluginException(QString("Could not open resource cache: ") + cachePath);
+          }
+        }
+
+        QByteArray manifestResource = resources.getResource("META-INF/MANIFEST.MF");
+        if (manifestResource.isEmpty())
+        {
+          throw ctkPluginException(QString("ctkPlugin has no MANIFEST.MF resource, location=") + location.toString());
+        }
+        ctkPluginManifest manifest(manifestResource);
+        symbolicName = manifest.getAttribute(PluginConstants::PLUGIN_SYMBOLICNAME);
+
+        QList<QMap<QString, QStringList> > requireList =
+            ctkPluginFrameworkUtil::parseEntries(PluginConstants::REQUIRE_PLUGIN,
+                                                 manifest.getAttribute(PluginConstants::REQUIRE_PLUGIN),
+                                                 true, true, false);
+        QListIterator<QMap<QString, QStringList> > i(requireList);
+        while (i.hasNext())
+        {
+          requiredNames << i.next().value("$key").front();
+        }
+      }
+      catch (const std::exception& e)
+      {
+        error = e.what();
+      }
+    }
+
+  };
+
+  /**
+   * Starts a plugin of ctkPlugins::startPlugins() according to its
+   * autostart setting. Runs in the calling thread, or in a worker thread
+   * if the plugins of a level are started concurrently. In the latter
+   * case, prepare() must be called in the framework thread first.
+   */
+  class ctkPluginStartTask : public QRunnable
+  {
+
+  public:
+
+    ctkPluginPrivate* const plugin;
+
+    ctkPluginStartTask(ctkPluginPrivate* plugin)
+      : plugin(plugin), error(0)
+    {
+      setAutoDelete(false);
+    }
+
+    ~ctkPluginStartTask()
+    {
+      delete error;
+    }
+
+    /**
+     * Prepares the activation in the calling thread, such that only the
+     * activation itself runs in the worker thread
+     */
+    void prepare()
+    {
+      try
+      {
+        QMutexLocker lock(&plugin->activationLock);
+        plugin->prepareActivation();
+      }
+      catch (const std::exception& e)
+      {
+        error = new ctkPluginException(QString("ctkPlugin start failed: ") + e.what(),
+                                       ctkPluginException::UNSPECIFIED, e);
+      }
+    }
+
+    bool failed() const
+    {
+      return error != 0;
+    }
+
+    void run()
+    {
+      if (error)
+      {
+        return;
+      }
+      try
+      {
+        const int autostartSetting = plugin->archive->getAutostartSetting();
+        // Launch must not change the autostart setting of a plugin
+        ctkPlugin::StartOptions option = ctkPlugin::START_TRANSIENT;
+        if (ctkPlugin::START_ACTIVATION_POLICY == autostartSetting)
+        {
+          // Transient start according to the plugins activation policy.
+          option |= ctkPlugin::START_ACTIVATION_POLICY;
+        }
+        plugin->q_func()->start(option);
+      }
+      catch (const ctkPluginException& pe)
+      {
+        error = new ctkPluginException(pe);
+      }
+      catch (const std::exception& e)
+      {
+        error = new ctkPluginException(QString("ctkPlugin start failed: ") + e.what(),
+                                       ctkPluginException::UNSPECIFIED, e);
+      }
+    }
+
+    /**
+     * Emits the start error, if any, in the calling thread
+     */
+    void reportError()
+    {
+      if (error)
+      {
+        plugin->fwCtx->listeners.frameworkError(plugin->q_func(), *error);
+      }
+    }
+
+  private:
+
+    ctkPluginException* error;
+
+  };
+
+  /**
+   * Returns the indexes of \a tasks ordered such that a plugin comes
+   * after the plugins of the list it requires. Keeps the given order
+   * if the requirements are cyclic.
+   */
+  static QList<int> installOrder(const QList<ctkPluginInstallTask*>& tasks)
+  {
+    QList<int> order;
+    for (int i = 0; i < tasks.size(); ++i)
+    {
+      order << i;
+    }
+    if (tasks.size() < 2)
+    {
+      return order;
+    }
+
+    QMultiHash<QString, int> providers;
+    for (int i = 0; i < tasks.size(); ++i)
+    {
+      providers.insert(tasks.at(i)->symbolicName, i);
+    }
+
+    // Edges go from the requiring plugin to the required one (vertices
+    // start at 1), which keeps the out-degree at the number of Require-Plugin
+    // entries. The topological order is therefore reversed.
+    ctkDependencyGraph graph(tasks.size());
+    for (int i = 0; i < tasks.size(); ++i)
+    {
+      foreach (const QString& name, tasks.at(i)->requiredNames)
+      {
+        foreach (int provider, providers.values(name))
+        {
+          if (provider != i)
+          {
+            graph.insertEdge(i + 1, provider + 1);
+          }
+        }
+      }
+    }
+
+    QList<int> sorted;
+    if (!graph.topologicalSort(sorted))
+    {
+      return order;
+    }
+
+    order.clear();
+    for (int i = sorted.size() - 1; i >= 0; --i)
+    {
+      order << sorted.at(i) - 1;
+    }
+    return order;
+  }
 
 
   ctkPlugins::ctkPlugins(ctkPluginFrameworkContext* fw) {
@@ -133,6 +360,137 @@
 
   }
 
+  QList<ctkPlugin*> ctkPlugins::install(const QList<QUrl>& locations, int threads)
+  {
+    if (!fwCtx)
+    { // This ctkPlugins instance has been closed!
+      throw std::logic_error("ctkPlugins::install(locations) called on closed plugins object.");
+    }
+
+    QList<ctkPlugin*> res;
+    QList<ctkPluginException> errors;
+
+    QList<ctkPluginInstallTask*> tasks;
+    {
+      QReadLocker lock(&pluginsLock);
+
+      QSet<QString> newLocations;
+      foreach (const QUrl& location, locations)
+      {
+        QHash<QString, ctkPlugin*>::const_iterator it = plugins.find(location.toString());
+        if (it != plugins.end())
+        {
+          res.push_back(it.value());
+          continue;
+        }
+        if (newLocations.contains(location.toString()))
+        {
+          continue;
+        }
+
+        if (location.scheme() != "file")
+        {
+          errors.push_back(ctkPluginException(QString("Failed to install plugin: Unsupported url scheme: ") + location.scheme()));
+          continue;
+        }
+        newLocations.insert(location.toString());
+        tasks.push_back(new ctkPluginInstallTask(location, fwCtx->storage.getResourceCachePath(location.toLocalFile())));
+      }
+    }
+
+    // Loading the libraries and extracting their resources is the
+    // expensive part of an install, it needs neither the database nor
+    // the plugins lock
+    QThreadPool pool;
+    if (threads > 0)
+    {
+      pool.setMaxThreadCount(threads);
+    }
+    foreach (ctkPluginInstallTask* task, tasks)
+    {
+      pool.start(task);
+    }
+    pool.waitForDone();
+
+    {
+      QWriteLocker lock(&pluginsLock);
+
+      // The plugins may have been installed by another thread meanwhile
+      QList<ctkPluginInstallTask*> installable;
+      foreach (ctkPluginInstallTask* task, tasks)
+      {
+        QHash<QString, ctkPlugin*>::const_iterator it = plugins.find(task->location.toString());
+        if (it != plugins.end())
+        {
+          res.push_back(it.value());
+        }
+        else if (task->error.isEmpty())
+        {
+          installable.push_back(task);
+        }
+        else
+        {
+          errors.push_back(ctkPluginException(QString("Failed to install plugin %1: %2")
+                                              .arg(task->location.toString()).arg(task->error)));
+        }
+      }
+
+      // Required plugins get lower ids, such that they are installed
+      // and restarted first
+      QList<QUrl> orderedLocations;
+      QStringList orderedPaths;
+      foreach (int i, installOrder(installable))
+      {
+        orderedLocations.push_back(installable.at(i)->location);
+        orderedPaths.push_back(installable.at(i)->localPath);
+      }
+      qDeleteAll(tasks);
+
+      QList<ctkPluginArchive*> pas;
+      QStringList insertErrors;
+      try
+      {
+        pas = fwCtx->storage.insertPlugins(orderedLocations, orderedPaths, &insertErrors);
+      }
+      catch (const std::exception& e)
+      {
+        throw ctkPluginException(QString("Failed to install plugins: ") + QString(e.what()),
+                                ctkPluginException::UNSPECIFIED, e);
+      }
+
+      for (int i = 0; i < pas.size(); ++i)
+      {
+        ctkPluginArchive* pa = pas.at(i);
+        if (!pa)
+        {
+          errors.push_back(ctkPluginException(QString("Failed to install plugin %1: %2")
+                                              .arg(orderedLocations.at(i).toString()).arg(insertErrors.at(i))));
+          continue;
+        }
+        try
+        {
+          ctkPlugin* plugin = new ctkPlugin(fwCtx, pa);
+          plugins.insert(pa->getPluginLocation().toString(), plugin);
+          res.push_back(plugin);
+        }
+        catch (const std::exception& e)
+        {
+          errors.push_back(ctkPluginException(QString("Failed to install plugin %1: %2")
+                                              .arg(pa->getPluginLocation().toString()).arg(e.what())));
+          pa->purge();
+        }
+      }
+    }
+
+    // Report outside of the lock, listeners may query the plugins
+    foreach (const ctkPluginException& pe, errors)
+    {
+      fwCtx->listeners.frameworkError(&fwCtx->systemPlugin, pe);
+    }
+
+    return res;
+  }
+
   void ctkPlugins::remove(const QUrl& location)
   {
     QWriteLocker lock(&pluginsLock);
@@ -309,33 +667,154 @@
     }
   }
 
-  void ctkPlugins::startPlugins(const QList<ctkPlugin*>& slist) const {
-    // Sort in start order
-    // Resolve first to avoid dead lock
+  void ctkPlugins::startPlugins(const QList<ctkPlugin*>& slist, int threads) const {
+    QTime startTimer;
+    startTimer.start();
+
+    // Resolve first to avoid dead lock, and because resolving
+    // is not thread safe
+    QList<ctkPlugin*> resolved;
     QListIterator<ctkPlugin*> it(slist);
     while (it.hasNext())
     {
       ctkPlugin* plugin = it.next();
       ctkPluginPrivate* pp = plugin->d_func();
-      pp->getUpdatedState();
+      try
+      {
+        if (pp->getUpdatedState() == ctkPlugin::RESOLVED)
+        {
+          resolved.push_back(plugin);
+        }
+      }
+      catch (const ctkPluginException&)
+      {
+        // already reported by getUpdatedState()
+      }
     }
 
-    it.toFront();
-    while (it.hasNext())
+    // Sort in start order
+    QList<QList<ctkPlugin*> > levels = startLevels(resolved);
+
+    foreach (const QList<ctkPlugin*>& level, levels)
     {
-      ctkPlugin* plugin = it.next();
-      ctkPluginPrivate* pp = plugin->d_func();
-      if (pp->getUpdatedState() == ctkPlugin::RESOLVED)
+      if (threads <= 1 || level.size() == 1)
       {
-        try
+        foreach (ctkPlugin* plugin, level)
+        {
+          ctkPluginStartTask task(plugin->d_func());
+          task.run();
+          task.reportError();
+        }
+        continue;
+      }
+
+      // The plugins of a level do not require each other
+      QList<ctkPluginStartTask*> tasks;
+      QThreadPool pool;
+      pool.setMaxThreadCount(threads);
+      foreach (ctkPlugin* plugin, level)
+      {
+        ctkPluginStartTask* task = new ctkPluginStartTask(plugin->d_func());
+        tasks.push_back(task);
+        task->prepare();
+        if (!task->failed())
         {
-          plugin->start(0);
+          pool.start(task);
         }
-        catch (const ctkPluginException& pe)
+      }
+      pool.waitForDone();
+
+      foreach (ctkPluginStartTask* task, tasks)
+      {
+        task->reportError();
+      }
+      qDeleteAll(tasks);
+    }
+
+    // Report the slowest plugins first
+    QMultiMap<int, ctkPluginPrivate*> activationTimes;
+    foreach (ctkPlugin* plugin, resolved)
+    {
+      ctkPluginPrivate* pp = plugin->d_func();
+      activationTimes.insert(-pp->activationTime, pp);
+    }
+    fwCtx->log() << "Started" << resolved.size() << "plugins in" << levels.size()
+                 << "levels in" << startTimer.elapsed() << "ms, using" << qMax(threads, 1) << "threads:";
+    QMapIterator<int, ctkPluginPrivate*> timeIter(activationTimes);
+    while (timeIter.hasNext())
+    {
+      ctkPluginPrivate* pp = timeIter.next().value();
+      QString activation = QString("%1 ms").arg(pp->activationTime);
+      if (pp->activationTime < 0)
+      {
+        activation = pp->state == ctkPlugin::STARTING ? "lazy" : "not activated";
+      }
+      fwCtx->log() << " #" << pp->id << " " << pp->symbolicName << ":" << activation;
+    }
+  }
+
+  QList<QList<ctkPlugin*> > ctkPlugins::startLevels(const QList<ctkPlugin*>& slist) const
+  {
+    QList<QList<ctkPlugin*> > levels;
+    if (slist.isEmpty())
+    {
+      return levels;
+    }
+
+    // required[i] lists the plugins of slist which plugin i requires
+    QList<QList<int> > required;
+    ctkDependencyGraph graph(slist.size());
+    for (int i = 0; i < slist.size(); ++i)
+    {
+      required.push_back(QList<int>());
+      foreach (ctkRequirePlugin* pr, slist.at(i)->d_func()->require)
+      {
+        for (int j = 0; j < slist.size(); ++j)
         {
-          pp->fwCtx->listeners.frameworkError(plugin, pe);
+          ctkPlugin* provider = slist.at(j);
+          if (j != i && provider->getSymbolicName() == pr->name &&
+              pr->pluginRange.withinRange(provider->getVersion()))
+          {
+            required[i].push_back(j);
+            // Edges go from the requiring plugin to the required one, see
+            // installOrder()
+            graph.insertEdge(i + 1, j + 1);
+          }
         }
       }
     }
 
+    QList<int> sorted;
+    if (!graph.topologicalSort(sorted))
+    {
+      // Cyclic requirements, start one after the other
+      foreach (ctkPlugin* plugin, slist)
+      {
+        levels.push_back(QList<ctkPlugin*>() << plugin);
+      }
+      return levels;
+    }
+
+    // A plugin is one level above the highest plugin it requires
+    QVector<int> pluginLevels(slist.size(), 0);
+    for (int k = sorted.size() - 1; k >= 0; --k)
+    {
+      const int i = sorted.at(k) - 1;
+      foreach (int j, required.at(i))
+      {
+        pluginLevels[i] = qMax(pluginLevels[i], pluginLevels[j] + 1);
+      }
+    }
+
+    // Keep the order of slist within a level
+    for (int i = 0; i < slist.size(); ++i)
+    {
+      while (levels.size() <= pluginLevels[i])
+      {
+        levels.push_back(QList<ctkPlugin*>());
+      }
+      levels[pluginLevels[i]].push_back(slist.at(i));
+    }
+    return levels;
+
 }
@@ -79,6 +79,25 @@
     ctkPlugin* install(const QUrl& location, QIODevice* in);
 
 
+    /**
+     * Install several new plugins at once. The plugin libraries are
+     * loaded and their resources extracted on a thread pool, without
+     * holding the plugins lock, then all plugins are written to the
+     * database in one transaction. Plugins
+     * of the list get ids such that required plugins come first.
+     *
+     * Plugins which fail to install are skipped and reported as
+     * framework errors of the system plugin.
+     *
+     * @param locations The locations to be installed
+     * @param threads Number of worker threads, 0 for
+     *        QThread::idealThreadCount()
+     * @return The installed plugins, including those which were already
+     *         installed
+     */
+    QList<ctkPlugin*> install(const QList<QUrl>& locations, int threads = 0);
+
+
     /**
      * Remove plugin registration.
      *
@@ -164,11 +183,26 @@
 
 
     /**
-     * Start a list of plugins in order
+     * Start a list of plugins according to their autostart setting.
+     * The plugins are started by levels: a plugin starts after the plugins
+     * of the list it requires. With more than one thread, the plugins of
+     * a level are started concurrently. Start errors are reported as
+     * framework errors. The time spent starting each plugin is logged.
      *
      * @param slist ctkPlugins to start.
+     * @param threads Number of worker threads, 1 starts the plugins in
+     *        the calling thread.
+     */
+    void startPlugins(const QList<ctkPlugin*>& slist, int threads = 1) const;
+
+  private:
+
+    /**
+     * Groups \a slist by levels of their Require-Plugin relations, using
+     * ctkDependencyGraph. Plugins of a level only require plugins of lower
+     * levels. If the requirements are cyclic, each plugin is a level.
      */
-    void startPlugins(const QList<ctkPlugin*>& slist) const;
+    QList<QList<ctkPlugin*> > startLevels(const QList<ctkPlugin*>& slist) const;
 
 
   };
@@ -42,7 +42,8 @@ QObject* ctkQtServiceRegistrationPrivate::getService()
   {
     try
     {
-      this->plugin->q_func()->start(0);
+      // First use of a service declared by a lazily started plugin
+      this->plugin->activateLazily();
     }
     catch (const ctkPluginException& e)
     {
@@ -24,6 +24,7 @@
 #include <QStringListIterator>
 #include <QMutexLocker>
 #include <QBuffer>
+#include <QThread>
 
 #include <algorithm>
 
@@ -421,7 +422,7 @@ QList<ctkServiceRegistration*> ctkServices::getRegisteredByPlugin(ctkPluginPriva
   for (QHashIterator<ctkServiceRegistration*, QStringList> i(services); i.hasNext(); )
   {
     ctkServiceRegistration* sr = i.next().key();
-    if (sr->d_func()->plugin = p)
+    if (sr->d_func()->plugin == p)
     {
       res.push_back(sr);
     }
@@ -430,6 +431,31 @@ QList<ctkServiceRegistration*> ctkServices::getRegisteredByPlugin(ctkPluginPriva
 }
 
 
+void ctkServices::moveRegisteredToThread(ctkPluginPrivate* p, QThread* thread) const
+{
+  QMutexLocker lock(&mutex);
+
+  for (QHashIterator<ctkServiceRegistration*, QStringList> i(services); i.hasNext(); )
+  {
+    ctkServiceRegistration* sr = i.next().key();
+    QObject* object = sr->d_func()->service;
+    if (sr->d_func()->plugin != p || !object || object->thread() != QThread::currentThread())
+    {
+      continue;
+    }
+    // Only a top level object can be moved, its children follow it
+    while (object->parent() && object->parent()->thread() == QThread::currentThread())
+    {
+      object = object->parent();
+    }
+    if (!object->parent())
+    {
+      object->moveToThread(thread);
+    }
+  }
+}
+
+
 QList<ctkServiceRegistration*> ctkServices::getUsedByPlugin(ctkPlugin* p) const
 {
   QMutexLocker lock(&mutex);
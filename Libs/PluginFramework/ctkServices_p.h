@@ -174,6 +174,17 @@ public:
   QList<ctkServiceRegistration*> getRegisteredByPlugin(ctkPluginPrivate* p) const;
 
 
+  /**
+   * Move the service objects registered by a plugin from the current
+   * thread to another one, with their parents if these live in the
+   * current thread too.
+   *
+   * @param p The plugin
+   * @param thread The new thread of the service objects
+   */
+  void moveRegisteredToThread(ctkPluginPrivate* p, QThread* thread) const;
+
+
   /**
    * Get all services that a plugin uses.
    *
@@ -5,6 +5,7 @@
 #
 
 SET(target_libraries
+  CTKCore
   QT_LIBRARIES
   QTMOBILITY_QTSERVICEFW_LIBRARIES
   )
@@ -5,6 +5,10 @@
 #  DCMTK_LIBRARIES     - Files to link against to use DCMTK
 #  DCMTK_FOUND         - If false, don't try to use DCMTK
 #  DCMTK_DIR           - (optional) Source directory for DCMTK
+#  DCMTK_HAS_DCMJPEG   - True if the JPEG codecs (dcmjpeg, ijg8, ijg12 and
+#                        ijg16) were found, they are then in DCMTK_LIBRARIES
+#  DCMTK_HAS_DCMJPLS   - True if the JPEG-LS codecs (dcmjpls and charls)
+#                        were found, they are then in DCMTK_LIBRARIES
 #
 # DCMTK_DIR can be used to make it simpler to find the various include
 # directories and compiled libraries if you've just compiled it in the
@@ -146,6 +150,107 @@ FIND_LIBRARY( DCMTK_dcmimgle_LIBRARY dcmimgle
   NO_DEFAULT_PATH
 )
 
+FIND_PATH( DCMTK_dcmjpeg_INCLUDE_DIR djdecode.h
+  PATHS
+    ${DCMTK_DIR}/dcmjpeg/include
+    ${DCMTK_DIR}/dcmjpeg
+    ${DCMTK_DIR}/include/dcmjpeg
+    ${DCMTK_DIR}/include/dcmtk/dcmjpeg
+  NO_DEFAULT_PATH
+)
+
+FIND_LIBRARY( DCMTK_dcmjpeg_LIBRARY dcmjpeg
+  PATHS
+    ${DCMTK_DIR}/dcmjpeg/libsrc
+    ${DCMTK_DIR}/dcmjpeg/libsrc/Release
+    ${DCMTK_DIR}/dcmjpeg/libsrc/Debug
+    ${DCMTK_DIR}/dcmjpeg/Release
+    ${DCMTK_DIR}/dcmjpeg/Debug
+    ${DCMTK_DIR}/lib
+  NO_DEFAULT_PATH
+)
+
+FIND_PATH( DCMTK_ijg8_INCLUDE_DIR jpeglib8.h
+  PATHS
+    ${DCMTK_DIR}/dcmjpeg/libijg8
+    ${DCMTK_DIR}/include/dcmjpeg/libijg8
+    ${DCMTK_DIR}/include/dcmtk/dcmjpeg/libijg8
+  NO_DEFAULT_PATH
+)
+
+FIND_LIBRARY( DCMTK_ijg8_LIBRARY ijg8
+  PATHS
+    ${DCMTK_DIR}/dcmjpeg/libijg8
+    ${DCMTK_DIR}/dcmjpeg/libijg8/Release
+    ${DCMTK_DIR}/dcmjpeg/libijg8/Debug
+    ${DCMTK_DIR}/lib
+  NO_DEFAULT_PATH
+)
+
+FIND_PATH( DCMTK_ijg12_INCLUDE_DIR jpeglib12.h
+  PATHS
+    ${DCMTK_DIR}/dcmjpeg/libijg12
+    ${DCMTK_DIR}/include/dcmjpeg/libijg12
+    ${DCMTK_DIR}/include/dcmtk/dcmjpeg/libijg12
+  NO_DEFAULT_PATH
+)
+
+FIND_LIBRARY( DCMTK_ijg12_LIBRARY ijg12
+  PATHS
+    ${DCMTK_DIR}/dcmjpeg/libijg12
+    ${DCMTK_DIR}/dcmjpeg/libijg12/Release
+    ${DCMTK_DIR}/dcmjpeg/libijg12/Debug
+    ${DCMTK_DIR}/lib
+  NO_DEFAULT_PATH
+)
+
+FIND_PATH( DCMTK_ijg16_INCLUDE_DIR jpeglib16.h
+  PATHS
+    ${DCMTK_DIR}/dcmjpeg/libijg16
+    ${DCMTK_DIR}/include/dcmjpeg/libijg16
+    ${DCMTK_DIR}/include/dcmtk/dcmjpeg/libijg16
+  NO_DEFAULT_PATH
+)
+
+FIND_LIBRARY( DCMTK_ijg16_LIBRARY ijg16
+  PATHS
+    ${DCMTK_DIR}/dcmjpeg/libijg16
+    ${DCMTK_DIR}/dcmjpeg/libijg16/Release
+    ${DCMTK_DIR}/dcmjpeg/libijg16/Debug
+    ${DCMTK_DIR}/lib
+  NO_DEFAULT_PATH
+)
+
+FIND_PATH( DCMTK_dcmjpls_INCLUDE_DIR djlsutil.h
+  PATHS
+    ${DCMTK_DIR}/dcmjpls/include
+    ${DCMTK_DIR}/dcmjpls
+    ${DCMTK_DIR}/include/dcmjpls
+    ${DCMTK_DIR}/include/dcmtk/dcmjpls
+  NO_DEFAULT_PATH
+)
+
+FIND_LIBRARY( DCMTK_dcmjpls_LIBRARY dcmjpls
+  PATHS
+    ${DCMTK_DIR}/dcmjpls/libsrc
+    ${DCMTK_DIR}/dcmjpls/libsrc/Release
+    ${DCMTK_DIR}/dcmjpls/libsrc/Debug
+    ${DCMTK_DIR}/dcmjpls/Release
+    ${DCMTK_DIR}/dcmjpls/Debug
+    ${DCMTK_DIR}/lib
+  NO_DEFAULT_PATH
+)
+
+# charls up to DCMTK 3.6.0, dcmtkcharls since
+FIND_LIBRARY( DCMTK_charls_LIBRARY NAMES dcmtkcharls charls
+  PATHS
+    ${DCMTK_DIR}/dcmjpls/libcharls
+    ${DCMTK_DIR}/dcmjpls/libcharls/Release
+    ${DCMTK_DIR}/dcmjpls/libcharls/Debug
+    ${DCMTK_DIR}/lib
+  NO_DEFAULT_PATH
+)
+
 # MM: I could not find this library on debian system / dcmtk 3.5.4
 # Michael Onken: this module is now called dcmqrdb. I will re-work that script soon...
 FIND_LIBRARY(DCMTK_imagedb_LIBRARY imagedb
@@ -198,6 +303,50 @@ IF( DCMTK_config_INCLUDE_DIR
     ${DCMTK_config_LIBRARY}
   )
 
+  # The codecs are optional, they come first since they depend on dcmimgle
+  # and dcmdata
+  SET( DCMTK_HAS_DCMJPEG FALSE )
+  IF( DCMTK_dcmjpeg_INCLUDE_DIR
+      AND DCMTK_dcmjpeg_LIBRARY
+      AND DCMTK_ijg8_INCLUDE_DIR
+      AND DCMTK_ijg8_LIBRARY
+      AND DCMTK_ijg12_INCLUDE_DIR
+      AND DCMTK_ijg12_LIBRARY
+      AND DCMTK_ijg16_INCLUDE_DIR
+      AND DCMTK_ijg16_LIBRARY )
+    SET( DCMTK_HAS_DCMJPEG TRUE )
+    SET( DCMTK_INCLUDE_DIR
+      ${DCMTK_INCLUDE_DIR}
+      ${DCMTK_dcmjpeg_INCLUDE_DIR}
+      ${DCMTK_ijg8_INCLUDE_DIR}
+      ${DCMTK_ijg12_INCLUDE_DIR}
+      ${DCMTK_ijg16_INCLUDE_DIR}
+    )
+    SET( DCMTK_LIBRARIES
+      ${DCMTK_dcmjpeg_LIBRARY}
+      ${DCMTK_ijg8_LIBRARY}
+      ${DCMTK_ijg12_LIBRARY}
+      ${DCMTK_ijg16_LIBRARY}
+      ${DCMTK_LIBRARIES}
+    )
+  ENDIF()
+
+  SET( DCMTK_HAS_DCMJPLS FALSE )
+  IF( DCMTK_dcmjpls_INCLUDE_DIR
+      AND DCMTK_dcmjpls_LIBRARY
+      AND DCMTK_charls_LIBRARY )
+    SET( DCMTK_HAS_DCMJPLS TRUE )
+    SET( DCMTK_INCLUDE_DIR
+      ${DCMTK_INCLUDE_DIR}
+      ${DCMTK_dcmjpls_INCLUDE_DIR}
+    )
+    SET( DCMTK_LIBRARIES
+      ${DCMTK_dcmjpls_LIBRARY}
+      ${DCMTK_charls_LIBRARY}
+      ${DCMTK_LIBRARIES}
+    )
+  ENDIF()
+
   IF(DCMTK_imagedb_LIBRARY)
    SET( DCMTK_LIBRARIES
    ${DCMTK_LIBRARIES}